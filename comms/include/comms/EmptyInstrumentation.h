@@ -0,0 +1,142 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// Contains definition of @ref comms::EmptyInstrumentation class
+
+#pragma once
+
+#include <cstddef>
+
+#include "comms/ErrorStatus.h"
+
+namespace comms
+{
+
+/// @brief Empty instrumentation hooks, do nothing.
+/// @details Documents the interface expected from the class passed to
+///     the @ref comms::option::app::Instrumentation option. The custom
+///     hooks class may extend this one and override only the required
+///     member functions. The object of the hooks class is default constructed
+///     for every instrumented operation and both "begin" and "end" functions
+///     of such operation are invoked on the same object, which allows
+///     measurement of the elapsed time.
+/// @headerfile comms/EmptyInstrumentation.h
+class EmptyInstrumentation
+{
+public:
+    /// @brief Invoked by the protocol layer at the beginning of the @b read() operation.
+    /// @param[in] layer Protocol layer object.
+    /// @param[in] size Number of bytes available for reading.
+    template <typename TLayer>
+    void layerReadBegin(const TLayer& layer, std::size_t size)
+    {
+        static_cast<void>(layer);
+        static_cast<void>(size);
+    }
+
+    /// @brief Invoked by the protocol layer at the end of the @b read() operation.
+    /// @param[in] layer Protocol layer object.
+    /// @param[in] es Status of the read operation.
+    /// @param[in] consumed Number of bytes consumed by the layer and all the inner ones.
+    template <typename TLayer>
+    void layerReadEnd(const TLayer& layer, comms::ErrorStatus es, std::size_t consumed)
+    {
+        static_cast<void>(layer);
+        static_cast<void>(es);
+        static_cast<void>(consumed);
+    }
+
+    /// @brief Invoked by the protocol layer at the beginning of the @b write() operation.
+    /// @param[in] layer Protocol layer object.
+    /// @param[in] size Max number of bytes that can be written.
+    template <typename TLayer>
+    void layerWriteBegin(const TLayer& layer, std::size_t size)
+    {
+        static_cast<void>(layer);
+        static_cast<void>(size);
+    }
+
+    /// @brief Invoked by the protocol layer at the end of the @b write() operation.
+    /// @param[in] layer Protocol layer object.
+    /// @param[in] es Status of the write operation.
+    /// @param[in] written Number of written bytes, @b 0 when the used
+    ///     output iterator doesn't allow its calculation.
+    template <typename TLayer>
+    void layerWriteEnd(const TLayer& layer, comms::ErrorStatus es, std::size_t written)
+    {
+        static_cast<void>(layer);
+        static_cast<void>(es);
+        static_cast<void>(written);
+    }
+
+    /// @brief Invoked by the @ref comms::protocol::MsgIdLayer before reading
+    ///     the message contents (the rest of the inner layers).
+    /// @param[in] id ID of the message.
+    /// @param[in] size Number of bytes available for reading.
+    template <typename TId>
+    void msgReadBegin(const TId& id, std::size_t size)
+    {
+        static_cast<void>(id);
+        static_cast<void>(size);
+    }
+
+    /// @brief Invoked by the @ref comms::protocol::MsgIdLayer after reading
+    ///     the message contents (the rest of the inner layers).
+    /// @param[in] id ID of the message.
+    /// @param[in] es Status of the read operation.
+    /// @param[in] consumed Number of consumed bytes.
+    template <typename TId>
+    void msgReadEnd(const TId& id, comms::ErrorStatus es, std::size_t consumed)
+    {
+        static_cast<void>(id);
+        static_cast<void>(es);
+        static_cast<void>(consumed);
+    }
+
+    /// @brief Invoked by the @ref comms::MsgFactory before creating the message object.
+    /// @param[in] id ID of the message.
+    /// @param[in] idx Index of the message among the ones with the same ID.
+    template <typename TId>
+    void msgCreateBegin(const TId& id, unsigned idx)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+    }
+
+    /// @brief Invoked by the @ref comms::MsgFactory after creating the message object.
+    /// @param[in] id ID of the message.
+    /// @param[in] idx Index of the message among the ones with the same ID.
+    /// @param[in] created Whether the message object was successfully created.
+    template <typename TId>
+    void msgCreateEnd(const TId& id, unsigned idx, bool created)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        static_cast<void>(created);
+    }
+
+    /// @brief Invoked by the @ref comms::MsgDispatcher before dispatching
+    ///     the message object to its handler.
+    /// @param[in] msg Message object being dispatched.
+    template <typename TMsg>
+    void dispatchBegin(const TMsg& msg)
+    {
+        static_cast<void>(msg);
+    }
+
+    /// @brief Invoked by the @ref comms::MsgDispatcher after dispatching
+    ///     the message object to its handler.
+    /// @param[in] msg Message object being dispatched.
+    template <typename TMsg>
+    void dispatchEnd(const TMsg& msg)
+    {
+        static_cast<void>(msg);
+    }
+};
+
+}  // namespace comms
@@ -66,6 +66,8 @@ namespace comms
 ///         member function to the default interface.
 ///     @li @ref comms::option::app::NameInterface - an option used to add @ref name()
 ///         member function to the default interface.
+///     @li @ref comms::option::app::OrigFrameView - an option used to add storage
+///         of the original frame "view", see @ref origFrameData().
 ///     @li @ref comms::option::app::Handler - an option used to specify type of message handler
 ///         object used to handle the message when it received. If this option
 ///         is not used, then dispatch() member function doesn't exist. See
@@ -179,6 +181,13 @@ public:
         return InterfaceOptions::HasName;
     }
 
+    /// @brief Compile type inquiry whether message interface class defines
+    ///     @ref origFrameData() and other related member functions.
+    static constexpr bool hasOrigFrameView()
+    {
+        return InterfaceOptions::HasOrigFrameView;
+    }
+
 #ifdef FOR_DOXYGEN_DOC_ONLY
     /// @brief Type used for message ID.
     /// @details The type exists only if @ref comms::option::def::MsgIdType option
@@ -292,6 +301,51 @@ public:
     /// @see @ref hasName()
     const char* name() const;
 
+    /// @brief Check whether the original frame "view" has been recorded.
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message. The "view" is recorded by the
+    ///     @b read() operation of the protocol stack and cleared upon
+    ///     access to the message fields using non-const @b fields() member function.
+    /// @see @ref hasOrigFrameView()
+    bool hasOrigFrame() const;
+
+    /// @brief Pointer to the first byte of the original frame.
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message.
+    /// @return @b nullptr if the "view" hasn't been recorded.
+    const std::uint8_t* origFrameData() const;
+
+    /// @brief Length of the original frame.
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message.
+    std::size_t origFrameLength() const;
+
+    /// @brief Check whether the recorded original frame "view" has been
+    ///     dropped because of the access to the message fields.
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message. Any invocation of the non-const
+    ///     @b fields() member function (including the generated field access
+    ///     functions, like @b field_name()) drops the recorded "view" even
+    ///     if the fields are only inspected, for example by the message
+    ///     handler receiving a non-const reference to the message object.
+    ///     This function allows detection of such cases, the fields can
+    ///     be inspected without dropping the "view" using a const reference
+    ///     to the message object. The flag is cleared by @ref setOrigFrame()
+    ///     and @ref clearOrigFrame().
+    bool origFrameInvalidated() const;
+
+    /// @brief Record the original frame "view".
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message.
+    void setOrigFrame(const std::uint8_t* data, std::size_t len);
+
+    /// @brief Clear the original frame "view".
+    /// @details The function exists only if @ref comms::option::app::OrigFrameView option
+    ///     was provided to comms::Message. Needs to be invoked explicitly
+    ///     when the message is modified without usage of non-const @b fields()
+    ///     member function, for example when transport fields are updated.
+    void clearOrigFrame();
+
     /// @brief Type of the message handler object.
     /// @details The type exists only if @ref comms::option::app::Handler option
     ///     was provided to comms::Message to specify one.
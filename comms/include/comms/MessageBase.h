@@ -71,6 +71,8 @@ namespace comms
 ///     @li @ref comms::option::app::NoLengthImpl - Inhibit the implementation of lengthImpl().
 ///     @li @ref comms::option::app::NoValidImpl - Inhibit the implementation of validImpl().
 ///     @li @ref comms::option::app::NoDispatchImpl - Inhibit the implementation of dispatchImpl().
+///     @li @ref comms::option::app::VersionLayouts - Precompute per-version layouts of
+///         the version dependent fields.
 /// @extends Message
 /// @headerfile comms/MessageBase.h
 /// @see @ref toMessageBase()
@@ -92,7 +94,9 @@ public:
 
     /// @brief Get an access to the fields of the message.
     /// @details The function doesn't exist if @ref comms::option::def::FieldsImpl option
-    ///     wasn't provided to comms::MessageBase.
+    ///     wasn't provided to comms::MessageBase. In case the
+    ///     @ref comms::option::app::OrigFrameView option was provided to the
+    ///     interface class, the access invalidates the recorded original frame "view".
     /// @return Reference to the fields of the message.
     AllFields& fields();
 
@@ -337,7 +341,9 @@ public:
     ///     This function will invoke such @b setVersion() member function for every
     ///     field object listed with @ref comms::option::def::FieldsImpl option and will
     ///     return @b true if <b>at least</b> one of the invoked functions returned
-    ///     @b true (similar to @ref doRefresh()).
+    ///     @b true (similar to @ref doRefresh()). When @ref comms::option::app::VersionLayouts
+    ///     option was used, it also selects the precomputed layout relevant to the
+    ///     current version.
     /// @return true when <b>at least</b> one of the fields has been updated.
     bool doFieldsVersionUpdate();
 
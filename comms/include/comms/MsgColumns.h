@@ -0,0 +1,173 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// Provides columnar (structure-of-arrays) storage for batch decoding of
+/// messages of the same type.
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/ErrorStatus.h"
+#include "comms/iterator.h"
+#include "comms/util/Tuple.h"
+#include "comms/protocol/ProtocolLayerBase.h"
+#include "comms/details/MsgColumnsHelper.h"
+
+namespace comms
+{
+
+/// @brief Columnar storage of the fields of multiple messages of the same type.
+/// @details Instead of keeping a separate message object per decoded message
+///     the values of every field are accumulated in a separate column
+///     (@b std::vector). The layout of the columns is generated at compile time
+///     out of the fields listed with @ref comms::option::def::FieldsImpl option.
+///     @li Fixed length numeric fields (@ref comms::field::IntValue,
+///         @ref comms::field::EnumValue, @ref comms::field::FloatValue,
+///         @ref comms::field::BitmaskValue) get a contiguous column of their
+///         @b ValueType, i.e. the raw (not scaled) value.
+///     @li All other fields get a column of @ref comms::MsgColumnSpan, i.e.
+///         offset and length of the serialised field data in the source buffer.
+/// @tparam TMsg Type of the message, must extend @ref comms::MessageBase, be
+///     default constructible, and provide @ref comms::option::def::FieldsImpl option.
+/// @headerfile comms/MsgColumns.h
+template <typename TMsg>
+class MsgColumns
+{
+public:
+    /// @brief Type of the message
+    using Message = TMsg;
+
+    /// @brief All the fields of the message
+    using AllFields = typename TMsg::AllFields;
+
+    /// @brief Tuple of all the columns
+    using Columns = typename details::MsgColumnsTupleHelper<AllFields>::Type;
+
+    /// @brief Type of the column for the field with specified index
+    template <std::size_t TIdx>
+    using ColumnType = typename std::tuple_element<TIdx, Columns>::type;
+
+    /// @brief Check whether the column for the field with specified index
+    ///     stores the values rather than the @ref comms::MsgColumnSpan.
+    template <std::size_t TIdx>
+    static constexpr bool isValueColumn()
+    {
+        return details::MsgColumnIsFixedNumeric<typename std::tuple_element<TIdx, AllFields>::type>::value;
+    }
+
+    /// @brief Number of decoded messages stored in the columns
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @brief Check whether the columns are empty
+    bool empty() const
+    {
+        return m_size == 0U;
+    }
+
+    /// @brief Reserve space in all the columns
+    void reserve(std::size_t count)
+    {
+        comms::util::tupleForEach(m_columns, details::MsgColumnsReserver(count));
+    }
+
+    /// @brief Clear all the columns, reserved capacity is preserved.
+    void clear()
+    {
+        comms::util::tupleForEach(m_columns, details::MsgColumnsClearer());
+        m_size = 0U;
+    }
+
+    /// @brief Access the column for the field with specified index.
+    template <std::size_t TIdx>
+    const ColumnType<TIdx>& column() const
+    {
+        return std::get<TIdx>(m_columns);
+    }
+
+    /// @brief Access all the columns
+    const Columns& columns() const
+    {
+        return m_columns;
+    }
+
+    /// @brief Append values of all the fields of the decoded message.
+    /// @param[in] msg Message object.
+    /// @param[in] payloadOffset Offset of the message payload in the source buffer,
+    ///     used to calculate the offsets reported by the @ref comms::MsgColumnSpan.
+    void append(const TMsg& msg, std::size_t payloadOffset)
+    {
+        comms::util::tupleForEachWithTemplateParamIdx(
+            msg.fields(),
+            details::MsgColumnsAppender<Columns>(m_columns, payloadOffset));
+        ++m_size;
+    }
+
+    /// @brief Decode all the frames of the @ref Message type in the input buffer.
+    /// @details Processes the input the same way as @ref comms::processSingle()
+    ///     but keeps going until the end of the buffer. Every successfully decoded
+    ///     message is appended to the columns, the frames of the other message types
+    ///     or the ones failing to decode are skipped. A single internal message
+    ///     object is reused for decoding.
+    /// @param[in] bufIter Iterator to the beginning of the input buffer. The
+    ///     offsets reported by the @ref comms::MsgColumnSpan are relative to it.
+    /// @param[in] len Number of bytes in the input buffer.
+    /// @param[in] frame Protocol frame / stack used to process the raw input.
+    /// @return Number of consumed bytes. The remaining bytes contain an
+    ///     incomplete frame and need to be prepended to the next input.
+    template <typename TBufIter, typename TFrame>
+    std::size_t readFrames(TBufIter bufIter, std::size_t len, TFrame&& frame)
+    {
+        std::size_t consumed = 0U;
+        while (consumed < len) {
+            auto begIter = comms::readIteratorFor(m_msg, bufIter + consumed);
+            auto iter = begIter;
+            auto payloadIter = begIter;
+            std::size_t payloadLen = 0U;
+
+            auto es =
+                frame.read(
+                    m_msg,
+                    iter,
+                    len - consumed,
+                    comms::protocol::msgPayload(payloadIter, payloadLen));
+
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                break;
+            }
+
+            if (es == comms::ErrorStatus::ProtocolError) {
+                ++consumed;
+                continue;
+            }
+
+            if (es == comms::ErrorStatus::Success) {
+                append(m_msg, consumed + static_cast<std::size_t>(std::distance(begIter, payloadIter)));
+            }
+
+            auto frameLen = static_cast<std::size_t>(std::distance(begIter, iter));
+            consumed += std::max(frameLen, std::size_t(1U));
+        }
+
+        return consumed;
+    }
+
+private:
+    Columns m_columns;
+    std::size_t m_size = 0U;
+    TMsg m_msg;
+};
+
+} // namespace comms
@@ -58,6 +58,8 @@ constexpr bool hasMsgDispatcherTag()
 ///         @ref comms::dispatchMsgStaticBinSearch()
 ///     @li @ref comms::option::ForceDispatchLinearSwitch - Force dispatch using
 ///         @ref comms::dispatchMsgLinearSwitch()
+///     @li @ref comms::option::Instrumentation - Invoke provided instrumentation
+///         hooks before and after the dispatch.
 template <typename... TOptions>
 class MsgDispatcher
 {
@@ -196,6 +198,41 @@ class MsgDispatcher
         return std::is_same<TTag, comms::traits::dispatch::LinearSwitch>::value;
     }
 
+    template <typename TMsg>
+    class HooksScope
+    {
+    public:
+        explicit HooksScope(const TMsg& msg) : m_msg(msg)
+        {
+            m_hooks.dispatchBegin(m_msg);
+        }
+
+        ~HooksScope() noexcept
+        {
+            m_hooks.dispatchEnd(m_msg);
+        }
+
+    private:
+        typename ParsedOptionsInternal::InstrumentationHooks m_hooks;
+        const TMsg& m_msg;
+    };
+
+    class NoHooksScope
+    {
+    public:
+        template <typename TMsg>
+        explicit NoHooksScope(const TMsg&) {}
+    };
+
+    template <typename TMsg>
+    using InstrumentationScope =
+        typename comms::util::Conditional<
+            ParsedOptionsInternal::HasInstrumentation
+        >::template Type<
+            HooksScope<typename std::decay<TMsg>::type>,
+            NoHooksScope
+        >;
+
 public:
     /// @brief Parsed Options
     using ParsedOptions = ParsedOptionsInternal;
@@ -217,6 +254,8 @@ public:
     static auto dispatch(TMsgId&& id, std::size_t idx, TMsg& msg, THandler& handler) ->
         decltype(dispatchInternal<TAllMessages>(std::forward<TMsgId>(id), idx, msg, handler, Tag()))
     {
+        InstrumentationScope<TMsg> scope(msg);
+        static_cast<void>(scope);
         return dispatchInternal<TAllMessages>(std::forward<TMsgId>(id), idx, msg, handler, Tag());
     }
 
@@ -232,6 +271,8 @@ public:
     static auto dispatch(TMsgId&& id, TMsg&& msg, THandler&& handler) ->
         decltype(dispatchInternal<TAllMessages>(std::forward<TMsgId>(id), msg, handler, Tag()))
     {
+        InstrumentationScope<TMsg> scope(msg);
+        static_cast<void>(scope);
         return dispatchInternal<TAllMessages>(std::forward<TMsgId>(id), msg, handler, Tag());
     }
 
@@ -250,6 +291,8 @@ public:
     static auto dispatch(TMsg&& msg, THandler&& handler) ->
         decltype(dispatchInternal<TAllMessages>(msg, handler, Tag()))
     {
+        InstrumentationScope<TMsg> scope(msg);
+        static_cast<void>(scope);
         return dispatchInternal<TAllMessages>(msg, handler, Tag());
     }
 
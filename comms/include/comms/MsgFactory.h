@@ -16,6 +16,8 @@
 #include "comms/Assert.h"
 #include "comms/util/Tuple.h"
 #include "comms/util/alloc.h"
+#include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
 #include "details/MsgFactoryOptionsParser.h"
 #include "details/MsgFactoryBase.h"
 
@@ -75,6 +77,12 @@ namespace comms
 ///         @ref comms::MsgFactory::isDispatchPolymorphic(),
 ///         @ref comms::MsgFactory::isDispatchStaticBinSearch(), and
 ///         @ref comms::MsgFactory::isDispatchLinearSwitch()
+///     @li @ref comms::option::app::Instrumentation - Invoke provided
+///         instrumentation hooks when creating message object
+///         (see @ref comms::MsgFactory::createMsg()).
+///     @li @ref comms::option::app::DefaultInitReadMsg - Skip value-initialisation
+///         of the message objects created for reading
+///         (see @ref comms::MsgFactory::createMsgForRead()).
 /// @pre TMsgBase is a base class for all the messages in TAllMessages.
 /// @pre Message type is TAllMessages must be sorted based on their IDs.
 /// @pre If @ref comms::option::app::InPlaceAllocation option is provided, only one custom
@@ -142,7 +150,27 @@ public:
     ///     yet, the empty (null) pointer will be returned.
     MsgPtr createMsg(MsgIdParamType id, unsigned idx = 0U, CreateFailureReason* reason = nullptr) const
     {
-        return Base::createMsg(id, idx, reason);
+        return createMsgInternal(id, idx, reason, InstrumentationTag());
+    }
+
+    /// @brief Create message object, which is going to be read (decoded)
+    ///     immediately.
+    /// @details Same as @ref createMsg(), but when
+    ///     @ref comms::option::app::DefaultInitReadMsg option is used, the message
+    ///     object is default-initialised instead of value-initialised, i.e.
+    ///     the memory areas not initialised by the constructors (such as
+    ///     storage area of the fields with @ref comms::option::app::FixedSizeStorage)
+    ///     are not zeroed. The default value initialisation of the fields
+    ///     (see @ref comms::option::def::DefaultValueInitialiser) is also
+    ///     skipped. It is performed later by the @b refresh() for the
+    ///     fields that have not been updated by the @b read() operation.
+    /// @param id ID of the message.
+    /// @param idx Relative index (or offset) of the message with the same ID.
+    /// @param[out] reason Failure reason in case creation has failed. May be nullptr.
+    /// @return Smart pointer to @ref Message type.
+    MsgPtr createMsgForRead(MsgIdParamType id, unsigned idx = 0U, CreateFailureReason* reason = nullptr) const
+    {
+        return createMsgForReadInternal(id, idx, reason, InstrumentationTag());
     }
 
     /// @brief Allocate and initialise @ref comms::GenericMessage object.
@@ -212,6 +240,48 @@ public:
         return Base::isDispatchLinearSwitch();
     }
 
+private:
+    template <typename... TParams>
+    using NoInstrumentationTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using HasInstrumentationTag = comms::details::tag::Tag2<>;
+
+    using InstrumentationTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptions::HasInstrumentation
+        >::template Type<
+            HasInstrumentationTag,
+            NoInstrumentationTag
+        >;
+
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, CreateFailureReason* reason, NoInstrumentationTag<>) const
+    {
+        return Base::createMsg(id, idx, reason);
+    }
+
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, CreateFailureReason* reason, HasInstrumentationTag<>) const
+    {
+        typename ParsedOptions::InstrumentationHooks hooks;
+        hooks.msgCreateBegin(id, idx);
+        auto msg = Base::createMsg(id, idx, reason);
+        hooks.msgCreateEnd(id, idx, static_cast<bool>(msg));
+        return msg;
+    }
+
+    MsgPtr createMsgForReadInternal(MsgIdParamType id, unsigned idx, CreateFailureReason* reason, NoInstrumentationTag<>) const
+    {
+        return Base::createMsgForRead(id, idx, reason);
+    }
+
+    MsgPtr createMsgForReadInternal(MsgIdParamType id, unsigned idx, CreateFailureReason* reason, HasInstrumentationTag<>) const
+    {
+        typename ParsedOptions::InstrumentationHooks hooks;
+        hooks.msgCreateBegin(id, idx);
+        auto msg = Base::createMsgForRead(id, idx, reason);
+        hooks.msgCreateEnd(id, idx, static_cast<bool>(msg));
+        return msg;
+    }
 };
 
 
@@ -18,16 +18,20 @@
 #include "comms/dispatch.h"
 #include "comms/field_cast.h"
 #include "comms/iterator.h"
+#include "comms/frame_image.h"
 #include "process.h"
 
 #include "comms/Message.h"
 #include "comms/EmptyHandler.h"
+#include "comms/EmptyInstrumentation.h"
 #include "comms/GenericHandler.h"
 #include "comms/MessageBase.h"
 #include "comms/MsgFactory.h"
 #include "comms/MsgDispatcher.h"
+#include "comms/MsgColumns.h"
 #include "comms/GenericMessage.h"
 
 #include "comms/util/detect.h"
 #include "comms/util/assign.h"
 #include "comms/util/type_traits.h"
+#include "comms/util/ChunkedWriter.h"
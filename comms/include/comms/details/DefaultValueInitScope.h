@@ -0,0 +1,59 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+// Marks construction of the objects which are going to be read (decoded)
+// immediately. The fields constructed while the scope is active
+// defer their default value initialisation until refresh().
+class DefaultValueInitDeferScope
+{
+public:
+    DefaultValueInitDeferScope() : prev_(activeRef())
+    {
+        activeRef() = true;
+    }
+
+    ~DefaultValueInitDeferScope()
+    {
+        activeRef() = prev_;
+    }
+
+    DefaultValueInitDeferScope(const DefaultValueInitDeferScope&) = delete;
+    DefaultValueInitDeferScope& operator=(const DefaultValueInitDeferScope&) = delete;
+
+    static bool active()
+    {
+        return activeRef();
+    }
+
+private:
+    static bool& activeRef()
+    {
+#ifndef COMMS_NOSTDLIB
+        static thread_local bool Active = false;
+#else // #ifndef COMMS_NOSTDLIB
+        // No thread local storage on bare metal, single threaded creation is assumed
+        static bool Active = false;
+#endif // #ifndef COMMS_NOSTDLIB
+        return Active;
+    }
+
+    bool prev_ = false;
+};
+
+} // namespace details
+
+} // namespace comms
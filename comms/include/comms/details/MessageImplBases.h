@@ -12,6 +12,7 @@
 
 #include "comms/util/Tuple.h"
 #include "comms/details/tag.h"
+#include "comms/details/MessageImplVersionLayouts.h"
 #include "comms/field/basic/CommonFuncs.h"
 #include "comms/field/details/FieldOpHelpers.h"
 
@@ -422,6 +423,27 @@ class MessageImplFieldsBase : public TBase, public MessageImplFieldsContainer<TA
 {
     using ContainerBase = MessageImplFieldsContainer<TAllFields>;
 public:
+    using AllFields = typename ContainerBase::AllFields;
+
+    AllFields& fields()
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                TBase::InterfaceOptions::HasOrigFrameView
+            >::template Type<
+                ClearOrigFrameTag,
+                NoOrigFrameTag
+            >;
+
+        invalidateOrigFrameInternal(Tag());
+        return ContainerBase::fields();
+    }
+
+    const AllFields& fields() const
+    {
+        return ContainerBase::fields();
+    }
+
     using ContainerBase::doRead;
     using ContainerBase::doWrite;
     using ContainerBase::doLength;
@@ -461,6 +483,24 @@ protected:
     using ContainerBase::doWriteFromUntil;
     using ContainerBase::doWriteFromUntilAndUpdateLen;
     using ContainerBase::doWriteNoStatusFromUntil;
+
+private:
+    template <typename... TParams>
+    using ClearOrigFrameTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using NoOrigFrameTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    void invalidateOrigFrameInternal(ClearOrigFrameTag<TParams...>)
+    {
+        TBase::invalidateOrigFrame();
+    }
+
+    template <typename... TParams>
+    static void invalidateOrigFrameInternal(NoOrigFrameTag<TParams...>)
+    {
+    }
 };
 
 // ------------------------------------------------------
@@ -505,6 +545,97 @@ protected:
 
 // ------------------------------------------------------
 
+template <typename TBase>
+class MessageImplVersionLayoutsBase : public TBase
+{
+    using BaseImpl = TBase;
+    using Layouts = MessageImplVersionLayouts<typename BaseImpl::AllFields, typename BaseImpl::VersionType>;
+
+public:
+    using VersionType = typename TBase::VersionType;
+
+    bool doFieldsVersionUpdate()
+    {
+        selectLayout();
+        return comms::field::basic::CommonFuncs::setVersionForMembers(BaseImpl::fields(), BaseImpl::version());
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        if (layoutVersion_ != BaseImpl::version()) {
+            selectLayout();
+            Layouts::updateDynamicFields(BaseImpl::fields(), layoutVersion_);
+        }
+
+        return Layouts::read(layoutIdx_, BaseImpl::fields(), iter, len);
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doWrite(TIter& iter, std::size_t len) const
+    {
+        if (layoutVersion_ != BaseImpl::version()) {
+            return BaseImpl::doWrite(iter, len);
+        }
+
+        return Layouts::write(layoutIdx_, BaseImpl::fields(), iter, len);
+    }
+
+    std::size_t doLength() const
+    {
+        if (layoutVersion_ != BaseImpl::version()) {
+            return BaseImpl::doLength();
+        }
+
+        return Layouts::length(layoutIdx_, BaseImpl::fields());
+    }
+
+    bool doRefresh()
+    {
+        bool updated = doFieldsVersionUpdate();
+        return BaseImpl::doRefresh() || updated;
+    }
+
+protected:
+    MessageImplVersionLayoutsBase()
+    {
+        doFieldsVersionUpdate();
+    }
+
+    MessageImplVersionLayoutsBase(const MessageImplVersionLayoutsBase&) = default;
+    MessageImplVersionLayoutsBase(MessageImplVersionLayoutsBase&&) = default;
+    ~MessageImplVersionLayoutsBase() noexcept = default;
+
+    MessageImplVersionLayoutsBase& operator=(const MessageImplVersionLayoutsBase&) = default;
+    MessageImplVersionLayoutsBase& operator=(MessageImplVersionLayoutsBase&&) = default;
+
+private:
+    void selectLayout()
+    {
+        layoutVersion_ = BaseImpl::version();
+        layoutIdx_ = Layouts::layoutIdx(layoutVersion_);
+    }
+
+    VersionType layoutVersion_ = VersionType();
+    std::size_t layoutIdx_ = 0U;
+};
+
+template <bool TLayouts>
+struct MessageImplVersionBaseSelect
+{
+    template <typename TBase>
+    using Type = MessageImplVersionLayoutsBase<TBase>;
+};
+
+template <>
+struct MessageImplVersionBaseSelect<false>
+{
+    template <typename TBase>
+    using Type = MessageImplVersionBase<TBase>;
+};
+
+// ------------------------------------------------------
+
 template <typename TBase, typename TActual = void>
 class MessageImplFieldsReadImplBase : public TBase
 {
@@ -39,6 +39,7 @@ public:
     static constexpr bool HasDoGetId = false;
     static constexpr bool HasNoIdImpl = false;
     static constexpr bool HasName = false;
+    static constexpr bool HasVersionLayouts = false;
 
     using Fields = std::tuple<>;
     using MsgType = void;
@@ -149,7 +150,7 @@ public:
         typename comms::util::LazyShallowDeepConditional<
             TBase::InterfaceOptions::HasVersionInExtraTransportFields
         >::template Type<
-            MessageImplVersionBase,
+            MessageImplVersionBaseSelect<BaseImpl::HasVersionLayouts && HasVersionDependentFields>::template Type,
             comms::util::TypeDeepWrap,
             TBase
         >;
@@ -460,6 +461,26 @@ public:
         >; 
 };
 
+template <typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::app::VersionLayouts,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+    using BaseImpl = MessageImplOptionsParser<TOptions...>;
+public:
+    static constexpr bool HasVersionLayouts = true;
+
+    template <typename TBase>
+    using BuildVersionImpl = 
+        typename comms::util::LazyShallowDeepConditional<
+            TBase::InterfaceOptions::HasVersionInExtraTransportFields
+        >::template Type<
+            MessageImplVersionBaseSelect<BaseImpl::HasVersionDependentFields>::template Type,
+            comms::util::TypeDeepWrap,
+            TBase
+        >;
+};
+
 template <typename... TOptions>
 class MessageImplOptionsParser<
     comms::option::app::EmptyOption,
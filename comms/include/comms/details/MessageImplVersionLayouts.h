@@ -0,0 +1,750 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/ErrorStatus.h"
+#include "comms/field/OptionalMode.h"
+#include "comms/field/tag.h"
+#include "comms/util/Tuple.h"
+#include "comms/details/detect.h"
+#include "comms/details/tag.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename TField, bool THasTag = hasTag<TField>()>
+struct VersionLayoutIsOptional
+{
+    static const bool Value = false;
+};
+
+template <typename TField>
+struct VersionLayoutIsOptional<TField, true>
+{
+    static const bool Value = std::is_same<typename TField::Tag, comms::field::tag::Optional>::value;
+};
+
+// Optional field, existence of which is fully determined by the version range
+template <typename TField, bool TIsOptional = VersionLayoutIsOptional<TField>::Value>
+struct VersionLayoutIsRanged
+{
+    static const bool Value = false;
+};
+
+template <typename TField>
+struct VersionLayoutIsRanged<TField, true>
+{
+    using ParsedOptions = typename TField::ParsedOptions;
+    static const bool Value =
+        ParsedOptions::HasVersionsRange &&
+        (!ParsedOptions::HasCustomVersionUpdate) &&
+        (!ParsedOptions::HasVersionStorage) &&
+        (!ParsedOptions::HasCustomRead) &&
+        (!ParsedOptions::HasCustomWrite) &&
+        (!TField::Field::isVersionDependent());
+};
+
+template <typename TField, typename TVersionType, bool TRanged = VersionLayoutIsRanged<TField>::Value>
+struct VersionLayoutFieldRange
+{
+    static const bool IsRanged = false;
+    static const std::uintmax_t From = 0U;
+    static const std::uintmax_t Until = std::numeric_limits<TVersionType>::max();
+};
+
+template <typename TField, typename TVersionType>
+struct VersionLayoutFieldRange<TField, TVersionType, true>
+{
+    static const std::uintmax_t VersionMax = std::numeric_limits<TVersionType>::max();
+    static const bool IsRanged = true;
+    static const std::uintmax_t From = TField::ParsedOptions::ExistsFromVersion;
+    static const std::uintmax_t Until =
+        (TField::ParsedOptions::ExistsUntilVersion < VersionMax) ?
+            TField::ParsedOptions::ExistsUntilVersion : VersionMax;
+};
+
+template <typename TField, bool TRanged>
+struct VersionLayoutSerField
+{
+    using Type = TField;
+};
+
+template <typename TField>
+struct VersionLayoutSerField<TField, true>
+{
+    using Type = typename TField::Field;
+};
+
+// Properties of the field within the layout starting at TStart version
+template <typename TField, typename TVersionType, std::uintmax_t TStart>
+struct VersionLayoutFieldProps
+{
+    using Range = VersionLayoutFieldRange<TField, TVersionType>;
+    using SerField = typename VersionLayoutSerField<TField, Range::IsRanged>::Type;
+
+    static const bool IsRanged = Range::IsRanged;
+    static const bool IsPresent = (!IsRanged) || ((Range::From <= TStart) && (TStart <= Range::Until));
+    static const bool IsDynamic = (!IsRanged) && TField::isVersionDependent();
+    static const bool IsFixed =
+        (!IsPresent) ||
+        ((!IsDynamic) && (SerField::minLength() == SerField::maxLength()));
+    static const std::size_t Length = IsPresent ? SerField::minLength() : 0U;
+    static const bool HasReadNoStatus = (!IsPresent) || SerField::hasReadNoStatus();
+    static const bool HasWriteNoStatus = (!IsPresent) || SerField::hasWriteNoStatus();
+};
+
+template <typename TFields, typename TVersionType, std::uintmax_t TStart>
+struct VersionLayoutInfo;
+
+template <typename TVersionType, std::uintmax_t TStart>
+struct VersionLayoutInfo<std::tuple<>, TVersionType, TStart>
+{
+    static const bool IsFixed = true;
+    static const std::size_t Length = 0U;
+    static const bool HasReadNoStatus = true;
+    static const bool HasWriteNoStatus = true;
+};
+
+template <typename THead, typename... TTail, typename TVersionType, std::uintmax_t TStart>
+struct VersionLayoutInfo<std::tuple<THead, TTail...>, TVersionType, TStart>
+{
+    using Props = VersionLayoutFieldProps<THead, TVersionType, TStart>;
+    using TailInfo = VersionLayoutInfo<std::tuple<TTail...>, TVersionType, TStart>;
+
+    static const bool IsFixed = Props::IsFixed && TailInfo::IsFixed;
+    static const std::size_t Length = Props::Length + TailInfo::Length;
+    static const bool HasReadNoStatus = Props::HasReadNoStatus && TailInfo::HasReadNoStatus;
+    static const bool HasWriteNoStatus = Props::HasWriteNoStatus && TailInfo::HasWriteNoStatus;
+};
+
+template <bool TRanged, bool TPresent>
+struct VersionLayoutFieldTag
+{
+    using Type = comms::details::tag::Tag1<>; // regular field
+};
+
+template <>
+struct VersionLayoutFieldTag<true, true>
+{
+    using Type = comms::details::tag::Tag2<>; // existing optional field
+};
+
+template <>
+struct VersionLayoutFieldTag<true, false>
+{
+    using Type = comms::details::tag::Tag3<>; // missing optional field
+};
+
+template <typename TField, typename TVersionType, std::uintmax_t TStart>
+using VersionLayoutFieldTagT =
+    typename VersionLayoutFieldTag<
+        VersionLayoutFieldProps<TField, TVersionType, TStart>::IsRanged,
+        VersionLayoutFieldProps<TField, TVersionType, TStart>::IsPresent
+    >::Type;
+
+template <typename TVersionType, std::uintmax_t TStart, typename TIter>
+class VersionLayoutFieldReadHelper
+{
+public:
+    VersionLayoutFieldReadHelper(comms::ErrorStatus& es, TIter& iter, std::size_t& len)
+      : es_(es),
+        iter_(iter),
+        len_(len)
+    {
+    }
+
+    template <typename TField>
+    void operator()(TField& field)
+    {
+        read(field, VersionLayoutFieldTagT<TField, TVersionType, TStart>());
+    }
+
+private:
+    using RegularTag = comms::details::tag::Tag1<>;
+    using ExistingTag = comms::details::tag::Tag2<>;
+    using MissingTag = comms::details::tag::Tag3<>;
+
+    template <typename TField>
+    void read(TField& field, RegularTag)
+    {
+        readInternal(field);
+    }
+
+    template <typename TField>
+    void read(TField& field, ExistingTag)
+    {
+        field.setMode(comms::field::OptionalMode::Exists);
+        readInternal(field.field());
+    }
+
+    template <typename TField>
+    static void read(TField& field, MissingTag)
+    {
+        field.setMode(comms::field::OptionalMode::Missing);
+    }
+
+    template <typename TField>
+    void readInternal(TField& field)
+    {
+        if (es_ != comms::ErrorStatus::Success) {
+            return;
+        }
+
+        auto fromIter = iter_;
+        es_ = field.read(iter_, len_);
+        if (es_ == comms::ErrorStatus::Success) {
+            len_ -= static_cast<std::size_t>(std::distance(fromIter, iter_));
+        }
+    }
+
+    comms::ErrorStatus& es_;
+    TIter& iter_;
+    std::size_t& len_;
+};
+
+template <typename TVersionType, std::uintmax_t TStart, typename TIter>
+class VersionLayoutFieldReadNoStatusHelper
+{
+public:
+    explicit VersionLayoutFieldReadNoStatusHelper(TIter& iter)
+      : iter_(iter)
+    {
+    }
+
+    template <typename TField>
+    void operator()(TField& field)
+    {
+        read(field, VersionLayoutFieldTagT<TField, TVersionType, TStart>());
+    }
+
+private:
+    using RegularTag = comms::details::tag::Tag1<>;
+    using ExistingTag = comms::details::tag::Tag2<>;
+    using MissingTag = comms::details::tag::Tag3<>;
+
+    template <typename TField>
+    void read(TField& field, RegularTag)
+    {
+        field.readNoStatus(iter_);
+    }
+
+    template <typename TField>
+    void read(TField& field, ExistingTag)
+    {
+        field.setMode(comms::field::OptionalMode::Exists);
+        field.field().readNoStatus(iter_);
+    }
+
+    template <typename TField>
+    static void read(TField& field, MissingTag)
+    {
+        field.setMode(comms::field::OptionalMode::Missing);
+    }
+
+    TIter& iter_;
+};
+
+template <typename TVersionType, std::uintmax_t TStart, typename TIter>
+class VersionLayoutFieldWriteHelper
+{
+public:
+    VersionLayoutFieldWriteHelper(comms::ErrorStatus& es, TIter& iter, std::size_t len)
+      : es_(es),
+        iter_(iter),
+        len_(len)
+    {
+    }
+
+    template <typename TField>
+    void operator()(const TField& field)
+    {
+        write(field, VersionLayoutFieldTagT<TField, TVersionType, TStart>());
+    }
+
+private:
+    using RegularTag = comms::details::tag::Tag1<>;
+    using ExistingTag = comms::details::tag::Tag2<>;
+    using MissingTag = comms::details::tag::Tag3<>;
+
+    template <typename TField>
+    void write(const TField& field, RegularTag)
+    {
+        writeInternal(field);
+    }
+
+    template <typename TField>
+    void write(const TField& field, ExistingTag)
+    {
+        writeInternal(field.field());
+    }
+
+    template <typename TField>
+    static void write(const TField&, MissingTag)
+    {
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field)
+    {
+        if (es_ != comms::ErrorStatus::Success) {
+            return;
+        }
+
+        es_ = field.write(iter_, len_);
+        if (es_ == comms::ErrorStatus::Success) {
+            len_ -= field.length();
+        }
+    }
+
+    comms::ErrorStatus& es_;
+    TIter& iter_;
+    std::size_t len_;
+};
+
+template <typename TVersionType, std::uintmax_t TStart, typename TIter>
+class VersionLayoutFieldWriteNoStatusHelper
+{
+public:
+    explicit VersionLayoutFieldWriteNoStatusHelper(TIter& iter)
+      : iter_(iter)
+    {
+    }
+
+    template <typename TField>
+    void operator()(const TField& field)
+    {
+        write(field, VersionLayoutFieldTagT<TField, TVersionType, TStart>());
+    }
+
+private:
+    using RegularTag = comms::details::tag::Tag1<>;
+    using ExistingTag = comms::details::tag::Tag2<>;
+    using MissingTag = comms::details::tag::Tag3<>;
+
+    template <typename TField>
+    void write(const TField& field, RegularTag)
+    {
+        field.writeNoStatus(iter_);
+    }
+
+    template <typename TField>
+    void write(const TField& field, ExistingTag)
+    {
+        field.field().writeNoStatus(iter_);
+    }
+
+    template <typename TField>
+    static void write(const TField&, MissingTag)
+    {
+    }
+
+    TIter& iter_;
+};
+
+template <typename TVersionType, std::uintmax_t TStart>
+class VersionLayoutFieldLengthHelper
+{
+public:
+    template <typename TField>
+    std::size_t operator()(std::size_t sum, const TField& field) const
+    {
+        return sum + length(field, VersionLayoutFieldTagT<TField, TVersionType, TStart>());
+    }
+
+private:
+    using RegularTag = comms::details::tag::Tag1<>;
+    using ExistingTag = comms::details::tag::Tag2<>;
+    using MissingTag = comms::details::tag::Tag3<>;
+
+    template <typename TField>
+    static std::size_t length(const TField& field, RegularTag)
+    {
+        return field.length();
+    }
+
+    template <typename TField>
+    static std::size_t length(const TField& field, ExistingTag)
+    {
+        return field.field().length();
+    }
+
+    template <typename TField>
+    static constexpr std::size_t length(const TField&, MissingTag)
+    {
+        return 0U;
+    }
+};
+
+template <typename TVersionType>
+class VersionLayoutDynamicFieldUpdateHelper
+{
+public:
+    explicit VersionLayoutDynamicFieldUpdateHelper(TVersionType version)
+      : version_(version)
+    {
+    }
+
+    template <typename TField>
+    void operator()(TField& field) const
+    {
+        using Range = VersionLayoutFieldRange<TField, TVersionType>;
+        using Tag =
+            typename std::conditional<
+                (!Range::IsRanged) && TField::isVersionDependent(),
+                DynamicTag,
+                StaticTag
+            >::type;
+        update(field, Tag());
+    }
+
+private:
+    using DynamicTag = comms::details::tag::Tag1<>;
+    using StaticTag = comms::details::tag::Tag2<>;
+
+    template <typename TField>
+    void update(TField& field, DynamicTag) const
+    {
+        field.setVersion(static_cast<typename TField::VersionType>(version_));
+    }
+
+    template <typename TField>
+    static void update(TField&, StaticTag)
+    {
+    }
+
+    TVersionType version_;
+};
+
+// Operations on the fields for the layout starting at TStart version
+template <typename TFields, typename TVersionType, std::uintmax_t TStart>
+class VersionLayoutOps
+{
+    using Info = VersionLayoutInfo<TFields, TVersionType, TStart>;
+
+public:
+    template <typename TIter>
+    static comms::ErrorStatus read(TFields& fields, TIter& iter, std::size_t len)
+    {
+        using Tag =
+            typename std::conditional<
+                Info::IsFixed && Info::HasReadNoStatus,
+                NoStatusTag,
+                UseStatusTag
+            >::type;
+        return readInternal(fields, iter, len, Tag());
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus write(const TFields& fields, TIter& iter, std::size_t len)
+    {
+        using Tag =
+            typename std::conditional<
+                Info::IsFixed && Info::HasWriteNoStatus,
+                NoStatusTag,
+                UseStatusTag
+            >::type;
+        return writeInternal(fields, iter, len, Tag());
+    }
+
+    static std::size_t length(const TFields& fields)
+    {
+        using Tag =
+            typename std::conditional<
+                Info::IsFixed,
+                NoStatusTag,
+                UseStatusTag
+            >::type;
+        return lengthInternal(fields, Tag());
+    }
+
+private:
+    using NoStatusTag = comms::details::tag::Tag1<>;
+    using UseStatusTag = comms::details::tag::Tag2<>;
+
+    template <typename TIter>
+    static comms::ErrorStatus readInternal(TFields& fields, TIter& iter, std::size_t len, UseStatusTag)
+    {
+        auto es = comms::ErrorStatus::Success;
+        comms::util::tupleForEach(fields, VersionLayoutFieldReadHelper<TVersionType, TStart, TIter>(es, iter, len));
+        return es;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus readInternal(TFields& fields, TIter& iter, std::size_t len, NoStatusTag)
+    {
+        if (len < Info::Length) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        comms::util::tupleForEach(fields, VersionLayoutFieldReadNoStatusHelper<TVersionType, TStart, TIter>(iter));
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus writeInternal(const TFields& fields, TIter& iter, std::size_t len, UseStatusTag)
+    {
+        auto es = comms::ErrorStatus::Success;
+        comms::util::tupleForEach(fields, VersionLayoutFieldWriteHelper<TVersionType, TStart, TIter>(es, iter, len));
+        return es;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus writeInternal(const TFields& fields, TIter& iter, std::size_t len, NoStatusTag)
+    {
+        if (len < Info::Length) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        comms::util::tupleForEach(fields, VersionLayoutFieldWriteNoStatusHelper<TVersionType, TStart, TIter>(iter));
+        return comms::ErrorStatus::Success;
+    }
+
+    static std::size_t lengthInternal(const TFields& fields, UseStatusTag)
+    {
+        return comms::util::tupleAccumulate(fields, std::size_t(0U), VersionLayoutFieldLengthHelper<TVersionType, TStart>());
+    }
+
+    static constexpr std::size_t lengthInternal(const TFields&, NoStatusTag)
+    {
+        return Info::Length;
+    }
+};
+
+// Sorted list of unique versions where the layout changes
+template <int TCmp, std::uintmax_t TVal, typename TList>
+struct VersionLayoutInsertPointHelper;
+
+template <std::uintmax_t TVal, typename TList>
+struct VersionLayoutInsertPoint;
+
+template <std::uintmax_t TVal>
+struct VersionLayoutInsertPoint<TVal, std::tuple<> >
+{
+    using Type = std::tuple<std::integral_constant<std::uintmax_t, TVal> >;
+};
+
+template <std::uintmax_t TVal, typename THead, typename... TTail>
+struct VersionLayoutInsertPoint<TVal, std::tuple<THead, TTail...> >
+{
+    using Type =
+        typename VersionLayoutInsertPointHelper<
+            (TVal < THead::value) ? -1 : ((TVal == THead::value) ? 0 : 1),
+            TVal,
+            std::tuple<THead, TTail...>
+        >::Type;
+};
+
+template <std::uintmax_t TVal, typename THead, typename... TTail>
+struct VersionLayoutInsertPointHelper<-1, TVal, std::tuple<THead, TTail...> >
+{
+    using Type = std::tuple<std::integral_constant<std::uintmax_t, TVal>, THead, TTail...>;
+};
+
+template <std::uintmax_t TVal, typename THead, typename... TTail>
+struct VersionLayoutInsertPointHelper<0, TVal, std::tuple<THead, TTail...> >
+{
+    using Type = std::tuple<THead, TTail...>;
+};
+
+template <typename TElem, typename TList>
+struct VersionLayoutPrependPoint;
+
+template <typename TElem, typename... TElems>
+struct VersionLayoutPrependPoint<TElem, std::tuple<TElems...> >
+{
+    using Type = std::tuple<TElem, TElems...>;
+};
+
+template <std::uintmax_t TVal, typename THead, typename... TTail>
+struct VersionLayoutInsertPointHelper<1, TVal, std::tuple<THead, TTail...> >
+{
+    using Type =
+        typename VersionLayoutPrependPoint<
+            THead,
+            typename VersionLayoutInsertPoint<TVal, std::tuple<TTail...> >::Type
+        >::Type;
+};
+
+template <bool TAdd, std::uintmax_t TVal, typename TList>
+struct VersionLayoutAddPoint
+{
+    using Type = typename VersionLayoutInsertPoint<TVal, TList>::Type;
+};
+
+template <std::uintmax_t TVal, typename TList>
+struct VersionLayoutAddPoint<false, TVal, TList>
+{
+    using Type = TList;
+};
+
+template <typename TFields, typename TVersionType>
+struct VersionLayoutPoints;
+
+template <typename TVersionType>
+struct VersionLayoutPoints<std::tuple<>, TVersionType>
+{
+    using Type = std::tuple<>;
+};
+
+template <typename THead, typename... TTail, typename TVersionType>
+struct VersionLayoutPoints<std::tuple<THead, TTail...>, TVersionType>
+{
+    using Range = VersionLayoutFieldRange<THead, TVersionType>;
+    static const std::uintmax_t VersionMax = std::numeric_limits<TVersionType>::max();
+    using TailPoints = typename VersionLayoutPoints<std::tuple<TTail...>, TVersionType>::Type;
+    using WithFrom =
+        typename VersionLayoutAddPoint<
+            Range::IsRanged && (0U < Range::From) && (Range::From <= VersionMax),
+            Range::From,
+            TailPoints
+        >::Type;
+
+    using Type =
+        typename VersionLayoutAddPoint<
+            Range::IsRanged && (Range::Until < VersionMax),
+            Range::Until + 1U,
+            WithFrom
+        >::Type;
+};
+
+template <typename TStarts>
+struct VersionLayoutStarts;
+
+template <typename... TStarts>
+struct VersionLayoutStarts<std::tuple<TStarts...> >
+{
+    static constexpr std::uintmax_t Values[sizeof...(TStarts)] = {TStarts::value...};
+};
+
+template <typename... TStarts>
+constexpr std::uintmax_t VersionLayoutStarts<std::tuple<TStarts...> >::Values[sizeof...(TStarts)];
+
+template <typename TFields, typename TVersionType, typename TStarts, std::size_t TIdx,
+          bool TLast = ((TIdx + 1U) == std::tuple_size<TStarts>::value)>
+class VersionLayoutDispatch
+{
+    using Ops = VersionLayoutOps<TFields, TVersionType, std::tuple_element<TIdx, TStarts>::type::value>;
+    using Next = VersionLayoutDispatch<TFields, TVersionType, TStarts, TIdx + 1U>;
+
+public:
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t idx, TFields& fields, TIter& iter, std::size_t len)
+    {
+        if (idx == TIdx) {
+            return Ops::read(fields, iter, len);
+        }
+
+        return Next::read(idx, fields, iter, len);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus write(std::size_t idx, const TFields& fields, TIter& iter, std::size_t len)
+    {
+        if (idx == TIdx) {
+            return Ops::write(fields, iter, len);
+        }
+
+        return Next::write(idx, fields, iter, len);
+    }
+
+    static std::size_t length(std::size_t idx, const TFields& fields)
+    {
+        if (idx == TIdx) {
+            return Ops::length(fields);
+        }
+
+        return Next::length(idx, fields);
+    }
+};
+
+template <typename TFields, typename TVersionType, typename TStarts, std::size_t TIdx>
+class VersionLayoutDispatch<TFields, TVersionType, TStarts, TIdx, true>
+{
+    using Ops = VersionLayoutOps<TFields, TVersionType, std::tuple_element<TIdx, TStarts>::type::value>;
+
+public:
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t, TFields& fields, TIter& iter, std::size_t len)
+    {
+        return Ops::read(fields, iter, len);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus write(std::size_t, const TFields& fields, TIter& iter, std::size_t len)
+    {
+        return Ops::write(fields, iter, len);
+    }
+
+    static std::size_t length(std::size_t, const TFields& fields)
+    {
+        return Ops::length(fields);
+    }
+};
+
+// All the layouts of the message fields, every layout covers range of versions
+// in which the set of existing fields doesn't change.
+template <typename TFields, typename TVersionType>
+class MessageImplVersionLayouts
+{
+    using Starts =
+        typename VersionLayoutPrependPoint<
+            std::integral_constant<std::uintmax_t, 0U>,
+            typename VersionLayoutPoints<TFields, TVersionType>::Type
+        >::Type;
+
+    using Dispatch = VersionLayoutDispatch<TFields, TVersionType, Starts, 0U>;
+
+public:
+    static const std::size_t Count = std::tuple_size<Starts>::value;
+
+    static std::size_t layoutIdx(TVersionType version)
+    {
+        using StartsValues = VersionLayoutStarts<Starts>;
+        std::size_t idx = 0U;
+        while (((idx + 1U) < Count) && (StartsValues::Values[idx + 1U] <= static_cast<std::uintmax_t>(version))) {
+            ++idx;
+        }
+        return idx;
+    }
+
+    static void updateDynamicFields(TFields& fields, TVersionType version)
+    {
+        comms::util::tupleForEach(fields, VersionLayoutDynamicFieldUpdateHelper<TVersionType>(version));
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t idx, TFields& fields, TIter& iter, std::size_t len)
+    {
+        return Dispatch::read(idx, fields, iter, len);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus write(std::size_t idx, const TFields& fields, TIter& iter, std::size_t len)
+    {
+        return Dispatch::write(idx, fields, iter, len);
+    }
+
+    static std::size_t length(std::size_t idx, const TFields& fields)
+    {
+        return Dispatch::length(idx, fields);
+    }
+};
+
+} // namespace details
+
+} // namespace comms
@@ -9,6 +9,7 @@
 
 #include <tuple>
 #include <cstddef>
+#include <cstdint>
 
 #include "comms/Field.h"
 #include "comms/util/access.h"
@@ -352,6 +353,61 @@ protected:
 
 // ------------------------------------------------------
 
+template <typename TBase>
+class MessageInterfaceOrigFrameViewBase : public TBase
+{
+public:
+    bool hasOrigFrame() const
+    {
+        return origFrameData_ != nullptr;
+    }
+
+    const std::uint8_t* origFrameData() const
+    {
+        return origFrameData_;
+    }
+
+    std::size_t origFrameLength() const
+    {
+        return origFrameLen_;
+    }
+
+    bool origFrameInvalidated() const
+    {
+        return origFrameInvalidated_;
+    }
+
+    void setOrigFrame(const std::uint8_t* data, std::size_t len)
+    {
+        origFrameData_ = data;
+        origFrameLen_ = len;
+        origFrameInvalidated_ = false;
+    }
+
+    void clearOrigFrame()
+    {
+        setOrigFrame(nullptr, 0U);
+    }
+
+protected:
+    ~MessageInterfaceOrigFrameViewBase() noexcept = default;
+
+    void invalidateOrigFrame()
+    {
+        if (hasOrigFrame()) {
+            clearOrigFrame();
+            origFrameInvalidated_ = true;
+        }
+    }
+
+private:
+    const std::uint8_t* origFrameData_ = nullptr;
+    std::size_t origFrameLen_ = 0U;
+    bool origFrameInvalidated_ = false;
+};
+
+// ------------------------------------------------------
+
 template <typename TBase>
 class MessageInterfaceVirtDestructorBase : public TBase
 {
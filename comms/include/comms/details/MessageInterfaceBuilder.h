@@ -72,13 +72,16 @@ class MessageInterfaceBuilder
     using NameBase = 
         typename ParsedOptions::template BuildName<RefreshBase>;     
 
+    using OrigFrameViewBase = 
+        typename ParsedOptions::template BuildOrigFrameView<NameBase>;
+
     using VirtDestructorBase = 
         typename comms::util::LazyShallowDeepConditional<
             MustHaveVirtualDestructor
         >::template Type<
             MessageInterfaceVirtDestructorBase,
             comms::util::TypeDeepWrap,
-            NameBase
+            OrigFrameViewBase
         >;    
 public:
     using Options = ParsedOptions;
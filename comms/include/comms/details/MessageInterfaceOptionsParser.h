@@ -39,6 +39,7 @@ public:
     static constexpr bool HasHandler = false;
     static constexpr bool HasRefresh = false;
     static constexpr bool HasName = false;
+    static constexpr bool HasOrigFrameView = false;
     static constexpr bool HasNoVirtualDestructor = false;
 
     template <typename TBase = MessageInterfaceEmptyBase>
@@ -76,6 +77,9 @@ public:
 
     template <typename TBase>
     using BuildName = TBase;       
+
+    template <typename TBase>
+    using BuildOrigFrameView = TBase;
 };
 
 template <typename T, typename... TOptions>
@@ -203,6 +207,18 @@ public:
     using BuildName = MessageInterfaceNameBase<TBase>;
 };
 
+template <typename... TOptions>
+class MessageInterfaceOptionsParser<
+    comms::option::app::OrigFrameView,
+    TOptions...> : public MessageInterfaceOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasOrigFrameView = true;
+
+    template <typename TBase>
+    using BuildOrigFrameView = MessageInterfaceOrigFrameViewBase<TBase>;
+};
+
 template <typename... TOptions>
 class MessageInterfaceOptionsParser<
     comms::option::app::NoVirtualDestructor,
@@ -0,0 +1,145 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+#include <type_traits>
+
+#include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
+
+namespace comms
+{
+
+/// @brief Location of the serialised field data within the source buffer.
+/// @see @ref comms::MsgColumns
+struct MsgColumnSpan
+{
+    std::size_t m_offset; ///< Offset of the first byte from the beginning of the buffer.
+    std::size_t m_length; ///< Number of bytes.
+};
+
+namespace details
+{
+
+template <typename TField>
+using MsgColumnIsFixedNumeric =
+    std::integral_constant<
+        bool,
+        (std::is_arithmetic<typename TField::ValueType>::value ||
+            std::is_enum<typename TField::ValueType>::value) &&
+        (0U < TField::minLength()) &&
+        (TField::minLength() == TField::maxLength())
+    >;
+
+template <typename TField>
+using MsgFixedColumn = std::vector<typename TField::ValueType>;
+
+template <typename TField>
+using MsgSpanColumn = std::vector<MsgColumnSpan>;
+
+template <typename TField>
+using MsgColumnType =
+    typename comms::util::LazyShallowConditional<
+        MsgColumnIsFixedNumeric<TField>::value
+    >::template Type<
+        MsgFixedColumn,
+        MsgSpanColumn,
+        TField
+    >;
+
+template <typename TFields>
+struct MsgColumnsTupleHelper;
+
+template <typename... TFields>
+struct MsgColumnsTupleHelper<std::tuple<TFields...> >
+{
+    using Type = std::tuple<MsgColumnType<TFields>...>;
+};
+
+template <typename TColumns>
+class MsgColumnsAppender
+{
+public:
+    MsgColumnsAppender(TColumns& columns, std::size_t offset)
+      : m_columns(columns),
+        m_offset(offset)
+    {
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void operator()(const TField& field)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                MsgColumnIsFixedNumeric<TField>::value
+            >::template Type<
+                FixedTag,
+                SpanTag
+            >;
+
+        auto len = field.length();
+        appendInternal(std::get<TIdx>(m_columns), field, len, Tag());
+        m_offset += len;
+    }
+
+private:
+    template <typename... TParams>
+    using FixedTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using SpanTag = comms::details::tag::Tag2<>;
+
+    template <typename TColumn, typename TField, typename... TParams>
+    void appendInternal(TColumn& column, const TField& field, std::size_t len, FixedTag<TParams...>)
+    {
+        static_cast<void>(len);
+        column.push_back(field.value());
+    }
+
+    template <typename TColumn, typename TField, typename... TParams>
+    void appendInternal(TColumn& column, const TField& field, std::size_t len, SpanTag<TParams...>)
+    {
+        static_cast<void>(field);
+        column.push_back(MsgColumnSpan{m_offset, len});
+    }
+
+    TColumns& m_columns;
+    std::size_t m_offset = 0U;
+};
+
+class MsgColumnsReserver
+{
+public:
+    explicit MsgColumnsReserver(std::size_t count) : m_count(count) {}
+
+    template <typename TColumn>
+    void operator()(TColumn& column) const
+    {
+        column.reserve(m_count);
+    }
+
+private:
+    std::size_t m_count = 0U;
+};
+
+class MsgColumnsClearer
+{
+public:
+    template <typename TColumn>
+    void operator()(TColumn& column) const
+    {
+        column.clear();
+    }
+};
+
+} // namespace details
+
+} // namespace comms
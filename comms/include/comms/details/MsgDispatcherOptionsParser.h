@@ -8,6 +8,7 @@
 #pragma once
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -24,6 +25,8 @@ class MsgDispatcherOptionsParser<>
 public:
     static const bool HasForcedDispatch = false;
     using ForcedDispatch = void;
+    static const bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 };
 
 template <typename T, typename... TOptions>
@@ -36,6 +39,15 @@ public:
 };
 
 
+template <typename T, typename... TOptions>
+class MsgDispatcherOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public MsgDispatcherOptionsParser<TOptions...>
+{
+public:
+    static const bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class MsgDispatcherOptionsParser<
     comms::option::app::EmptyOption,
@@ -20,6 +20,7 @@
 #include "comms/dispatch.h"
 #include "comms/details/message_check.h"
 #include "comms/details/tag.h"
+#include "comms/details/DefaultValueInitScope.h"
 
 namespace comms
 {
@@ -131,28 +132,12 @@ public:
 
     MsgPtr createMsg(MsgIdParamType id, unsigned idx, CreateFailureReason* reason) const
     {
-        CreateFailureReason reasonTmp = CreateFailureReason::None;
-        bool result = false;
-        MsgPtr msg = createMsgInternal(id, idx, result, DestructorTag<>());
-        do {
-            if (msg) {
-                COMMS_ASSERT(result);
-                break;
-            }
-
-            if (!result) {
-                reasonTmp = CreateFailureReason::InvalidId;
-                break;
-            }
-
-            reasonTmp = CreateFailureReason::AllocFailure;
-        } while (false);
-        
-        if (reason != nullptr) {
-            *reason = reasonTmp;
-        }        
+        return createMsgWithReason(id, idx, reason, ValueInitTag<>());
+    }
 
-        return msg;
+    MsgPtr createMsgForRead(MsgIdParamType id, unsigned idx, CreateFailureReason* reason) const
+    {
+        return createMsgWithReason(id, idx, reason, ReadInitTag<>());
     }
 
     MsgPtr createGenericMsg(MsgIdParamType id, unsigned idx) const
@@ -258,6 +243,21 @@ private:
     template <typename... TParams>
     using NonVirtualDestructorTag = comms::details::tag::Tag6<>;              
 
+    template <typename... TParams>
+    using ValueInitTag = comms::details::tag::Tag7<>;
+
+    template <typename... TParams>
+    using DefaultInitTag = comms::details::tag::Tag8<>;
+
+    template <typename...>
+    using ReadInitTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptions::HasDefaultInitReadMsg
+        >::template Type<
+            DefaultInitTag,
+            ValueInitTag
+        >;
+
     template <typename...>
     using DispatchTag = 
         typename comms::util::LazyShallowConditional<
@@ -276,6 +276,7 @@ private:
             NonVirtualDestructorTag
         >;
 
+    template <typename TInitTag>
     class CreateHandler
     {
     public:
@@ -289,14 +290,29 @@ private:
         template <typename T>
         void handle()
         {
-            msg_ = a_.template alloc<T>();
+            msg_ = allocInternal<T>(TInitTag());
         }
 
     private:
+        template <typename T, typename... TParams>
+        MsgPtr allocInternal(ValueInitTag<TParams...>)
+        {
+            return a_.template alloc<T>();
+        }
+
+        template <typename T, typename... TParams>
+        MsgPtr allocInternal(DefaultInitTag<TParams...>)
+        {
+            DefaultValueInitDeferScope deferScope;
+            static_cast<void>(deferScope);
+            return a_.template allocDefaultInit<T>();
+        }
+
         Alloc& a_;
         MsgPtr msg_;
     };
 
+    template <typename TInitTag>
     class NonVirtualDestructorCreateHandler
     {
     public:
@@ -315,10 +331,24 @@ private:
         template <typename T>
         void handle()
         {
-            msg_ = a_.template alloc<T>(id_, idx_);
+            msg_ = allocInternal<T>(TInitTag());
         }
 
     private:
+        template <typename T, typename... TParams>
+        MsgPtr allocInternal(ValueInitTag<TParams...>)
+        {
+            return a_.template alloc<T>(id_, idx_);
+        }
+
+        template <typename T, typename... TParams>
+        MsgPtr allocInternal(DefaultInitTag<TParams...>)
+        {
+            DefaultValueInitDeferScope deferScope;
+            static_cast<void>(deferScope);
+            return a_.template allocDefaultInit<T>(id_, idx_);
+        }
+
         MsgIdType id_;
         unsigned idx_ = 0U;
         Alloc& a_;
@@ -415,18 +445,45 @@ private:
         return false;
     }
 
-    template <typename... TParams>
-    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, VirtualDestructorTag<TParams...>) const
+    template <typename TInitTag>
+    MsgPtr createMsgWithReason(MsgIdParamType id, unsigned idx, CreateFailureReason* reason, TInitTag) const
+    {
+        CreateFailureReason reasonTmp = CreateFailureReason::None;
+        bool result = false;
+        MsgPtr msg = createMsgInternal(id, idx, result, TInitTag(), DestructorTag<>());
+        do {
+            if (msg) {
+                COMMS_ASSERT(result);
+                break;
+            }
+
+            if (!result) {
+                reasonTmp = CreateFailureReason::InvalidId;
+                break;
+            }
+
+            reasonTmp = CreateFailureReason::AllocFailure;
+        } while (false);
+        
+        if (reason != nullptr) {
+            *reason = reasonTmp;
+        }        
+
+        return msg;
+    }
+
+    template <typename TInitTag, typename... TParams>
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, TInitTag, VirtualDestructorTag<TParams...>) const
     {
-        CreateHandler handler(alloc_);
+        CreateHandler<TInitTag> handler(alloc_);
         success = dispatchMsgTypeInternal(id, idx, handler, DispatchTag<>());
         return handler.getMsg();
     }
 
-    template <typename... TParams>
-    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, NonVirtualDestructorTag<TParams...>) const
+    template <typename TInitTag, typename... TParams>
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, TInitTag, NonVirtualDestructorTag<TParams...>) const
     {
-        NonVirtualDestructorCreateHandler handler(id, idx, alloc_);
+        NonVirtualDestructorCreateHandler<TInitTag> handler(id, idx, alloc_);
         success = dispatchMsgTypeInternal(id, idx, handler, DispatchTag<>());
         return handler.getMsg();
     }
@@ -10,6 +10,7 @@
 #include <tuple>
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -27,6 +28,9 @@ public:
     static constexpr bool HasInPlaceAllocation = false;
     static constexpr bool HasSupportGenericMessage = false;
     static constexpr bool HasForcedDispatch = false;
+    static constexpr bool HasInstrumentation = false;
+    static constexpr bool HasDefaultInitReadMsg = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 
     using GenericMessage = void;
 
@@ -72,6 +76,23 @@ public:
 };
 
 
+template <typename T, typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
+template <typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::app::DefaultInitReadMsg, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasDefaultInitReadMsg = true;
+};
+
 template <typename... TOptions>
 class MsgFactoryOptionsParser<
     comms::option::app::EmptyOption,
@@ -79,6 +79,27 @@ constexpr bool hasElementType()
     return HasElementType<T>::Value;
 }
 
+template <class T, class R = void>
+struct EnableIfHasTag { using Type = R; };
+
+template <class T, class Enable = void>
+struct HasTag
+{
+    static const bool Value = false;
+};
+
+template <class T>
+struct HasTag<T, typename EnableIfHasTag<typename T::Tag>::Type>
+{
+    static const bool Value = true;
+};
+
+template <class T>
+constexpr bool hasTag()
+{
+    return HasTag<T>::Value;
+}
+
 } // namespace details
 
 } // namespace comms
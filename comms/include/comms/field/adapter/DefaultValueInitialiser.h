@@ -7,7 +7,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <utility>
+
 #include "comms/ErrorStatus.h"
+#include "comms/details/DefaultValueInitScope.h"
 
 namespace comms
 {
@@ -18,7 +22,7 @@ namespace field
 namespace adapter
 {
 
-template <typename TInitialiser, typename TBase>
+template <typename TInitialiser, bool TDeferrable, typename TBase>
 class DefaultValueInitialiser : public TBase
 {
     using BaseImpl = TBase;
@@ -47,6 +51,95 @@ public:
     DefaultValueInitialiser& operator=(DefaultValueInitialiser&&) = default;
 };
 
+// When constructed for being read immediately (see
+// comms::details::DefaultValueInitDeferScope) the initialisation is
+// postponed until the first non-const access to the value or refresh(),
+// unless the successful read() updates the value first.
+template <typename TInitialiser, typename TBase>
+class DefaultValueInitialiser<TInitialiser, true, TBase> : public TBase
+{
+    using BaseImpl = TBase;
+    using Initialiser = TInitialiser;
+public:
+    using ValueType = typename BaseImpl::ValueType;
+
+    DefaultValueInitialiser()
+      : initPending_(comms::details::DefaultValueInitDeferScope::active())
+    {
+        if (!initPending_) {
+            Initialiser()(*this);
+        }
+    }
+
+    explicit DefaultValueInitialiser(const ValueType& val)
+      : BaseImpl(val)
+    {
+    }
+
+    explicit DefaultValueInitialiser(ValueType&& val)
+      : BaseImpl(std::move(val))
+    {
+    }
+
+    DefaultValueInitialiser(const DefaultValueInitialiser&) = default;
+    DefaultValueInitialiser(DefaultValueInitialiser&&) = default;
+    DefaultValueInitialiser& operator=(const DefaultValueInitialiser&) = default;
+    DefaultValueInitialiser& operator=(DefaultValueInitialiser&&) = default;
+
+    const ValueType& value() const
+    {
+        return BaseImpl::value();
+    }
+
+    ValueType& value()
+    {
+        applyPendingInit();
+        return BaseImpl::value();
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus read(TIter& iter, std::size_t len)
+    {
+        auto es = BaseImpl::read(iter, len);
+        if (es == comms::ErrorStatus::Success) {
+            initPending_ = false;
+        }
+        return es;
+    }
+
+    template <typename TIter>
+    void readNoStatus(TIter& iter)
+    {
+        BaseImpl::readNoStatus(iter);
+        initPending_ = false;
+    }
+
+    bool refresh()
+    {
+        bool initialised = applyPendingInit();
+        return BaseImpl::refresh() || initialised;
+    }
+
+    static constexpr bool hasNonDefaultRefresh()
+    {
+        return true;
+    }
+
+private:
+    bool applyPendingInit()
+    {
+        if (!initPending_) {
+            return false;
+        }
+
+        initPending_ = false;
+        Initialiser()(*this);
+        return true;
+    }
+
+    bool initPending_ = false;
+};
+
 }  // namespace adapter
 
 }  // namespace field
@@ -7,7 +7,15 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
 #include "comms/util/Tuple.h"
+#include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
+#include "comms/field/details/MultiRangeValidatorHelpers.h"
 
 namespace comms
 {
@@ -52,11 +60,165 @@ public:
 
     bool valid() const
     {
-        return BaseImpl::valid() &&
-               comms::util::tupleTypeAccumulate<TRanges>(false, Validator(BaseImpl::value()));
+        return BaseImpl::valid() && validInternal(ValidTag());
     }
 
 private:
+    template <typename... TParams>
+    using NoRangesTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using SingleRangeTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using BitsetTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using BinSearchTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using LinearTag = comms::details::tag::Tag5<>;
+
+    template <typename...>
+    struct UnderlyingTypeHelper
+    {
+        template <typename... TParams>
+        using Type = typename std::underlying_type<ValueType>::type;
+    };
+
+    template <typename...>
+    struct SameTypeHelper
+    {
+        template <typename... TParams>
+        using Type = ValueType;
+    };
+
+    using CompareType =
+        typename comms::util::LazyDeepConditional<
+            std::is_enum<ValueType>::value
+        >::template Type<
+            UnderlyingTypeHelper,
+            SameTypeHelper
+        >;
+
+    template <typename...>
+    struct IntegralTagHelper
+    {
+        using Table = comms::field::details::MultiRangeTable<CompareType, TRanges>;
+
+        template <typename...>
+        struct MultiTagHelper
+        {
+            // Use bitset lookup if it doesn't exceed the size of 2 cache lines
+            static const std::uintmax_t MaxBitsetSpan = 1024U;
+
+            template <typename... TParams>
+            using Type =
+                typename comms::util::LazyShallowConditional<
+                    (comms::field::details::MultiRangeBounds<typename Table::Ranges>::Span < MaxBitsetSpan)
+                >::template Type<
+                    BitsetTag,
+                    BinSearchTag
+                >;
+        };
+
+        template <typename...>
+        struct SingleTagHelper
+        {
+            template <typename... TParams>
+            using Type =
+                typename comms::util::LazyShallowConditional<
+                    Table::Count == 0U
+                >::template Type<
+                    NoRangesTag,
+                    SingleRangeTag
+                >;
+        };
+
+        template <typename... TParams>
+        using Type =
+            typename comms::util::LazyDeepConditional<
+                (Table::Count <= 1U)
+            >::template Type<
+                SingleTagHelper,
+                MultiTagHelper
+            >;
+    };
+
+    template <typename...>
+    struct FloatTagHelper
+    {
+        template <typename... TParams>
+        using Type = LinearTag<>;
+    };
+
+    using ValidTag =
+        typename comms::util::LazyDeepConditional<
+            std::is_floating_point<ValueType>::value
+        >::template Type<
+            FloatTagHelper,
+            IntegralTagHelper
+        >;
+
+    using Table = comms::field::details::MultiRangeTable<CompareType, TRanges>;
+
+    template <typename... TParams>
+    static constexpr bool validInternal(NoRangesTag<TParams...>)
+    {
+        return false;
+    }
+
+    template <typename... TParams>
+    bool validInternal(SingleRangeTag<TParams...>) const
+    {
+        using Range = typename std::tuple_element<0, typename Table::Ranges>::type;
+        auto val = static_cast<CompareType>(BaseImpl::value());
+        return (Range::MinType::value <= val) && (val <= Range::MaxType::value);
+    }
+
+    template <typename... TParams>
+    bool validInternal(BitsetTag<TParams...>) const
+    {
+        using Bounds = comms::field::details::MultiRangeBounds<typename Table::Ranges>;
+        using Bitset = comms::field::details::MultiRangeBitset<typename Table::Ranges>;
+        using Words = typename Bitset::Helper;
+
+        auto val = static_cast<CompareType>(BaseImpl::value());
+        if ((val < Bounds::FirstMin) || (Bounds::LastMax < val)) {
+            return false;
+        }
+
+        auto offset =
+            static_cast<std::uintmax_t>(val) - static_cast<std::uintmax_t>(Bounds::FirstMin);
+        return ((Words::Words[offset / 64U] >> (offset % 64U)) & 0x1U) != 0U;
+    }
+
+    template <typename... TParams>
+    bool validInternal(BinSearchTag<TParams...>) const
+    {
+        using Bounds = comms::field::details::MultiRangeBounds<typename Table::Ranges>;
+
+        auto val = static_cast<CompareType>(BaseImpl::value());
+        const CompareType* mins = &Bounds::Mins[0];
+        std::size_t count = Table::Count;
+
+        // Find last range with min value not greater than the checked one
+        while (1U < count) {
+            auto half = count / 2U;
+            mins = (mins[half] <= val) ? (mins + half) : mins;
+            count -= half;
+        }
+
+        auto idx = static_cast<std::size_t>(mins - &Bounds::Mins[0]);
+        return (Bounds::Mins[idx] <= val) && (val <= Bounds::Maxs[idx]);
+    }
+
+    template <typename... TParams>
+    bool validInternal(LinearTag<TParams...>) const
+    {
+        return comms::util::tupleTypeAccumulate<TRanges>(false, Validator(BaseImpl::value()));
+    }
+
     class Validator
     {
     public:
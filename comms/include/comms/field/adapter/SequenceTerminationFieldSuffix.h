@@ -7,10 +7,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
 #include "comms/Assert.h"
 #include "comms/ErrorStatus.h"
 #include "comms/util/type_traits.h"
+#include "comms/details/detect.h"
 #include "comms/details/tag.h"
+#include "comms/field/tag.h"
 
 namespace comms
 {
@@ -21,6 +28,60 @@ namespace field
 namespace adapter
 {
 
+namespace details
+{
+
+template <typename TField, bool TIsIntegral>
+struct SequenceTerminationFieldSuffixIsTermBytes
+{
+    static const bool Value = false;
+};
+
+template <typename TField>
+struct SequenceTerminationFieldSuffixIsTermBytes<TField, true>
+{
+    using ParsedOptions = typename TField::ParsedOptions;
+    static const bool Value =
+        (0U < TField::minLength()) &&
+        (TField::minLength() == TField::maxLength()) &&
+        (!ParsedOptions::HasCustomRead) &&
+        (!ParsedOptions::HasCustomWrite) &&
+        (!ParsedOptions::HasFailOnInvalid) &&
+        (!ParsedOptions::HasIgnoreInvalid);
+};
+
+template <typename TField, bool THasTag>
+struct SequenceTerminationFieldSuffixIsIntegralTerm
+{
+    static const bool Value = false;
+};
+
+template <typename TField>
+struct SequenceTerminationFieldSuffixIsIntegralTerm<TField, true>
+{
+    static const bool Value =
+        std::is_same<typename TField::Tag, comms::field::tag::Int>::value ||
+        std::is_same<typename TField::Tag, comms::field::tag::Enum>::value;
+};
+
+// Fixed length integral terminator fields, which don't customise the read
+// operation, can be detected by comparing the raw bytes with the serialised
+// default value instead of performing field read at every position.
+template <typename TField>
+constexpr bool sequenceTerminationFieldSuffixIsTermBytes()
+{
+    return
+        SequenceTerminationFieldSuffixIsTermBytes<
+            TField,
+            SequenceTerminationFieldSuffixIsIntegralTerm<
+                TField,
+                comms::details::hasTag<TField>()
+            >::Value
+        >::Value;
+}
+
+}  // namespace details
+
 template <typename TTermField, typename TBase>
 class SequenceTerminationFieldSuffix : public TBase
 {
@@ -74,7 +135,7 @@ public:
         static_assert(std::is_base_of<std::random_access_iterator_tag, IterTag>::value,
             "Only random access iterator for reading is supported with comms::option::def::SequenceTerminationFieldSuffix option");
 
-        using ElemTag =
+        using ReadElemTagSelected =
             typename comms::util::LazyShallowConditional<
                 std::is_integral<ElementType>::value && (sizeof(ElementType) == sizeof(std::uint8_t))
             >::template Type<
@@ -82,7 +143,15 @@ public:
                 FieldTag
             >;
 
-        return readInternal(iter, len, ElemTag());
+        using TermTag =
+            typename comms::util::LazyShallowConditional<
+                details::sequenceTerminationFieldSuffixIsTermBytes<TermField>()
+            >::template Type<
+                TermBytesTag,
+                TermFieldTag
+            >;
+
+        return readInternal(iter, len, ReadElemTagSelected(), TermTag());
     }
 
     static constexpr bool hasReadNoStatus()
@@ -121,8 +190,30 @@ private:
     template <typename... TParams>
     using FieldTag = comms::details::tag::Tag2<>;
 
+    template <typename... TParams>
+    using TermFieldTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using TermBytesTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using PointerSearchTag = comms::details::tag::Tag5<>;
+
+    template <typename... TParams>
+    using IterSearchTag = comms::details::tag::Tag6<>;
+
+    template <typename TIter>
+    using SearchTag =
+        typename comms::util::LazyShallowConditional<
+            std::is_pointer<TIter>::value &&
+            (sizeof(typename std::iterator_traits<TIter>::value_type) == sizeof(std::uint8_t))
+        >::template Type<
+            PointerSearchTag,
+            IterSearchTag
+        >;
+
     template <typename TIter, typename... TParams>
-    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, FieldTag<TParams...>)
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, FieldTag<TParams...>, TermFieldTag<TParams...>)
     {
         BaseImpl::clear();
         TermField termField;
@@ -147,7 +238,30 @@ private:
     }
 
     template <typename TIter, typename... TParams>
-    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, RawDataTag<TParams...>)
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, FieldTag<TParams...>, TermBytesTag<TParams...>)
+    {
+        BaseImpl::clear();
+        std::uint8_t termBytes[TermField::maxLength()] = {0};
+        auto termLen = prepareTermBytes(&termBytes[0]);
+        while (true) {
+            if (isTermAt(iter, len, termBytes, termLen, SearchTag<TIter>())) {
+                std::advance(iter, termLen);
+                return comms::ErrorStatus::Success;
+            }
+
+            auto& elem = BaseImpl::createBack();
+            auto es = BaseImpl::readElement(elem, iter, len);
+            if (es != comms::ErrorStatus::Success) {
+                BaseImpl::value().pop_back();
+                return es;
+            }
+        }
+
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, RawDataTag<TParams...>, TermFieldTag<TParams...>)
     {
         TermField termField;
         std::size_t consumed = 0U;
@@ -164,6 +278,21 @@ private:
             ++consumed;
         }
 
+        return readRawDataUntil(iter, len, consumed, termFieldLen);
+    }
+
+    template <typename TIter, typename... TParams>
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t len, RawDataTag<TParams...>, TermBytesTag<TParams...>)
+    {
+        std::uint8_t termBytes[TermField::maxLength()] = {0};
+        auto termLen = prepareTermBytes(&termBytes[0]);
+        auto consumed = findTerm(iter, len, termBytes, termLen, SearchTag<TIter>());
+        return readRawDataUntil(iter, len, consumed, termLen);
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus readRawDataUntil(TIter& iter, std::size_t len, std::size_t consumed, std::size_t termFieldLen)
+    {
         if (len <= consumed) {
             return comms::ErrorStatus::NotEnoughData;
         }
@@ -180,6 +309,80 @@ private:
         return comms::ErrorStatus::Success;
     }
 
+    static std::size_t prepareTermBytes(std::uint8_t* termBytes)
+    {
+        TermField termField;
+        auto* termIter = termBytes;
+        termField.writeNoStatus(termIter);
+        auto termLen = static_cast<std::size_t>(std::distance(termBytes, termIter));
+        COMMS_ASSERT(0U < termLen);
+        COMMS_ASSERT(termLen <= TermField::maxLength());
+        return termLen;
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findTerm(TIter iter, std::size_t len, const std::uint8_t* termBytes, std::size_t termLen, PointerSearchTag<TParams...>)
+    {
+        auto* begin = reinterpret_cast<const std::uint8_t*>(iter);
+        std::size_t pos = 0U;
+        while ((pos + termLen) <= len) {
+            auto* found =
+                static_cast<const std::uint8_t*>(
+                    std::memchr(begin + pos, termBytes[0], (len - termLen) - pos + 1U));
+
+            if (found == nullptr) {
+                break;
+            }
+
+            pos = static_cast<std::size_t>(found - begin);
+            if (std::memcmp(found + 1, termBytes + 1, termLen - 1U) == 0) {
+                return pos;
+            }
+
+            ++pos;
+        }
+
+        return len;
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findTerm(TIter iter, std::size_t len, const std::uint8_t* termBytes, std::size_t termLen, IterSearchTag<TParams...>)
+    {
+        auto end = iter + static_cast<typename std::iterator_traits<TIter>::difference_type>(len);
+        auto found =
+            std::search(
+                iter, end, termBytes, termBytes + termLen,
+                [](typename std::iterator_traits<TIter>::value_type byte, std::uint8_t termByte) -> bool
+                {
+                    return static_cast<std::uint8_t>(byte) == termByte;
+                });
+        return static_cast<std::size_t>(std::distance(iter, found));
+    }
+
+    template <typename TIter, typename... TParams>
+    static bool isTermAt(TIter iter, std::size_t len, const std::uint8_t* termBytes, std::size_t termLen, PointerSearchTag<TParams...>)
+    {
+        return
+            (termLen <= len) &&
+            (std::memcmp(iter, termBytes, termLen) == 0);
+    }
+
+    template <typename TIter, typename... TParams>
+    static bool isTermAt(TIter iter, std::size_t len, const std::uint8_t* termBytes, std::size_t termLen, IterSearchTag<TParams...>)
+    {
+        if (len < termLen) {
+            return false;
+        }
+
+        for (std::size_t idx = 0U; idx < termLen; ++idx) {
+            if (static_cast<std::uint8_t>(*iter) != termBytes[idx]) {
+                return false;
+            }
+            ++iter;
+        }
+
+        return true;
+    }
 };
 
 }  // namespace adapter
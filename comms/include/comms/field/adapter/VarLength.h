@@ -10,6 +10,8 @@
 #include <type_traits>
 #include <algorithm>
 #include <limits>
+#include <iterator>
+#include <cstdint>
 
 #include "comms/Assert.h"
 #include "comms/util/SizeToType.h"
@@ -28,6 +30,36 @@ namespace field
 namespace adapter
 {
 
+namespace details
+{
+
+// Little endian load of the first TSize bytes from random access iterator
+// without advancing it. Unlike the generic reading loop it is expected to
+// be folded by the compiler into a single memory access.
+template <std::size_t TSize>
+struct VarLengthWordLoadHelper
+{
+    template <typename TIter>
+    static std::uint64_t load(const TIter& iter)
+    {
+        return
+            (static_cast<std::uint64_t>(static_cast<std::uint8_t>(iter[TSize - 1U])) << ((TSize - 1U) * std::numeric_limits<std::uint8_t>::digits)) |
+            VarLengthWordLoadHelper<TSize - 1U>::load(iter);
+    }
+};
+
+template <>
+struct VarLengthWordLoadHelper<1U>
+{
+    template <typename TIter>
+    static std::uint64_t load(const TIter& iter)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::uint8_t>(iter[0]));
+    }
+};
+
+} // namespace details
+
 template <std::size_t TMinLen, std::size_t TMaxLen, typename TBase>
 class VarLength : public TBase
 {
@@ -67,7 +99,7 @@ public:
 
     std::size_t length() const
     {
-        return lengthInternal(HasSignTag());
+        return serialisedLength(toSerialised(BaseImpl::value()), HasSignTag());
     }
 
     static constexpr std::size_t minLength()
@@ -93,39 +125,88 @@ public:
     template <typename TIter>
     comms::ErrorStatus read(TIter& iter, std::size_t size)
     {
-        UnsignedSerialisedType val = 0;
-        std::size_t bytesCount = 0;
-        while (true) {
-            if (size == 0) {
-                return comms::ErrorStatus::NotEnoughData;
-            }
-
-            COMMS_ASSERT(bytesCount < MaxLength);
-            auto byte = comms::util::readData<std::uint8_t>(iter, Endian());
-            auto byteValue = static_cast<std::uint8_t>(byte & VarLengthValueBitsMask);
-            addByteToSerialisedValue(
-                byteValue, bytesCount, val, typename BaseImpl::Endian());
-
-            ++bytesCount;
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IterCategory =
+            typename std::iterator_traits<IterType>::iterator_category;
+        static const bool IsRandomAccessIter =
+            std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
+
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                IsRandomAccessIter
+            >::template Type<
+                WordReadTag,
+                ByteReadTag
+            >;
+
+        SerialisedType serValue = 0;
+        auto es = readSerialised(serValue, iter, size, Tag());
+        if (es == comms::ErrorStatus::Success) {
+            BaseImpl::value() = fromSerialised(serValue);
+        }
+        return es;
+    }
 
-            if ((byte & VarLengthContinueBit) == 0) {
-                break;
+    // Decodes sequence of values (used by the lists of plain var-length
+    // integral fields), requires random access iterator. Stops when
+    // either @b count values are decoded or @b len bytes are consumed,
+    // both are updated. Every decoded value is passed to the @b func.
+    template <typename TIter, typename TFunc>
+    static comms::ErrorStatus readBulk(TIter& iter, std::size_t& len, std::size_t& count, TFunc&& func)
+    {
+        // Local copies are not aliased by anything the func may update
+        auto curIter = iter;
+        auto remLen = len;
+        auto remCount = count;
+        auto es = comms::ErrorStatus::Success;
+        while ((0U < remCount) && (0U < remLen)) {
+            if ((MinLength == 1U) && (sizeof(std::uint64_t) <= remLen)) {
+                // Emit all the single byte values at the front of the
+                // loaded word, the first byte with the continuation bit
+                // (if any) starts the multi byte value.
+                auto word = details::VarLengthWordLoadHelper<sizeof(std::uint64_t)>::load(curIter);
+                auto contBits = static_cast<std::uint64_t>(word & WordContinueBitsMask);
+                std::size_t singlesCount = sizeof(std::uint64_t);
+                if (contBits != 0U) {
+                    auto lowContBit = static_cast<std::uint64_t>(contBits & (~contBits + 1U));
+                    singlesCount = 
+                        static_cast<std::size_t>(
+                            (((lowContBit - 1U) & WordLowBitsMask) * WordLowBitsMask) >> WordSumShift) - 1U;
+                }
+
+                auto valsCount = std::min(remCount, singlesCount);
+                for (auto idx = 0U; idx < valsCount; ++idx) {
+                    auto byteValue = 
+                        static_cast<UnsignedSerialisedType>((word >> (idx * BitsInByte)) & VarLengthValueBitsMask);
+                    func(fromSerialised(signExtUnsignedSerialised(byteValue, 1U, HasSignTag())));
+                }
+
+                std::advance(curIter, valsCount);
+                remLen -= valsCount;
+                remCount -= valsCount;
+                if ((remCount == 0U) || (valsCount == sizeof(std::uint64_t))) {
+                    continue;
+                }
             }
 
-            if (MaxLength <= bytesCount) {
-                return ErrorStatus::ProtocolError;
+            SerialisedType serValue = 0;
+            auto fromIter = curIter;
+            es = readSerialised(serValue, curIter, remLen, WordReadTag<>());
+            if (es != comms::ErrorStatus::Success) {
+                break;
             }
 
-            --size;
+            auto diff = static_cast<std::size_t>(std::distance(fromIter, curIter));
+            COMMS_ASSERT(diff <= remLen);
+            remLen -= diff;
+            --remCount;
+            func(fromSerialised(serValue));
         }
 
-        if (bytesCount < minLength()) {
-            return ErrorStatus::ProtocolError;
-        }
-
-        auto adjustedValue = signExtUnsignedSerialised(val, bytesCount, HasSignTag());
-        BaseImpl::value() = BaseImpl::fromSerialised(static_cast<BaseSerialisedType>(adjustedValue));
-        return comms::ErrorStatus::Success;
+        iter = curIter;
+        len = remLen;
+        count = remCount;
+        return es;
     }
 
     static constexpr bool hasReadNoStatus()
@@ -148,15 +229,20 @@ public:
     template <typename TIter>
     comms::ErrorStatus write(TIter& iter, std::size_t size) const
     {
-        if (!canWrite()) {
+        if (!BaseImpl::canWrite()) {
             return ErrorStatus::InvalidMsgData;
         }
 
-        if (size < length()) {
+        auto len = length();
+        if (TMaxLen < len) {
+            return ErrorStatus::InvalidMsgData;
+        }
+
+        if (size < len) {
             return ErrorStatus::BufferOverflow;
         }
 
-        writeNoStatusInternal(toSerialised(BaseImpl::value()), iter, HasSignTag(), Endian());
+        writeNoStatusInternal(toSerialised(BaseImpl::value()), len, iter, HasSignTag(), Endian());
         return ErrorStatus::Success;
     }
 
@@ -168,6 +254,37 @@ public:
     template <typename TIter>
     void writeNoStatus(TIter& iter) const = delete;
 
+    // Encodes single value (used by the lists of plain var-length
+    // integral fields), the @b len is updated.
+    template <typename TIter>
+    static comms::ErrorStatus writeValue(ValueType value, TIter& iter, std::size_t& len)
+    {
+        auto serValue = toSerialised(value);
+        if ((MinLength == 1U) && isSingleByte(serValue, HasSignTag())) {
+            if (len < 1U) {
+                return ErrorStatus::BufferOverflow;
+            }
+
+            auto byte = static_cast<std::uint8_t>(static_cast<UnsignedSerialisedType>(serValue) & VarLengthValueBitsMask);
+            comms::util::writeData(byte, iter, Endian());
+            --len;
+            return ErrorStatus::Success;
+        }
+
+        auto serLen = serialisedLength(serValue, HasSignTag());
+        if (TMaxLen < serLen) {
+            return ErrorStatus::InvalidMsgData;
+        }
+
+        if (len < serLen) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        writeNoStatusInternal(serValue, serLen, iter, HasSignTag(), Endian());
+        len -= serLen;
+        return ErrorStatus::Success;
+    }
+
     bool valid() const
     {
         return BaseImpl::valid() && canWrite();
@@ -188,13 +305,133 @@ private:
             UnsignedTag
         >;
 
+    template <typename... TParams>
+    using WordReadTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using ByteReadTag = comms::details::tag::Tag4<>;
+
     using UnsignedSerialisedType = typename std::make_unsigned<SerialisedType>::type;
 
+    template <typename TIter, typename... TParams>
+    static comms::ErrorStatus readSerialised(SerialisedType& serValue, TIter& iter, std::size_t size, ByteReadTag<TParams...>)
+    {
+        UnsignedSerialisedType val = 0;
+        std::size_t bytesCount = 0;
+        while (true) {
+            if (size == 0) {
+                return comms::ErrorStatus::NotEnoughData;
+            }
+
+            COMMS_ASSERT(bytesCount < MaxLength);
+            auto byte = comms::util::readData<std::uint8_t>(iter, Endian());
+            auto byteValue = static_cast<std::uint8_t>(byte & VarLengthValueBitsMask);
+            addByteToSerialisedValue(
+                byteValue, bytesCount, val, typename BaseImpl::Endian());
+
+            ++bytesCount;
+
+            if ((byte & VarLengthContinueBit) == 0) {
+                break;
+            }
+
+            if (MaxLength <= bytesCount) {
+                return ErrorStatus::ProtocolError;
+            }
+
+            --size;
+        }
+
+        if (bytesCount < minLength()) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        serValue = signExtUnsignedSerialised(val, bytesCount, HasSignTag());
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    static comms::ErrorStatus readSerialised(SerialisedType& serValue, TIter& iter, std::size_t size, WordReadTag<TParams...>)
+    {
+        if (size < MaxLength) {
+            return readSerialised(serValue, iter, size, ByteReadTag<>());
+        }
+
+        // Load all the bytes the value may occupy at once and find the
+        // first one without the continuation bit instead of checking byte by byte.
+        auto word = details::VarLengthWordLoadHelper<MaxLength>::load(iter);
+        auto stopBits = static_cast<std::uint64_t>(~word) & WordStopBitsMask;
+        if (stopBits == 0U) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        auto lowStopBit = static_cast<std::uint64_t>(stopBits & (~stopBits + 1U));
+        auto bytesCount = 
+            static_cast<std::size_t>(
+                (((lowStopBit - 1U) & WordLowBitsMask) * WordLowBitsMask) >> WordSumShift);
+
+        if (bytesCount < minLength()) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        // Wraps around to all ones when the stop bit is the last one.
+        auto valueMask = static_cast<std::uint64_t>((lowStopBit << 1U) - 1U);
+        auto groups = orderGroups(word & valueMask, bytesCount, Endian());
+        auto val = static_cast<UnsignedSerialisedType>(compactGroups(groups));
+        std::advance(iter, bytesCount);
+
+        serValue = signExtUnsignedSerialised(val, bytesCount, HasSignTag());
+        return comms::ErrorStatus::Success;
+    }
+
+    static std::uint64_t orderGroups(std::uint64_t word, std::size_t, comms::traits::endian::Little)
+    {
+        return word;
+    }
+
+    static std::uint64_t orderGroups(std::uint64_t word, std::size_t bytesCount, comms::traits::endian::Big)
+    {
+        // The most significant group is serialised first, reverse
+        word = ((word & 0x00ff00ff00ff00ffULL) << 8U) | ((word >> 8U) & 0x00ff00ff00ff00ffULL);
+        word = ((word & 0x0000ffff0000ffffULL) << 16U) | ((word >> 16U) & 0x0000ffff0000ffffULL);
+        word = (word << 32U) | (word >> 32U);
+        return word >> ((sizeof(std::uint64_t) - bytesCount) * BitsInByte);
+    }
+
+    static std::uint64_t compactGroups(std::uint64_t word)
+    {
+        word &= 0x7f7f7f7f7f7f7f7fULL;
+        word = (word & 0x007f007f007f007fULL) | ((word & 0x7f007f007f007f00ULL) >> 1U);
+        word = (word & 0x00003fff00003fffULL) | ((word & 0x3fff00003fff0000ULL) >> 2U);
+        word = (word & 0x000000000fffffffULL) | ((word & 0x0fffffff00000000ULL) >> 4U);
+        return word;
+    }
+
+    static std::uint64_t spreadGroups(std::uint64_t val)
+    {
+        val = (val & 0x000000000fffffffULL) | ((val & 0x00fffffff0000000ULL) << 4U);
+        val = (val & 0x00003fff00003fffULL) | ((val & 0x0fffc0000fffc000ULL) << 2U);
+        val = (val & 0x007f007f007f007fULL) | ((val & 0x3f803f803f803f80ULL) << 1U);
+        return val;
+    }
+
+    static std::uint64_t continueBitsMask(std::size_t bytesCount, comms::traits::endian::Little)
+    {
+        // All the bytes except the most significant one (written last)
+        return WordContinueBitsMask & ((static_cast<std::uint64_t>(1U) << ((bytesCount - 1U) * BitsInByte)) - 1U);
+    }
+
+    static std::uint64_t continueBitsMask(std::size_t bytesCount, comms::traits::endian::Big)
+    {
+        // All the bytes except the least significant one (written last)
+        return 
+            continueBitsMask(bytesCount, comms::traits::endian::Little()) << BitsInByte;
+    }
+
     template <typename... TParams>
-    std::size_t lengthInternal(UnsignedTag<TParams...>) const
+    static std::size_t serialisedLength(SerialisedType val, UnsignedTag<TParams...>)
     {
-        auto serValue = 
-            static_cast<UnsignedSerialisedType>(toSerialised(BaseImpl::value()));
+        auto serValue = static_cast<UnsignedSerialisedType>(val);
         std::size_t len = 0U;
         while (0 < serValue) {
             serValue = static_cast<decltype(serValue)>(serValue >> VarLengthShift);
@@ -205,20 +442,33 @@ private:
     }
 
     template <typename... TParams>
-    std::size_t lengthInternal(SignedTag<TParams...>) const
+    static std::size_t serialisedLength(SerialisedType serValue, SignedTag<TParams...>)
     {
-        auto serValue = toSerialised(BaseImpl::value());
         if (0 <= serValue) {
             // positive
-            return lengthSignedPositiveInternal();
+            return lengthSignedPositiveInternal(serValue);
         }
 
-        return lengthSignedNegativeInternal();
+        return lengthSignedNegativeInternal(serValue);
     }
 
-    std::size_t lengthSignedNegativeInternal() const
+    template <typename... TParams>
+    static constexpr bool isSingleByte(SerialisedType serValue, UnsignedTag<TParams...>)
+    {
+        return static_cast<UnsignedSerialisedType>(serValue) <= VarLengthValueBitsMask;
+    }
+
+    template <typename... TParams>
+    static constexpr bool isSingleByte(SerialisedType serValue, SignedTag<TParams...>)
+    {
+        // Sign is captured by bit 6 of the single byte
+        return 
+            (static_cast<SerialisedType>(-(SingleByteSignedLimit)) <= serValue) &&
+            (serValue < static_cast<SerialisedType>(SingleByteSignedLimit));
+    }
+
+    static std::size_t lengthSignedNegativeInternal(SerialisedType serValue)
     {
-        auto serValue = toSerialised(BaseImpl::value());
         std::size_t len = 0U;
         std::uint8_t lastByte = 0U;
         while (serValue != static_cast<decltype(serValue)>(-1)) {
@@ -242,9 +492,8 @@ private:
         return std::max(std::size_t(minLength()), len);
     }
 
-    std::size_t lengthSignedPositiveInternal() const
+    static std::size_t lengthSignedPositiveInternal(SerialisedType serValue)
     {
-        auto serValue = toSerialised(BaseImpl::value());
         std::size_t len = 0U;
         std::uint8_t lastByte = 0U;
         while (serValue != static_cast<decltype(serValue)>(0)) {
@@ -267,92 +516,31 @@ private:
     }
 
 
-    template <typename TIter, typename... TParams>
+    template <typename TIter, typename TEndian, typename... TParams>
     static void writeNoStatusInternal(
         SerialisedType val, 
+        std::size_t len,
         TIter& iter, 
         UnsignedTag<TParams...>, 
-        traits::endian::Little) 
+        TEndian endian) 
     {
-        auto unsignedVal = 
-            static_cast<UnsignedSerialisedType>(val);
-        UnsignedSerialisedType unsignedValToWrite = 0U;
-        std::size_t bytesCount = 0;  
-
-        auto isLastByte = 
-            [&unsignedVal, &bytesCount]() -> bool
-            {
-                return 
-                    ((unsignedVal == 0) && (MinLength <= bytesCount)) || 
-                     (MaxLength <= bytesCount);
-            };       
-
-        while (!isLastByte()) {
-            auto byte = static_cast<std::uint8_t>(unsignedVal & VarLengthValueBitsMask);
-            unsignedVal = static_cast<decltype(unsignedVal)>(unsignedVal >> VarLengthShift);
-            ++bytesCount;
-
-            if (!isLastByte()) {
-                byte |= VarLengthContinueBit;
-            }
-
-            comms::cast_assign(unsignedValToWrite) = 
-                unsignedValToWrite | 
-                static_cast<decltype(unsignedValToWrite)>(
-                    static_cast<UnsignedSerialisedType>(byte) << ((bytesCount - 1) * BitsInByte));
-        }           
-
-        auto len = std::max(minLength(), std::min(bytesCount, maxLength()));
-        comms::util::writeData(unsignedValToWrite, len, iter, Endian());
+        COMMS_ASSERT((MinLength <= len) && (len <= MaxLength));
+        auto unsignedVal = static_cast<UnsignedSerialisedType>(val);
+        auto word = 
+            spreadGroups(static_cast<std::uint64_t>(unsignedVal)) | 
+            continueBitsMask(len, endian);
+        comms::util::writeData(static_cast<UnsignedSerialisedType>(word), len, iter, Endian());
     }
 
-    template <typename TIter, typename... TParams>
-    static void writeNoStatusInternal(
-        SerialisedType val, 
-        TIter& iter, 
-        UnsignedTag<TParams...>, 
-        traits::endian::Big) 
-    {
-        auto unsignedVal = 
-            static_cast<UnsignedSerialisedType>(val);
-        UnsignedSerialisedType unsignedValToWrite = 0U;
-        std::size_t bytesCount = 0;  
-
-        auto isLastByte = 
-            [&unsignedVal, &bytesCount]() -> bool
-            {
-                return 
-                    ((unsignedVal == 0) && (MinLength <= bytesCount)) || 
-                     (MaxLength <= bytesCount);
-            };       
-
-        while (!isLastByte()) {
-            auto byte = static_cast<std::uint8_t>(unsignedVal & VarLengthValueBitsMask);
-            unsignedVal = static_cast<decltype(unsignedVal)>(unsignedVal >> VarLengthShift);
-            
-            if (0 < bytesCount) {
-                byte |= VarLengthContinueBit;
-            }
-
-            comms::cast_assign(unsignedValToWrite) = 
-                unsignedValToWrite | 
-                static_cast<decltype(unsignedValToWrite)>(
-                    static_cast<UnsignedSerialisedType>(byte) << (bytesCount * BitsInByte));
-
-            ++bytesCount;
-        }           
-
-        auto len = std::max(minLength(), std::min(bytesCount, maxLength()));
-        comms::util::writeData(unsignedValToWrite, len, iter, Endian());
-    }    
-
     template <typename TIter, typename TEndian, typename... TParams>
     static void writeNoStatusInternal(
         SerialisedType val, 
+        std::size_t len,
         TIter& iter, 
         SignedTag<TParams...>, 
         TEndian endian) 
     {
+        static_cast<void>(len);
         if (static_cast<SerialisedType>(0) <= val) {
             return writePositiveNoStatusInternal(val, iter, endian);
         }
@@ -606,12 +794,19 @@ private:
         static_cast<std::uint8_t>(~(VarLengthValueBitsMask));
     static const std::size_t BitsInByte = 
         std::numeric_limits<std::uint8_t>::digits; 
+    static const int SingleByteSignedLimit = 0x40;
     static const std::size_t SerLengthInBits = 
         BitsInByte * sizeof(SerialisedType);    
     static const auto SignExtMask = 
         static_cast<UnsignedSerialisedType>(
             std::numeric_limits<UnsignedSerialisedType>::max() << (SerLengthInBits - VarLengthShift));
 
+    static const std::uint64_t WordLowBitsMask = 0x0101010101010101ULL;
+    static const std::uint64_t WordContinueBitsMask = WordLowBitsMask * VarLengthContinueBit;
+    static const std::uint64_t WordStopBitsMask = 
+        WordContinueBitsMask >> ((sizeof(std::uint64_t) - MaxLength) * BitsInByte);
+    static const std::size_t WordSumShift = (sizeof(std::uint64_t) - 1U) * BitsInByte;
+
     static_assert(0 < MinLength, "MinLength is expected to be greater than 0");
     static_assert(MinLength <= MaxLength,
         "MinLength is expected to be no greater than MaxLength");
@@ -24,7 +24,10 @@
 #include "comms/details/detect.h"
 #include "comms/details/tag.h"
 #include "comms/field/details/VersionStorage.h"
+#include "comms/field/adapter/VarLength.h"
+#include "comms/field/tag.h"
 #include "CommonFuncs.h"
+#include "IntValue.h"
 
 namespace comms
 {
@@ -86,6 +89,53 @@ using IsArrayListElemVersionDependentBoolType =
         TElem
     >;
 
+// Detects integral value fields with var-length serialisation and
+// without any other option affecting read / write, such fields
+// can be decoded / encoded in bulk.
+template <typename TElem>
+class ArrayListVarLengthIntElemHelper
+{
+protected:
+    template <typename C>
+    static constexpr bool test(
+        typename std::enable_if<std::is_same<typename C::Tag, comms::field::tag::Int>::value, int>::type,
+        typename C::ParsedOptions*)
+    {
+        using ParsedOptions = typename C::ParsedOptions;
+        return
+            ParsedOptions::HasVarLengthLimits &&
+            (!ParsedOptions::HasFixedLengthLimit) &&
+            (!ParsedOptions::HasFixedBitLengthLimit) &&
+            (!ParsedOptions::HasSerOffset) &&
+            (!ParsedOptions::HasVersionsRange) &&
+            (!ParsedOptions::HasAvailableLengthLimit) &&
+            (!ParsedOptions::HasFailOnInvalid) &&
+            (!ParsedOptions::HasIgnoreInvalid) &&
+            (!ParsedOptions::HasEmptySerialization) &&
+            (!ParsedOptions::HasCustomRead) &&
+            (!ParsedOptions::HasCustomWrite);
+    }
+
+    template <typename>
+    static constexpr bool test(...)
+    {
+        return false;
+    }
+
+public:
+    static const bool Value = test<TElem>(0, nullptr);
+};
+
+// Codec of the plain var-length integral field, performing the same
+// serialisation as the field itself.
+template <typename TElem>
+using ArrayListVarLengthIntElemCodec = 
+    comms::field::adapter::VarLength<
+        TElem::ParsedOptions::MinVarLength,
+        TElem::ParsedOptions::MaxVarLength,
+        comms::field::basic::IntValue<typename TElem::FieldBase, typename TElem::ValueType>
+    >;
+
 template <typename TFieldBase, typename TStorage>
 using ArrayListVersionStorageBase = 
     typename comms::util::LazyShallowConditional<
@@ -217,14 +267,12 @@ public:
             typename std::iterator_traits<IterType>::iterator_category;
         static const bool IsRandomAccessIter =
             std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
-        static const bool IsRawData =
-            std::is_integral<ElementType>::value && (sizeof(ElementType) == sizeof(std::uint8_t));
 
         using Tag =
             typename comms::util::LazyShallowConditional<
-                IsRandomAccessIter && IsRawData
+                IsRandomAccessIter
             >::template Type<
-                RawDataTag,
+                RandomAccessReadTag,
                 FieldElemTag
             >;
         return readInternal(iter, len, Tag());
@@ -246,14 +294,12 @@ public:
             typename std::iterator_traits<IterType>::iterator_category;
         static const bool IsRandomAccessIter =
             std::is_base_of<std::random_access_iterator_tag, IterCategory>::value;
-        static const bool IsRawData =
-            std::is_integral<ElementType>::value && (sizeof(ElementType) == sizeof(std::uint8_t));
 
         using Tag =
             typename comms::util::LazyShallowConditional<
-                IsRandomAccessIter && IsRawData
+                IsRandomAccessIter
             >::template Type<
-                RawDataTag,
+                RandomAccessReadTag,
                 FieldElemTag
             >;
 
@@ -307,7 +353,7 @@ public:
     template <typename TIter>
     ErrorStatus write(TIter& iter, std::size_t len) const
     {
-        return CommonFuncs::writeSequence(*this, iter, len);
+        return writeInternal(iter, len, SequenceTag<>());
     }
 
     static constexpr bool hasWriteNoStatus()
@@ -324,7 +370,7 @@ public:
     template <typename TIter>
     ErrorStatus writeN(std::size_t count, TIter& iter, std::size_t& len) const
     {
-        return CommonFuncs::writeSequenceN(*this, count, iter, len);
+        return writeInternalN(count, iter, len, SequenceTag<>());
     }
 
     template <typename TIter>
@@ -370,6 +416,9 @@ private:
     template <typename... TParams>
     using NoVersionDependencyTag = comms::details::tag::Tag7<>;
 
+    template <typename... TParams>
+    using VarLengthIntElemTag = comms::details::tag::Tag8<>;
+
     template <typename... TParams>
     using ElemTag = 
         typename comms::util::Conditional<
@@ -379,6 +428,24 @@ private:
             FieldElemTag<TParams...>
         >;
 
+    template <typename... TParams>
+    using SequenceTag =
+        typename comms::util::LazyShallowConditional<
+            details::ArrayListVarLengthIntElemHelper<ElementType>::Value
+        >::template Type<
+            VarLengthIntElemTag,
+            FieldElemTag
+        >;
+
+    template <typename... TParams>
+    using RandomAccessReadTag =
+        typename comms::util::LazyShallowConditional<
+            std::is_integral<ElementType>::value && (sizeof(ElementType) == sizeof(std::uint8_t))
+        >::template Type<
+            RawDataTag,
+            SequenceTag
+        >;
+
     template <typename... TParams>
     using VersionTag =
         typename comms::util::Conditional<
@@ -682,6 +749,93 @@ private:
         return readInternal(iter, count, RawDataTag<>());
     }
 
+    template <typename TIter, typename... TParams>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, VarLengthIntElemTag<TParams...>)
+    {
+        static_assert(comms::util::detect::hasClearFunc<ValueType>(),
+            "The used storage type for ArrayList must have clear() member function");
+        using Codec = details::ArrayListVarLengthIntElemCodec<ElementType>;
+        value_.clear();
+        auto count = std::numeric_limits<std::size_t>::max();
+        return
+            Codec::readBulk(
+                iter, len, count,
+                [this](typename ElementType::ValueType val)
+                {
+                    createBack().value() = val;
+                });
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readInternalN(std::size_t count, TIter& iter, std::size_t len, VarLengthIntElemTag<TParams...>)
+    {
+        using Codec = details::ArrayListVarLengthIntElemCodec<ElementType>;
+        clear();
+        auto es =
+            Codec::readBulk(
+                iter, len, count,
+                [this](typename ElementType::ValueType val)
+                {
+                    createBack().value() = val;
+                });
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        if (0U < count) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, FieldElemTag<TParams...>) const
+    {
+        return CommonFuncs::writeSequence(*this, iter, len);
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, VarLengthIntElemTag<TParams...>) const
+    {
+        using Codec = details::ArrayListVarLengthIntElemCodec<ElementType>;
+        for (auto& elem : value()) {
+            auto es = Codec::writeValue(elem.value(), iter, len);
+            if (es != ErrorStatus::Success) {
+                return es;
+            }
+        }
+
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, FieldElemTag<TParams...>) const
+    {
+        return CommonFuncs::writeSequenceN(*this, count, iter, len);
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, VarLengthIntElemTag<TParams...>) const
+    {
+        using Codec = details::ArrayListVarLengthIntElemCodec<ElementType>;
+        for (auto& elem : value()) {
+            if (count == 0U) {
+                break;
+            }
+
+            auto es = Codec::writeValue(elem.value(), iter, len);
+            if (es != ErrorStatus::Success) {
+                return es;
+            }
+
+            --count;
+        }
+
+        return ErrorStatus::Success;
+    }
+
     template <typename TIter, typename... TParams>
     void readNoStatusInternalN(std::size_t count, TIter& iter, FieldElemTag<TParams...>)
     {
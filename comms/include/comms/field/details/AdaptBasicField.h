@@ -16,6 +16,20 @@ namespace comms
 namespace field
 {
 
+namespace basic
+{
+
+template <typename TField>
+class Optional;
+
+template <typename TFieldBase, typename TMembers>
+class Bundle;
+
+template <typename TFieldBase, typename TMembers>
+class Variant;
+
+} // namespace basic
+
 namespace details
 {
 
@@ -39,6 +53,32 @@ struct FieldsOptionsCompatibilityCalc
 
 //--
 
+// The default value initialisation of the fields, which read() may leave
+// untouched or whose read() depends on the current value, cannot be deferred.
+template <typename TBasic>
+struct DefaultValueInitDeferrableBasic
+{
+    static const bool Value = true;
+};
+
+template <typename TField>
+struct DefaultValueInitDeferrableBasic<comms::field::basic::Optional<TField> >
+{
+    static const bool Value = false;
+};
+
+template <typename TFieldBase, typename TMembers>
+struct DefaultValueInitDeferrableBasic<comms::field::basic::Bundle<TFieldBase, TMembers> >
+{
+    static const bool Value = false;
+};
+
+template <typename TFieldBase, typename TMembers>
+struct DefaultValueInitDeferrableBasic<comms::field::basic::Variant<TFieldBase, TMembers> >
+{
+    static const bool Value = false;
+};
+
 template <typename TBasic, typename... TOptions>
 class AdaptBasicField
 {
@@ -195,8 +235,17 @@ class AdaptBasicField
      using RemLengthMemberFieldAdapted = 
         typename ParsedOptions::template AdaptRemLengthMemberField<SequenceTerminationFieldSuffixAdapted>;
 
+    static const bool DefaultValueInitDeferrable =
+            DefaultValueInitDeferrableBasic<TBasic>::Value &&
+            (!ParsedOptions::HasVersionsRange) &&
+            (!ParsedOptions::HasContentsRefresher) &&
+            (!ParsedOptions::HasEmptySerialization) &&
+            (!ParsedOptions::HasCustomRead) &&
+            (!ParsedOptions::HasCustomRefresh);
+
     using DefaultValueInitialiserAdapted = 
-        typename ParsedOptions::template AdaptDefaultValueInitialiser<RemLengthMemberFieldAdapted>;
+        typename ParsedOptions::template AdaptDefaultValueInitialiser<
+            RemLengthMemberFieldAdapted, DefaultValueInitDeferrable>;
 
     using MultiRangeValidationAdapted = 
         typename ParsedOptions::template AdaptMultiRangeValidation<DefaultValueInitialiserAdapted>;
@@ -0,0 +1,328 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace comms
+{
+
+namespace field
+{
+
+namespace details
+{
+
+// Single valid range with bounds converted to the type used for comparison
+template <typename T, T TMin, T TMax>
+struct MultiRangeElem
+{
+    using MinType = std::integral_constant<T, TMin>;
+    using MaxType = std::integral_constant<T, TMax>;
+};
+
+template <typename T, typename TRange>
+struct MultiRangeElemConvert
+{
+    static_assert(std::tuple_size<TRange>::value == 2, "Tuple with 2 elements is expected");
+    using MinVal = typename std::tuple_element<0, TRange>::type;
+    using MaxVal = typename std::tuple_element<1, TRange>::type;
+    static_assert(MinVal::value <= MaxVal::value, "Invalid range");
+
+    using Type = MultiRangeElem<T, static_cast<T>(MinVal::value), static_cast<T>(MaxVal::value)>;
+
+    // The conversion may render the range empty, such range never matches
+    static const bool IsValid = (Type::MinType::value <= Type::MaxType::value);
+};
+
+template <typename TElem, typename TList>
+struct MultiRangePrepend;
+
+template <typename TElem, typename... TElems>
+struct MultiRangePrepend<TElem, std::tuple<TElems...> >
+{
+    using Type = std::tuple<TElem, TElems...>;
+};
+
+template <bool TBefore, typename TElem, typename TList>
+struct MultiRangeInsertHelper;
+
+template <typename TElem, typename TList>
+struct MultiRangeInsert;
+
+template <typename TElem>
+struct MultiRangeInsert<TElem, std::tuple<> >
+{
+    using Type = std::tuple<TElem>;
+};
+
+template <typename TElem, typename THead, typename... TTail>
+struct MultiRangeInsert<TElem, std::tuple<THead, TTail...> >
+{
+    using Type =
+        typename MultiRangeInsertHelper<
+            (TElem::MinType::value <= THead::MinType::value),
+            TElem,
+            std::tuple<THead, TTail...>
+        >::Type;
+};
+
+template <typename TElem, typename THead, typename... TTail>
+struct MultiRangeInsertHelper<true, TElem, std::tuple<THead, TTail...> >
+{
+    using Type = std::tuple<TElem, THead, TTail...>;
+};
+
+template <typename TElem, typename THead, typename... TTail>
+struct MultiRangeInsertHelper<false, TElem, std::tuple<THead, TTail...> >
+{
+    using Type =
+        typename MultiRangePrepend<
+            THead,
+            typename MultiRangeInsert<TElem, std::tuple<TTail...> >::Type
+        >::Type;
+};
+
+template <bool TValid, typename TElem, typename TList>
+struct MultiRangeSortInsertHelper
+{
+    using Type = typename MultiRangeInsert<TElem, TList>::Type;
+};
+
+template <typename TElem, typename TList>
+struct MultiRangeSortInsertHelper<false, TElem, TList>
+{
+    using Type = TList;
+};
+
+// Converts the ranges and sorts them by the min value, empty ranges are dropped
+template <typename T, typename TRanges>
+struct MultiRangeSort;
+
+template <typename T>
+struct MultiRangeSort<T, std::tuple<> >
+{
+    using Type = std::tuple<>;
+};
+
+template <typename T, typename THead, typename... TTail>
+struct MultiRangeSort<T, std::tuple<THead, TTail...> >
+{
+    using Converted = MultiRangeElemConvert<T, THead>;
+    using Type =
+        typename MultiRangeSortInsertHelper<
+            Converted::IsValid,
+            typename Converted::Type,
+            typename MultiRangeSort<T, std::tuple<TTail...> >::Type
+        >::Type;
+};
+
+template <typename TFirst, typename TSecond>
+struct MultiRangeCanJoin
+{
+    using ValueType = typename TFirst::MaxType::value_type;
+    static const bool Value =
+        (TSecond::MinType::value <= TFirst::MaxType::value) ||
+        ((TFirst::MaxType::value != std::numeric_limits<ValueType>::max()) &&
+         (TSecond::MinType::value == static_cast<ValueType>(TFirst::MaxType::value + 1)));
+};
+
+template <typename TFirst, typename TSecond>
+struct MultiRangeJoined
+{
+    using ValueType = typename TFirst::MaxType::value_type;
+    using Type =
+        MultiRangeElem<
+            ValueType,
+            TFirst::MinType::value,
+            (TFirst::MaxType::value < TSecond::MaxType::value) ? TSecond::MaxType::value : TFirst::MaxType::value
+        >;
+};
+
+template <bool TJoin, typename TList>
+struct MultiRangeMergeHelper;
+
+// Joins overlapping and adjacent ranges of the sorted list
+template <typename TList>
+struct MultiRangeMerge;
+
+template <>
+struct MultiRangeMerge<std::tuple<> >
+{
+    using Type = std::tuple<>;
+};
+
+template <typename TElem>
+struct MultiRangeMerge<std::tuple<TElem> >
+{
+    using Type = std::tuple<TElem>;
+};
+
+template <typename TFirst, typename TSecond, typename... TTail>
+struct MultiRangeMerge<std::tuple<TFirst, TSecond, TTail...> >
+{
+    using Type =
+        typename MultiRangeMergeHelper<
+            MultiRangeCanJoin<TFirst, TSecond>::Value,
+            std::tuple<TFirst, TSecond, TTail...>
+        >::Type;
+};
+
+template <typename TFirst, typename TSecond, typename... TTail>
+struct MultiRangeMergeHelper<true, std::tuple<TFirst, TSecond, TTail...> >
+{
+    using Type =
+        typename MultiRangeMerge<
+            std::tuple<typename MultiRangeJoined<TFirst, TSecond>::Type, TTail...>
+        >::Type;
+};
+
+template <typename TFirst, typename TSecond, typename... TTail>
+struct MultiRangeMergeHelper<false, std::tuple<TFirst, TSecond, TTail...> >
+{
+    using Type =
+        typename MultiRangePrepend<
+            TFirst,
+            typename MultiRangeMerge<std::tuple<TSecond, TTail...> >::Type
+        >::Type;
+};
+
+template <std::size_t...>
+struct MultiRangeIndices {};
+
+template <std::size_t TCount, std::size_t... TIndices>
+struct MultiRangeMakeIndices
+{
+    using Type = typename MultiRangeMakeIndices<TCount - 1, TCount - 1, TIndices...>::Type;
+};
+
+template <std::size_t... TIndices>
+struct MultiRangeMakeIndices<0U, TIndices...>
+{
+    using Type = MultiRangeIndices<TIndices...>;
+};
+
+constexpr std::uint64_t multiRangeBitsFrom(std::uintmax_t from)
+{
+    return ~((static_cast<std::uint64_t>(1U) << from) - 1U);
+}
+
+constexpr std::uint64_t multiRangeBitsUntil(std::uintmax_t until)
+{
+    return (63U <= until) ?
+        ~static_cast<std::uint64_t>(0U) :
+        ((static_cast<std::uint64_t>(1U) << (until + 1U)) - 1U);
+}
+
+constexpr std::uint64_t multiRangeWordMask(std::uintmax_t lo, std::uintmax_t hi, std::uintmax_t wordBegin)
+{
+    return ((hi < wordBegin) || ((wordBegin + 63U) < lo)) ?
+        static_cast<std::uint64_t>(0U) :
+        (multiRangeBitsFrom((lo < wordBegin) ? 0U : (lo - wordBegin)) &
+         multiRangeBitsUntil(hi - wordBegin));
+}
+
+template <typename TList>
+struct MultiRangeWord;
+
+template <>
+struct MultiRangeWord<std::tuple<> >
+{
+    static constexpr std::uint64_t value(std::uintmax_t, std::uintmax_t)
+    {
+        return static_cast<std::uint64_t>(0U);
+    }
+};
+
+template <typename THead, typename... TTail>
+struct MultiRangeWord<std::tuple<THead, TTail...> >
+{
+    static constexpr std::uint64_t value(std::uintmax_t wordBegin, std::uintmax_t origin)
+    {
+        return
+            multiRangeWordMask(
+                static_cast<std::uintmax_t>(THead::MinType::value) - origin,
+                static_cast<std::uintmax_t>(THead::MaxType::value) - origin,
+                wordBegin) |
+            MultiRangeWord<std::tuple<TTail...> >::value(wordBegin, origin);
+    }
+};
+
+// Sorted and merged ranges with the relevant lookup tables
+template <typename T, typename TRanges>
+struct MultiRangeTable
+{
+    using ValueType = T;
+    using Ranges = typename MultiRangeMerge<typename MultiRangeSort<T, TRanges>::Type>::Type;
+    static const std::size_t Count = std::tuple_size<Ranges>::value;
+};
+
+template <typename TRanges>
+struct MultiRangeBounds;
+
+template <typename THead, typename... TTail>
+struct MultiRangeBounds<std::tuple<THead, TTail...> >
+{
+    using ValueType = typename THead::MinType::value_type;
+    static constexpr ValueType Mins[sizeof...(TTail) + 1U] = {THead::MinType::value, TTail::MinType::value...};
+    static constexpr ValueType Maxs[sizeof...(TTail) + 1U] = {THead::MaxType::value, TTail::MaxType::value...};
+    static const ValueType FirstMin = THead::MinType::value;
+    static const ValueType LastMax =
+        std::tuple_element<sizeof...(TTail), std::tuple<THead, TTail...> >::type::MaxType::value;
+
+    // Number of values between first min and last max (inclusive) minus 1
+    static const std::uintmax_t Span =
+        static_cast<std::uintmax_t>(LastMax) - static_cast<std::uintmax_t>(FirstMin);
+};
+
+template <typename THead, typename... TTail>
+constexpr typename MultiRangeBounds<std::tuple<THead, TTail...> >::ValueType
+MultiRangeBounds<std::tuple<THead, TTail...> >::Mins[sizeof...(TTail) + 1U];
+
+template <typename THead, typename... TTail>
+constexpr typename MultiRangeBounds<std::tuple<THead, TTail...> >::ValueType
+MultiRangeBounds<std::tuple<THead, TTail...> >::Maxs[sizeof...(TTail) + 1U];
+
+template <typename TRanges, typename TIndices>
+struct MultiRangeBitsetHelper;
+
+template <typename TRanges, std::size_t... TIndices>
+struct MultiRangeBitsetHelper<TRanges, MultiRangeIndices<TIndices...> >
+{
+    using Bounds = MultiRangeBounds<TRanges>;
+    static constexpr std::uint64_t Words[sizeof...(TIndices)] = {
+        MultiRangeWord<TRanges>::value(
+            static_cast<std::uintmax_t>(TIndices) * 64U,
+            static_cast<std::uintmax_t>(Bounds::FirstMin))...
+    };
+};
+
+template <typename TRanges, std::size_t... TIndices>
+constexpr std::uint64_t MultiRangeBitsetHelper<TRanges, MultiRangeIndices<TIndices...> >::Words[sizeof...(TIndices)];
+
+template <typename TRanges>
+struct MultiRangeBitset
+{
+    using Bounds = MultiRangeBounds<TRanges>;
+    static const std::size_t WordsCount = static_cast<std::size_t>((Bounds::Span / 64U) + 1U);
+    using Helper =
+        MultiRangeBitsetHelper<
+            TRanges,
+            typename MultiRangeMakeIndices<WordsCount>::Type
+        >;
+};
+
+} // namespace details
+
+} // namespace field
+
+} // namespace comms
@@ -131,7 +131,7 @@ public:
     template <typename TField>
     using AdaptRemLengthMemberField = TField;
 
-    template <typename TField>
+    template <typename TField, bool TDeferrable>
     using AdaptDefaultValueInitialiser = TField;
 
     template <typename TField>
@@ -424,9 +424,9 @@ public:
     static constexpr bool HasDefaultValueInitialiser = true;
     using DefaultValueInitialiser = TInitialiser;
 
-    template <typename TField>
+    template <typename TField, bool TDeferrable>
     using AdaptDefaultValueInitialiser = 
-        comms::field::adapter::DefaultValueInitialiser<DefaultValueInitialiser, TField>;
+        comms::field::adapter::DefaultValueInitialiser<DefaultValueInitialiser, TDeferrable, TField>;
 };
 
 template <typename TValidator, typename... TOptions>
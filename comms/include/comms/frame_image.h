@@ -0,0 +1,445 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+/// @file
+/// Provides auxiliary functions for serialisation of the messages with
+/// fixed length into the pre-built frame images.
+/// @details The @ref comms::makeFrameImage() functions produce the image
+///     at run time using the regular write path of the protocol stack.
+///     The caller is expected to keep the produced image and reuse it for every
+///     send of the same message. When compiled with C++14 (or above) the
+///     @ref comms::constFrameImage() function produces the image of the
+///     default constructed message at compile time.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/options.h"
+#include "comms/protocol/ChecksumLayer.h"
+#include "comms/protocol/ChecksumPrefixLayer.h"
+#include "comms/protocol/MsgDataLayer.h"
+#include "comms/protocol/MsgIdLayer.h"
+#include "comms/protocol/MsgSizeLayer.h"
+#include "comms/protocol/SyncPrefixLayer.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename TFields>
+struct FrameImageTransportLength;
+
+template <typename TDataField>
+struct FrameImageTransportLength<std::tuple<TDataField> >
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename THead, typename TNext, typename... TTail>
+struct FrameImageTransportLength<std::tuple<THead, TNext, TTail...> >
+{
+    static_assert(THead::minLength() == THead::maxLength(),
+        "All the transport fields must have fixed length");
+
+    static const std::size_t Value =
+        THead::minLength() + FrameImageTransportLength<std::tuple<TNext, TTail...> >::Value;
+};
+
+} // namespace details
+
+/// @brief Compile time evaluation of the full frame length (including all the
+///     transport information) of the message with fixed length.
+/// @tparam TStack Protocol stack (top layer) type.
+/// @tparam TMsg Actual message type (extending @ref comms::MessageBase),
+///     all its fields as well as all the transport fields are expected to
+///     have fixed serialisation length.
+template <typename TStack, typename TMsg>
+constexpr std::size_t frameImageLength()
+{
+    static_assert(TMsg::doMinLength() == TMsg::doMaxLength(),
+        "The message must have fixed length");
+    return details::FrameImageTransportLength<typename TStack::AllFields>::Value + TMsg::doMaxLength();
+}
+
+/// @brief Type of the frame image of the message with fixed length.
+/// @tparam TStack Protocol stack (top layer) type.
+/// @tparam TMsg Actual message type (extending @ref comms::MessageBase).
+template <typename TStack, typename TMsg>
+using FrameImage = std::array<std::uint8_t, frameImageLength<TStack, TMsg>()>;
+
+/// @brief Serialise the message together with all the transport information
+///     into the frame image.
+/// @details The whole frame is written at run time using the provided
+///     protocol stack, including the transport fields which values are
+///     calculated (such as remaining size or checksum). The produced image
+///     can be stored by the caller and sent multiple times (using plain copy)
+///     without repeating the serialisation, as long as the message contents
+///     don't change.
+/// @tparam TStack Protocol stack (top layer) type.
+/// @tparam TMsg Actual message type (extending @ref comms::MessageBase).
+/// @param[in] stack Protocol stack object.
+/// @param[in] msg Message object.
+/// @return Frame image.
+template <typename TStack, typename TMsg>
+FrameImage<TStack, TMsg> makeFrameImage(const TStack& stack, const TMsg& msg)
+{
+    FrameImage<TStack, TMsg> image{};
+    auto* iter = image.data();
+    auto es = stack.write(msg, iter, image.size());
+    if (es == comms::ErrorStatus::UpdateRequired) {
+        auto* updateIter = image.data();
+        es = stack.update(updateIter, image.size());
+    }
+
+    static_cast<void>(es);
+    COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    COMMS_ASSERT(iter == (image.data() + image.size()));
+    return image;
+}
+
+/// @brief Serialise the message together with all the transport information
+///     into the frame image.
+/// @details Same as other @ref makeFrameImage(), but uses default constructed
+///     protocol stack object.
+template <typename TStack, typename TMsg>
+FrameImage<TStack, TMsg> makeFrameImage(const TMsg& msg)
+{
+    return makeFrameImage(TStack(), msg);
+}
+
+#if COMMS_IS_CPP14
+
+namespace details
+{
+
+template <typename T, bool TIsEnum = std::is_enum<T>::value>
+struct FrameImageIntegralType
+{
+    using Type = T;
+};
+
+template <typename T>
+struct FrameImageIntegralType<T, true>
+{
+    using Type = typename std::underlying_type<T>::type;
+};
+
+template <typename TInitialiser>
+struct FrameImageInitValue
+{
+    static_assert(sizeof(TInitialiser) == 0U,
+        "Only comms::option::def::DefaultNumValue (or comms::option::def::DefaultBigUnsignedNumValue) "
+        "default value initialisation is supported");
+};
+
+template <typename T, T TVal>
+struct FrameImageInitValue<comms::option::details::DefaultNumValueInitialiser<T, TVal> >
+{
+    template <typename TValueType>
+    static constexpr TValueType value()
+    {
+        return static_cast<TValueType>(TVal);
+    }
+};
+
+template <typename TOptions, bool THasInitialiser = TOptions::HasDefaultValueInitialiser>
+struct FrameImageDefaultValue
+{
+    template <typename TValueType>
+    static constexpr TValueType value()
+    {
+        return TValueType();
+    }
+};
+
+template <typename TOptions>
+struct FrameImageDefaultValue<TOptions, true> :
+    public FrameImageInitValue<typename TOptions::DefaultValueInitialiser>
+{
+};
+
+template <typename TOptions, bool THasSerOffset = TOptions::HasSerOffset>
+struct FrameImageSerOffset
+{
+    static const std::uintmax_t Value = 0U;
+};
+
+template <typename TOptions>
+struct FrameImageSerOffset<TOptions, true>
+{
+    static const std::uintmax_t Value = static_cast<std::uintmax_t>(TOptions::SerOffset);
+};
+
+template <typename TField>
+class FrameImageField
+{
+    using ParsedOptions = typename TField::ParsedOptions;
+    using ValueType = typename TField::ValueType;
+    using IntegralType = typename FrameImageIntegralType<ValueType>::Type;
+    using Endian = typename TField::Endian;
+
+    static_assert(std::is_integral<IntegralType>::value,
+        "Only integral fields (IntValue, EnumValue, BitmaskValue) are supported");
+    static_assert(TField::minLength() == TField::maxLength(),
+        "All the fields must have fixed length");
+    static_assert(!ParsedOptions::HasVarLengthLimits,
+        "Fields with variable length are not supported");
+    static_assert(!ParsedOptions::HasFixedBitLengthLimit,
+        "Fields with fixed bit length are not supported");
+    static_assert(!ParsedOptions::HasCustomWrite,
+        "Fields with custom write are not supported");
+
+public:
+    static const std::size_t Length = TField::maxLength();
+
+    static constexpr ValueType defaultValue()
+    {
+        return FrameImageDefaultValue<ParsedOptions>::template value<ValueType>();
+    }
+
+    static constexpr void write(std::uint8_t* buf, ValueType value)
+    {
+        auto serValue =
+            static_cast<std::uintmax_t>(
+                static_cast<std::uintmax_t>(static_cast<IntegralType>(value)) +
+                    FrameImageSerOffset<ParsedOptions>::Value);
+
+        for (std::size_t idx = 0U; idx < Length; ++idx) {
+            auto byte = static_cast<std::uint8_t>(serValue >> (idx * 8U));
+            buf[byteIdx(idx, Endian())] = byte;
+        }
+    }
+
+private:
+    static constexpr std::size_t byteIdx(std::size_t idx, comms::traits::endian::Big)
+    {
+        return (Length - 1U) - idx;
+    }
+
+    static constexpr std::size_t byteIdx(std::size_t idx, comms::traits::endian::Little)
+    {
+        return idx;
+    }
+};
+
+template <typename TFields>
+struct FrameImageMsgFieldsWriter;
+
+template <>
+struct FrameImageMsgFieldsWriter<std::tuple<> >
+{
+    static constexpr void write(std::uint8_t*)
+    {
+    }
+};
+
+template <typename TField, typename... TFields>
+struct FrameImageMsgFieldsWriter<std::tuple<TField, TFields...> >
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        Field::write(buf, Field::defaultValue());
+        FrameImageMsgFieldsWriter<std::tuple<TFields...> >::write(buf + Field::Length);
+    }
+};
+
+// The layers are recognised by their base class, which allows usage of
+// the protocol stack classes extending the standard layers.
+template <typename TField, typename TNextLayer, typename... TOptions>
+comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>
+frameImageLayerBase(const comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TNextLayer, typename... TOptions>
+comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>
+frameImageLayerBase(const comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TMessage, typename TAllMessages, typename TNextLayer, typename... TOptions>
+comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>
+frameImageLayerBase(const comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TCalc, typename TNextLayer, typename... TOptions>
+comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>
+frameImageLayerBase(const comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TCalc, typename TNextLayer, typename... TOptions>
+comms::protocol::ChecksumPrefixLayer<TField, TCalc, TNextLayer, TOptions...>
+frameImageLayerBase(const comms::protocol::ChecksumPrefixLayer<TField, TCalc, TNextLayer, TOptions...>*);
+
+template <typename... TOptions>
+comms::protocol::MsgDataLayer<TOptions...>
+frameImageLayerBase(const comms::protocol::MsgDataLayer<TOptions...>*);
+
+template <typename TLayer, typename TMsg>
+struct FrameImageLayerWriter
+{
+    static_assert(sizeof(TLayer) == 0U,
+        "Only SyncPrefixLayer, MsgSizeLayer, MsgIdLayer, ChecksumLayer, "
+        "ChecksumPrefixLayer and MsgDataLayer are supported");
+};
+
+template <typename TLayer, typename TMsg>
+using FrameImageWriter =
+    FrameImageLayerWriter<decltype(frameImageLayerBase(static_cast<const TLayer*>(nullptr))), TMsg>;
+
+template <typename TLayer, typename TMsg>
+constexpr std::size_t frameImageLayerLength()
+{
+    return FrameImageTransportLength<typename TLayer::AllFields>::Value + TMsg::doMaxLength();
+}
+
+template <typename TField, typename TNextLayer, typename TMsg, typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        Field::write(buf, Field::defaultValue());
+        FrameImageWriter<TNextLayer, TMsg>::write(buf + Field::Length);
+    }
+};
+
+template <typename TField, typename TNextLayer, typename TMsg, typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        using ValueType = typename TField::ValueType;
+        Field::write(buf, static_cast<ValueType>(frameImageLayerLength<TNextLayer, TMsg>()));
+        FrameImageWriter<TNextLayer, TMsg>::write(buf + Field::Length);
+    }
+};
+
+template <
+    typename TField,
+    typename TMessage,
+    typename TAllMessages,
+    typename TNextLayer,
+    typename TMsg,
+    typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        using ValueType = typename TField::ValueType;
+        Field::write(buf, static_cast<ValueType>(TMsg::doGetId()));
+        FrameImageWriter<TNextLayer, TMsg>::write(buf + Field::Length);
+    }
+};
+
+template <typename TField, typename TCalc, typename TNextLayer, typename TMsg, typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        using ValueType = typename TField::ValueType;
+        const auto len = frameImageLayerLength<TNextLayer, TMsg>();
+        FrameImageWriter<TNextLayer, TMsg>::write(buf);
+        Field::write(buf + len, static_cast<ValueType>(TCalc::constexprCalc(buf, len)));
+    }
+};
+
+template <typename TField, typename TCalc, typename TNextLayer, typename TMsg, typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::ChecksumPrefixLayer<TField, TCalc, TNextLayer, TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        using Field = FrameImageField<TField>;
+        using ValueType = typename TField::ValueType;
+        const auto len = frameImageLayerLength<TNextLayer, TMsg>();
+        FrameImageWriter<TNextLayer, TMsg>::write(buf + Field::Length);
+        Field::write(buf, static_cast<ValueType>(TCalc::constexprCalc(buf + Field::Length, len)));
+    }
+};
+
+template <typename TMsg, typename... TOptions>
+struct FrameImageLayerWriter<comms::protocol::MsgDataLayer<TOptions...>, TMsg>
+{
+    static constexpr void write(std::uint8_t* buf)
+    {
+        FrameImageMsgFieldsWriter<typename TMsg::AllFields>::write(buf);
+    }
+};
+
+template <std::size_t TSize>
+struct FrameImageBuf
+{
+    std::uint8_t data_[TSize];
+};
+
+template <typename TStack, typename TMsg>
+constexpr FrameImageBuf<frameImageLength<TStack, TMsg>()> frameImageBuild()
+{
+    FrameImageBuf<frameImageLength<TStack, TMsg>()> buf{};
+    FrameImageWriter<TStack, TMsg>::write(&buf.data_[0]);
+    return buf;
+}
+
+template <typename TStack, typename TMsg, std::size_t... TIdx>
+constexpr FrameImage<TStack, TMsg> frameImageFromBuf(
+    const FrameImageBuf<sizeof...(TIdx)>& buf,
+    std::index_sequence<TIdx...>)
+{
+    return FrameImage<TStack, TMsg>{{buf.data_[TIdx]...}};
+}
+
+} // namespace details
+
+/// @brief Compile time serialisation of the default constructed message
+///     together with all the transport information into the frame image.
+/// @details Intended to be used for the messages which contents never change,
+///     such as heartbeats or acknowledgements, the produced image is the same
+///     as the one produced by the @ref makeFrameImage() for the default
+///     constructed message object and can be sent by plain copy without any
+///     run-time processing:
+///     @code
+///     static constexpr auto HeartbeatImage = comms::constFrameImage<MyStack, MyHeartbeat>();
+///     @endcode
+///     Available only for C++14 and above. The following limitations apply:
+///     @li The message (@b TMsg) must have static numeric ID
+///         (see @ref comms::option::def::StaticNumIdImpl).
+///     @li All the fields of the message as well as all the transport fields
+///         must be integral ones (@ref comms::field::IntValue, @ref comms::field::EnumValue
+///         or @ref comms::field::BitmaskValue) with fixed length. Their default values
+///         may be set only using the @ref comms::option::def::DefaultNumValue
+///         (or @ref comms::option::def::DefaultBigUnsignedNumValue) option.
+///     @li The protocol stack may contain only @ref comms::protocol::SyncPrefixLayer,
+///         @ref comms::protocol::MsgSizeLayer, @ref comms::protocol::MsgIdLayer,
+///         @ref comms::protocol::ChecksumLayer, @ref comms::protocol::ChecksumPrefixLayer
+///         and @ref comms::protocol::MsgDataLayer layers (or classes extending them).
+///         The customisations provided by the extending classes are not applied.
+///     @li The checksum calculator must provide static constexpr @b constexprCalc()
+///         function (see @ref comms::protocol::checksum::BasicSum::constexprCalc()).
+/// @tparam TStack Protocol stack (top layer) type.
+/// @tparam TMsg Actual message type (extending @ref comms::MessageBase).
+/// @return Frame image.
+template <typename TStack, typename TMsg>
+constexpr FrameImage<TStack, TMsg> constFrameImage()
+{
+    return
+        details::frameImageFromBuf<TStack, TMsg>(
+            details::frameImageBuild<TStack, TMsg>(),
+            std::make_index_sequence<frameImageLength<TStack, TMsg>()>());
+}
+
+#endif // #if COMMS_IS_CPP14
+
+} // namespace comms
@@ -322,6 +322,14 @@ struct FixedBitLength {};
 ///             comms::option::VarLength<1, 4>
 ///         >;
 ///         @endcode
+///     When the field is read using random-access iterator and at least
+///     @b TMax bytes are available, all the bytes the value may occupy are
+///     loaded at once and decoded without a per-byte loop. Otherwise the
+///     value is decoded byte by byte. Note that there is no dedicated bulk
+///     decoding / encoding of the whole list of such fields
+///     (see @ref comms::field::ArrayList), every element is still read and
+///     written on its own (benefiting from the described single value
+///     decoding).
 /// @tparam TMin Minimal length the field may consume.
 /// @tparam TMax Maximal length the field may consume.
 /// @pre TMin <= TMax
@@ -1325,6 +1333,22 @@ struct RefreshInterface {};
 /// @headerfile comms/options.h
 struct NameInterface {};
 
+/// @brief Option used to add storage of the original frame "view" into
+///     the Message interface.
+/// @details Adds @b hasOrigFrame(), @b origFrameData(), @b origFrameLength(),
+///     @b setOrigFrame() and @b clearOrigFrame() member functions. The "view"
+///     of the whole frame is recorded by the protocol stack during the @b read()
+///     operation and is used by the @b writeOriginal() member function of the
+///     protocol stack to re-emit the original data without re-serialisation.
+///     The recorded "view" is cleared when the message fields are accessed
+///     using non-const @b fields() member function, which is reported by
+///     the @b origFrameInvalidated() member function. Use a const reference
+///     to the message object to inspect the fields while preserving the "view".
+/// @note The original input data must be preserved until the recorded
+///     "view" is no longer used.
+/// @headerfile comms/options.h
+struct OrigFrameView {};
+
 /// @brief Option used to specify type of the message handler.
 /// @tparam T Type of the handler.
 /// @headerfile comms/options.h
@@ -1361,6 +1385,25 @@ struct NoLengthImpl {};
 /// @headerfile comms/options.h
 struct NoRefreshImpl {};
 
+/// @brief Option for comms::MessageBase to precompute per-version layouts
+///     of the message fields.
+/// @details Applicable only when the message interface is defined with
+///     @ref comms::option::def::VersionInExtraTransportFields option and the
+///     message contains version dependent fields. At compile time the
+///     library determines all the version ranges in which the set of present
+///     fields (the ones defined with @ref comms::option::def::ExistsBetweenVersions
+///     or similar options) doesn't change as well as total serialisation length
+///     of the fields when all of them have fixed length. At run time the
+///     relevant layout is selected only when the version changes,
+///     instead of updating version of all the fields on every @b read() operation.
+///     The @b read(), @b write() and @b length() operations use the
+///     specialised code of the selected layout, which doesn't check the
+///     mode of the optional fields.
+/// @note When this option is used, the existence of the optional fields
+///     controlled by the version must not be changed manually.
+/// @headerfile comms/options.h
+struct VersionLayouts {};
+
 /// @brief Option that forces "in place" allocation with placement "new" for
 ///     initialisation, instead of usage of dynamic memory allocation.
 /// @headerfile comms/options.h
@@ -1373,6 +1416,41 @@ struct InPlaceAllocation {};
 template <typename TGenericMessage>
 struct SupportGenericMessage {};
 
+/// @brief Option used to default-initialise (instead of value-initialise)
+///     the message objects, which are going to be immediately read (decoded).
+/// @details Applicable to @ref comms::MsgFactory and/or @ref comms::protocol::MsgIdLayer
+///     classes. By default the message objects are value-initialised, which
+///     zeroes the whole object (including the storage area of the
+///     @ref comms::util::StaticVector and @ref comms::util::StaticString
+///     used by the fields with @ref FixedSizeStorage) before invoking the
+///     constructors. When this option is used, the messages allocated by
+///     the @b createMsgForRead() member function of @ref comms::MsgFactory
+///     (and by the @b read() operation of @ref comms::protocol::MsgIdLayer)
+///     are default-initialised, i.e. the zeroing is skipped. The initialisers
+///     provided by @ref comms::option::def::DefaultValueInitialiser (and
+///     its aliases like @ref comms::option::def::DefaultNumValue) are
+///     not invoked for such messages either. The initialiser of
+///     a field is deferred until the first non-const access to its value
+///     or the @b refresh() of the field (and the message), and it is dropped
+///     when the @b read() operation updates the field successfully.
+///     The @b createMsg() member function keeps performing full initialisation.
+/// @note The initialisers of the @ref comms::field::Optional,
+///     @ref comms::field::Variant and @ref comms::field::Bundle fields as well as
+///     of the fields with @ref comms::option::def::ExistsBetweenVersions,
+///     @ref comms::option::def::ContentsRefresher, @ref comms::option::def::EmptySerialization,
+///     @ref comms::option::def::HasCustomRead or @ref comms::option::def::HasCustomRefresh
+///     options are never deferred.
+/// @note The fields which are not updated by the @b read() operation
+///     (such as members of the missing optional fields) report their
+///     initial (before default value initialisation) value via the const
+///     access until the @b refresh() is invoked. Hence the message
+///     is expected to be refreshed before being used for anything other
+///     than reading it.
+/// @note The message classes are not expected to have members without
+///     initialisers that are used without being assigned first.
+/// @headerfile comms/options.h
+struct DefaultInitReadMsg {};
+
 /// @brief Option that forces usage of embedded uninitialised data area instead
 ///     of dynamic memory allocation.
 /// @details Applicable to fields that represent collection of raw data or other
@@ -1459,6 +1537,21 @@ using ForceDispatchStaticBinSearch = ForceDispatch<comms::traits::dispatch::Stat
 ///     message object and/or message object type
 using ForceDispatchLinearSwitch = ForceDispatch<comms::traits::dispatch::LinearSwitch>;
 
+/// @brief Enable invocation of the user provided instrumentation hooks.
+/// @details Applicable to the protocol stack layers (extending @ref comms::protocol::ProtocolLayerBase),
+///     @ref comms::MsgFactory and @ref comms::MsgDispatcher. A new object of the
+///     @b THooks type is default constructed for every instrumented operation
+///     and its appropriate "begin" / "end" member functions are invoked. The
+///     @ref comms::EmptyInstrumentation class documents the expected
+///     interface and can be used as a base class to provide only the required
+///     hooks. The ready to use implementation, which collects the statistics,
+///     is provided by the @ref comms::util::StatsInstrumentation class.
+///     When the option is not used the instrumentation code is not generated.
+/// @tparam THooks Type of the hooks class.
+/// @headerfile comms/options.h
+template <typename THooks>
+struct Instrumentation {};
+
 } // namespace app
 
 // Definition options
@@ -1891,6 +1984,9 @@ using RefreshInterface = comms::option::app::RefreshInterface;
 /// @brief Same as @ref comms::option::app::NameInterface
 using NameInterface = comms::option::app::NameInterface;
 
+/// @brief Same as @ref comms::option::app::OrigFrameView
+using OrigFrameView = comms::option::app::OrigFrameView;
+
 /// @brief Same as @ref comms::option::app::Handler
 template <typename T>
 using Handler = comms::option::app::Handler<T>;
@@ -1913,6 +2009,9 @@ using NoLengthImpl = comms::option::app::NoLengthImpl;
 /// @brief Same as @ref comms::option::app::NoRefreshImpl
 using NoRefreshImpl = comms::option::app::NoRefreshImpl;
 
+/// @brief Same as @ref comms::option::app::VersionLayouts
+using VersionLayouts = comms::option::app::VersionLayouts;
+
 /// @brief Same as @ref comms::option::app::InPlaceAllocation
 using InPlaceAllocation = comms::option::app::InPlaceAllocation;
 
@@ -1920,6 +2019,9 @@ using InPlaceAllocation = comms::option::app::InPlaceAllocation;
 template <typename TGenericMessage>
 using SupportGenericMessage = comms::option::app::SupportGenericMessage<TGenericMessage>;
 
+/// @brief Same as @ref comms::option::app::DefaultInitReadMsg
+using DefaultInitReadMsg = comms::option::app::DefaultInitReadMsg;
+
 /// @brief Same as @ref comms::option::app::FixedSizeStorage
 template <std::size_t TSize>
 using FixedSizeStorage = comms::option::app::FixedSizeStorage<TSize>;
@@ -1950,6 +2052,10 @@ using ForceDispatchStaticBinSearch = comms::option::app::ForceDispatchStaticBinS
 /// @brief Same as @ref comms::option::app::ForceDispatchLinearSwitch
 using ForceDispatchLinearSwitch = comms::option::app::ForceDispatchLinearSwitch;
 
+/// @brief Same as @ref comms::option::app::Instrumentation
+template <typename THooks>
+using Instrumentation = comms::option::app::Instrumentation<THooks>;
+
 }  // namespace option
 
 }  // namespace comms
@@ -66,8 +66,11 @@ class ChecksumLayer : public
             details::ProtocolLayerExtendingClassT<
                 ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>,
                 details::ChecksumLayerOptionsParser<TOptions...>
-            >,            
-            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::ChecksumLayerOptionsParser<TOptions...>
+            >
         >
 {
     using BaseImpl =
@@ -77,8 +80,11 @@ class ChecksumLayer : public
             details::ProtocolLayerExtendingClassT<
                 ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>,
                 details::ChecksumLayerOptionsParser<TOptions...>
-            >,            
-            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::ChecksumLayerOptionsParser<TOptions...>
+            >
         >;
 
 public:
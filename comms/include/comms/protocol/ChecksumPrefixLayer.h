@@ -68,8 +68,11 @@ class ChecksumPrefixLayer : public
             details::ProtocolLayerExtendingClassT<
                 ChecksumPrefixLayer<TField, TCalc, TNextLayer, TOptions...>,
                 details::ChecksumLayerOptionsParser<TOptions...>
-            >,            
-            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::ChecksumLayerOptionsParser<TOptions...>
+            >
         >
 {
     using BaseImpl =
@@ -79,8 +82,11 @@ class ChecksumPrefixLayer : public
             details::ProtocolLayerExtendingClassT<
                 ChecksumPrefixLayer<TField, TCalc, TNextLayer, TOptions...>,
                 details::ChecksumLayerOptionsParser<TOptions...>
-            >,            
-            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::ChecksumLayerOptionsParser<TOptions...>
+            >
         >;
 
 public:
@@ -53,6 +53,9 @@ namespace protocol
 ///     @li @ref comms::option::def::ExtendingClass - Use this option to provide a class
 ///         name of the extending class, which can be used to extend existing functionality.
 ///         See also @ref page_custom_id_layer tutorial page.
+///     @li @ref comms::option::app::Instrumentation - Enables invocation of the
+///         instrumentation hooks by this layer as well as by the inner instance
+///         of @ref comms::MsgFactory.
 ///     @li All the options supported by the @ref comms::MsgFactory. All the options
 ///         except ones listed above will be forwarded to the definition of the
 ///         inner instance of @ref comms::MsgFactory.
@@ -69,6 +72,9 @@ class MsgIdLayer : public
             details::ProtocolLayerExtendingClassT<
                 MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>, 
                 details::MsgIdLayerOptionsParser<TOptions...>
+            >,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::MsgIdLayerOptionsParser<TOptions...>
             >
         >
 {
@@ -82,6 +88,9 @@ class MsgIdLayer : public
             details::ProtocolLayerExtendingClassT<
                 MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>, 
                 details::MsgIdLayerOptionsParser<TOptions...>
+            >,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::MsgIdLayerOptionsParser<TOptions...>
             >
         >;
 
@@ -413,6 +422,20 @@ private:
     template <typename... TParams>
     using NoGenericMsgTag = comms::details::tag::Tag8<>;     
 
+    template <typename... TParams>
+    using NoInstrumentationTag = comms::details::tag::Tag9<>;
+
+    template <typename... TParams>
+    using HasInstrumentationTag = comms::details::tag::Tag10<>;
+
+    using InstrumentationTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasInstrumentation
+        >::template Type<
+            HasInstrumentationTag,
+            NoInstrumentationTag
+        >;
+
     template <typename TIter, typename TNextLayerReader, typename... TExtraValues>
     class ReadRedirectionHandler
     {
@@ -606,6 +629,41 @@ private:
         return msg.doGetId();
     }
 
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename TTag, typename... TExtraValues>
+    comms::ErrorStatus readMsgContents(
+        MsgIdParamType id,
+        unsigned idx,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TTag tag,
+        NoInstrumentationTag<>,
+        TExtraValues... extraValues)
+    {
+        return doReadInternal(id, idx, msg, iter, size, std::forward<TNextLayerReader>(nextLayerReader), tag, extraValues...);
+    }
+
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename TTag, typename... TExtraValues>
+    comms::ErrorStatus readMsgContents(
+        MsgIdParamType id,
+        unsigned idx,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TTag tag,
+        HasInstrumentationTag<>,
+        TExtraValues... extraValues)
+    {
+        typename ParsedOptionsInternal::InstrumentationHooks hooks;
+        hooks.msgReadBegin(id, size);
+        auto fromIter = iter;
+        auto es = doReadInternal(id, idx, msg, iter, size, std::forward<TNextLayerReader>(nextLayerReader), tag, extraValues...);
+        hooks.msgReadEnd(id, es, static_cast<std::size_t>(std::distance(fromIter, iter)));
+        return es;
+    }
+
     template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
     comms::ErrorStatus doReadInternalDirect(
         Field& field,
@@ -715,7 +773,7 @@ private:
             IterType readStart = iter;                
 
             thisObj.beforeRead(field, *msg);
-            es = doReadInternal(id, idx, msg, iter, size, std::forward<TNextLayerReader>(nextLayerReader), Tag(), extraValues...);
+            es = readMsgContents(id, idx, msg, iter, size, std::forward<TNextLayerReader>(nextLayerReader), Tag(), InstrumentationTag(), extraValues...);
             if (es == comms::ErrorStatus::Success) {
                 BaseImpl::setMsgIndex(idx, extraValues...);
                 return es;
@@ -776,13 +834,13 @@ private:
     template <typename TId, typename... TParams>
     MsgPtr createMsgInternalTagged(TId&& id, unsigned idx, CreateFailureReason* reason, IdParamAsIsTag<TParams...>)
     {
-        return createMsg(std::forward<TId>(id), idx, reason);
+        return factory_.createMsgForRead(std::forward<TId>(id), idx, reason);
     }
 
     template <typename TId, typename... TParams>
     MsgPtr createMsgInternalTagged(TId&& id, unsigned idx, CreateFailureReason* reason, IdParamCastTag<TParams...>)
     {
-        return createMsg(static_cast<MsgIdType>(id), idx, reason);
+        return factory_.createMsgForRead(static_cast<MsgIdType>(id), idx, reason);
     }
 
     template <typename TId>
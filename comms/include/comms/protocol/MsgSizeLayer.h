@@ -69,7 +69,10 @@ class MsgSizeLayer : public
                 MsgSizeLayer<TField, TNextLayer, TOptions...>, 
                 details::MsgSizeLayerOptionsParser<TOptions...>
             >,
-            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::MsgSizeLayerOptionsParser<TOptions...>
+            >
         >
 {
     using BaseImpl =
@@ -80,7 +83,10 @@ class MsgSizeLayer : public
                 MsgSizeLayer<TField, TNextLayer, TOptions...>, 
                 details::MsgSizeLayerOptionsParser<TOptions...>
             >,
-            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::MsgSizeLayerOptionsParser<TOptions...>
+            >
         >;
 public:
     /// @brief Type of the field object used to read/write remaining size value.
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <tuple>
 #include <utility>
 #include <algorithm>
@@ -51,6 +52,7 @@ namespace protocol
 /// @tparam TOptions Extra options. Supported ones are:
 ///     @li @ref comms::option::def::ProtocolLayerForceReadUntilDataSplit
 ///     @li @ref comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+///     @li @ref comms::option::app::Instrumentation
 /// @headerfile comms/protocol/ProtocolLayerBase.h
 template <
     typename TField,
@@ -204,6 +206,12 @@ public:
     ///       advanced will pinpoint the location of the error.
     /// @post Returns comms::ErrorStatus::Success if and only if msg points
     ///       to a valid object.
+    /// @post In case the message interface was defined using
+    ///       @ref comms::option::app::OrigFrameView option, the successfully
+    ///       read message object records the "view" of the whole read frame
+    ///       (see @ref writeOriginal()). It requires the used iterator to
+    ///       be a random access one to a contiguous buffer of single byte values,
+    ///       which needs to stay valid as long as the "view" is used.
     template <typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus read(
         TMsg& msg,
@@ -221,7 +229,7 @@ public:
 
         static_assert(std::is_same<Tag, NormalReadTag<> >::value || canSplitRead(),
             "Read split is disallowed by at least one of the inner layers");
-        return readInternal(msg, iter, size, Tag(), extraValues...);
+        return readOrigFrame(msg, iter, size, Tag(), OrigFrameTag<typename std::decay<TMsg>::type>(), extraValues...);
     }
 
     /// @brief Perform read of data fields until data layer (message payload).
@@ -480,9 +488,45 @@ public:
         TIter& iter,
         std::size_t size) const
     {
-        Field field;
-        auto& derivedObj = static_cast<const TDerived&>(*this);
-        return derivedObj.doWrite(field, msg, iter, size, createNextLayerWriter());
+        return writeInstrumented(msg, iter, size, InstrumentationTag());
+    }
+
+    /// @brief Serialise message re-using its original frame when possible.
+    /// @details Applicable only when the message interface was defined using
+    ///     @ref comms::option::app::OrigFrameView option. In case the message
+    ///     object still holds the "view" of the original frame recorded
+    ///     by the @ref read() operation, the frame bytes are copied verbatim
+    ///     without any serialisation of the transport and message fields.
+    ///     Otherwise (the frame wasn't recorded or the message was modified)
+    ///     the call is equivalent to @ref write(). The message object's
+    ///     @b origFrameInvalidated() member function reports whether the
+    ///     "view" was dropped due to the non-const access to the message fields.
+    /// @tparam TMsg Type of the message being written.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @param[in] msg Reference to the message object that is being written,
+    /// @param[in, out] iter Iterator used for writing.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @return Status of the write operation.
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeOriginal(
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size) const
+    {
+        static_assert(details::protocolLayerHasOrigFrameView<TMsg>(),
+            "The message interface must be defined using comms::option::app::OrigFrameView option");
+
+        if (!msg.hasOrigFrame()) {
+            return write(msg, iter, size);
+        }
+
+        auto len = msg.origFrameLength();
+        if (size < len) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        iter = std::copy_n(msg.origFrameData(), len, iter);
+        return comms::ErrorStatus::Success;
     }
 
     /// @brief Serialise message into output data sequence while caching the written transport
@@ -1229,6 +1273,153 @@ private:
     template <typename... TParams>
     using SplitReadTag = comms::details::tag::Tag4<>;
 
+    template <typename... TParams>
+    using NoInstrumentationTag = comms::details::tag::Tag7<>;
+
+    template <typename... TParams>
+    using HasInstrumentationTag = comms::details::tag::Tag8<>;
+
+    using InstrumentationTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptions::HasInstrumentation
+        >::template Type<
+            HasInstrumentationTag,
+            NoInstrumentationTag
+        >;
+
+    template <typename... TParams>
+    using NoOrigFrameTag = comms::details::tag::Tag9<>;
+
+    template <typename... TParams>
+    using HasOrigFrameTag = comms::details::tag::Tag10<>;
+
+    template <typename TMsg>
+    using OrigFrameTag =
+        typename comms::util::LazyShallowConditional<
+            details::protocolLayerHasOrigFrameView<TMsg>()
+        >::template Type<
+            HasOrigFrameTag,
+            NoOrigFrameTag
+        >;
+
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readOrigFrame(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag readTag,
+        NoOrigFrameTag<>,
+        TExtraValues... extraValues)
+    {
+        return readInstrumented(msg, iter, size, readTag, InstrumentationTag(), extraValues...);
+    }
+
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readOrigFrame(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag readTag,
+        HasOrigFrameTag<>,
+        TExtraValues... extraValues)
+    {
+        using IterType = typename std::decay<TIter>::type;
+        using IterCategory = typename std::iterator_traits<IterType>::iterator_category;
+        static_assert(std::is_base_of<std::random_access_iterator_tag, IterCategory>::value,
+            "Recording of the original frame requires random access iterator");
+        static_assert(sizeof(typename std::iterator_traits<IterType>::value_type) == 1U,
+            "Recording of the original frame requires iterator to single byte values");
+
+        auto fromIter = iter;
+        auto es = readInstrumented(msg, iter, size, readTag, InstrumentationTag(), extraValues...);
+        auto* msgPtr = toMsgPtr(msg);
+        if (msgPtr == nullptr) {
+            return es;
+        }
+
+        auto len = static_cast<std::size_t>(std::distance(fromIter, iter));
+        if ((es != comms::ErrorStatus::Success) || (len == 0U)) {
+            msgPtr->clearOrigFrame();
+            return es;
+        }
+
+        msgPtr->setOrigFrame(reinterpret_cast<const std::uint8_t*>(&(*fromIter)), len);
+        return es;
+    }
+
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readInstrumented(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag readTag,
+        NoInstrumentationTag<>,
+        TExtraValues... extraValues)
+    {
+        return readInternal(msg, iter, size, readTag, extraValues...);
+    }
+
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readInstrumented(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag readTag,
+        HasInstrumentationTag<>,
+        TExtraValues... extraValues)
+    {
+        typename ParsedOptions::InstrumentationHooks hooks;
+        auto& thisObj = thisLayer();
+        hooks.layerReadBegin(thisObj, size);
+        auto fromIter = iter;
+        auto es = readInternal(msg, iter, size, readTag, extraValues...);
+        hooks.layerReadEnd(thisObj, es, static_cast<std::size_t>(std::distance(fromIter, iter)));
+        return es;
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeInstrumented(
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        NoInstrumentationTag<>) const
+    {
+        Field field;
+        auto& derivedObj = static_cast<const TDerived&>(*this);
+        return derivedObj.doWrite(field, msg, iter, size, createNextLayerWriter());
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeInstrumented(
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        HasInstrumentationTag<>) const
+    {
+        typename ParsedOptions::InstrumentationHooks hooks;
+        auto& thisObj = thisLayer();
+        hooks.layerWriteBegin(thisObj, size);
+        auto fromIter = iter;
+        auto es = writeInstrumented(msg, iter, size, NoInstrumentationTag<>());
+        using IterCategory = typename std::iterator_traits<typename std::decay<TIter>::type>::iterator_category;
+        hooks.layerWriteEnd(thisObj, es, writtenBytesCount(fromIter, iter, IterCategory()));
+        return es;
+    }
+
+    template <typename TIter>
+    static std::size_t writtenBytesCount(const TIter& from, const TIter& to, std::input_iterator_tag)
+    {
+        return static_cast<std::size_t>(std::distance(from, to));
+    }
+
+    template <typename TIter>
+    static std::size_t writtenBytesCount(const TIter& from, const TIter& to, std::output_iterator_tag)
+    {
+        static_cast<void>(from);
+        static_cast<void>(to);
+        return 0U;
+    }
+
     template <typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus readInternal(
         TMsg& msg,
@@ -47,7 +47,10 @@ class SyncPrefixLayer : public
             details::ProtocolLayerExtendingClassT<
                 SyncPrefixLayer<TField, TNextLayer, TOptions...>,
                 details::SyncPrefixLayerOptionsParser<TOptions...>
-            >            
+            >,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::SyncPrefixLayerOptionsParser<TOptions...>
+            >
         >
 {
     using BaseImpl =
@@ -57,7 +60,10 @@ class SyncPrefixLayer : public
             details::ProtocolLayerExtendingClassT<
                 SyncPrefixLayer<TField, TNextLayer, TOptions...>,
                 details::SyncPrefixLayerOptionsParser<TOptions...>
-            >            
+            >,
+            details::ProtocolLayerInstrumentationOptionT<
+                details::SyncPrefixLayerOptionsParser<TOptions...>
+            >
         >;
 
 public:
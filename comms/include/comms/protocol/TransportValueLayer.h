@@ -63,7 +63,10 @@ class TransportValueLayer : public
                     TransportValueLayer<TField, TIdx, TNextLayer, TOptions...>,
                     details::TransportValueLayerOptionsParser<TOptions...>
                 >,
-                comms::option::def::ProtocolLayerForceReadUntilDataSplit
+                comms::option::def::ProtocolLayerForceReadUntilDataSplit,
+                details::ProtocolLayerInstrumentationOptionT<
+                    details::TransportValueLayerOptionsParser<TOptions...>
+                >
             >,
             TOptions...
         >
@@ -78,7 +81,10 @@ class TransportValueLayer : public
                     ThisClass,
                     details::TransportValueLayerOptionsParser<TOptions...>
                 >,
-                comms::option::def::ProtocolLayerForceReadUntilDataSplit
+                comms::option::def::ProtocolLayerForceReadUntilDataSplit,
+                details::ProtocolLayerInstrumentationOptionT<
+                    details::TransportValueLayerOptionsParser<TOptions...>
+                >
             >,
             TOptions...
         >;
@@ -10,8 +10,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
+#include "comms/CompileControl.h"
+
 namespace comms
 {
 
@@ -38,18 +41,63 @@ public:
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
     TResult operator()(TIter& iter, std::size_t len) const
+    {
+        return finalise(update(init(), iter, len));
+    }
+
+    /// @brief Initial state of the incremental checksum calculation.
+    /// @details Allows calculation of the checksum over the data which
+    ///     is not available in a single contiguous range, see
+    ///     @ref comms::util::ChunkedWriter.
+    static constexpr TResult init()
+    {
+        return TInitValue;
+    }
+
+    /// @brief Update the state of the incremental checksum calculation.
+    /// @param[in] state Current state.
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @return Updated state.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    TResult update(TResult state, TIter& iter, std::size_t len) const
     {
         using ByteType = typename std::make_unsigned<
             typename std::decay<decltype(*iter)>::type
         >::type;
 
-        TResult checksum = TInitValue;
         for (auto idx = 0U; idx < len; ++idx) {
-            checksum = static_cast<TResult>(checksum ^ static_cast<ByteType>(*iter));
+            state = static_cast<TResult>(state ^ static_cast<ByteType>(*iter));
             ++iter;
         }
-        return checksum;
+        return state;
+    }
+
+    /// @brief Finalise the incremental checksum calculation.
+    /// @param[in] state Current state.
+    /// @return The checksum value.
+    static constexpr TResult finalise(TResult state)
+    {
+        return state;
+    }
+
+#if COMMS_IS_CPP14
+    /// @brief Calculate the checksum value in constant expressions.
+    /// @details Available only for C++14 and above,
+    ///     used by @ref comms::constFrameImage().
+    /// @param[in] data Pointer to the data.
+    /// @param[in] len Number of bytes to summarise.
+    /// @return The checksum value.
+    static constexpr TResult constexprCalc(const std::uint8_t* data, std::size_t len)
+    {
+        auto state = init();
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            state = static_cast<TResult>(state ^ data[idx]);
+        }
+        return finalise(state);
     }
+#endif // #if COMMS_IS_CPP14
 };
 
 }  // namespace checksum
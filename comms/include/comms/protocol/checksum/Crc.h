@@ -17,6 +17,7 @@
 #include "comms/util/type_traits.h"
 #include "comms/details/tag.h"
 #include "comms/cast.h"
+#include "comms/CompileControl.h"
 
 namespace comms
 {
@@ -276,11 +277,32 @@ public:
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
     TResult operator()(TIter& iter, std::size_t len) const
+    {
+        return finalise(update(init(), iter, len));
+    }
+
+    /// @brief Initial state of the incremental checksum calculation.
+    /// @details Allows calculation of the checksum over the data which
+    ///     is not available in a single contiguous range, see
+    ///     @ref comms::util::ChunkedWriter.
+    static constexpr TResult init()
+    {
+        return TInit;
+    }
+
+    /// @brief Update the state of the incremental checksum calculation.
+    /// @param[in] state Current state (remainder).
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @return Updated state.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    TResult update(TResult state, TIter& iter, std::size_t len) const
     {
         static const std::size_t Width =
             sizeof(TResult) * std::numeric_limits<std::uint8_t>::digits;
 
-        TResult rem = TInit;
+        TResult rem = state;
         auto& initTable = details::CrcInitTable<TResult, TPoly>::get();
 
         for (std::size_t byte = 0U; byte < len; ++byte)
@@ -295,8 +317,57 @@ public:
             ++iter;
         }
 
-        return (reflectRem(rem) ^ TFin);
+        return rem;
+    }
+
+    /// @brief Finalise the incremental checksum calculation.
+    /// @param[in] state Current state (remainder).
+    /// @return The checksum value.
+    static TResult finalise(TResult state)
+    {
+        return static_cast<TResult>(reflectRem(state) ^ TFin);
+    }
+
+#if COMMS_IS_CPP14
+    /// @brief Calculate the checksum value in constant expressions.
+    /// @details Available only for C++14 and above,
+    ///     used by @ref comms::constFrameImage(). Processes the data
+    ///     bit by bit without using the lookup table.
+    /// @param[in] data Pointer to the data.
+    /// @param[in] len Number of bytes to summarise.
+    /// @return The checksum value.
+    static constexpr TResult constexprCalc(const std::uint8_t* data, std::size_t len)
+    {
+        const std::size_t Width =
+            sizeof(TResult) * std::numeric_limits<std::uint8_t>::digits;
+        const auto Msb =
+            static_cast<TResult>(static_cast<TResult>(1) << (Width - 1));
+
+        TResult rem = init();
+        for (std::size_t byte = 0U; byte < len; ++byte) {
+            TResult val = data[byte];
+            if (TReflect) {
+                val = constexprReflect(val, 8U);
+            }
+
+            rem = static_cast<TResult>(rem ^ static_cast<TResult>(val << (Width - 8)));
+            for (auto bit = 8U; bit > 0U; --bit) {
+                if ((rem & Msb) != 0) {
+                    rem = static_cast<TResult>(static_cast<TResult>(rem << 1) ^ TPoly);
+                }
+                else {
+                    rem = static_cast<TResult>(rem << 1);
+                }
+            }
+        }
+
+        if (TRefrectRem) {
+            rem = constexprReflect(rem, Width);
+        }
+
+        return static_cast<TResult>(rem ^ TFin);
     }
+#endif // #if COMMS_IS_CPP14
 
 private:
     template <typename... TParams>
@@ -366,6 +437,25 @@ private:
         return (reflection);
     }
 
+#if COMMS_IS_CPP14
+    static constexpr TResult constexprReflect(TResult value, std::size_t bitsCount)
+    {
+        TResult reflection = 0U;
+        for (std::size_t bit = 0U; bit < bitsCount; ++bit) {
+            if ((value & 0x01) != 0) {
+                reflection = 
+                    static_cast<TResult>(
+                        reflection | 
+                        static_cast<TResult>(static_cast<TResult>(1) << ((bitsCount - 1) - bit)));
+            }
+
+            value = static_cast<TResult>(value >> 1);
+        }
+
+        return reflection;
+    }
+#endif // #if COMMS_IS_CPP14
+
 };
 
 /// @brief Alias to @ref Crc checksum calculator for CRC-CCITT.
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -28,10 +29,11 @@ class ChecksumLayerOptionsParser<>
 public:
     static constexpr bool HasVerifyBeforeRead = false;
     static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 
     template <typename TLayer>
     using DefineExtendingClass = TLayer;
-
 };
 
 template <typename... TOptions>
@@ -54,6 +56,15 @@ public:
     using DefineExtendingClass = ExtendingClass;    
 };
 
+template <typename T, typename... TOptions>
+class ChecksumLayerOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public ChecksumLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class ChecksumLayerOptionsParser<
     comms::option::app::EmptyOption,
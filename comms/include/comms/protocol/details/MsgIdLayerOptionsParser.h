@@ -9,6 +9,7 @@
 
 #include <tuple>
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -28,6 +29,8 @@ class MsgIdLayerOptionsParser<>
 {
 public:
     static const bool HasExtendingClass = false;
+    static const bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
     using FactoryOptions = std::tuple<>;
 
     template <typename TLayer>
@@ -46,6 +49,25 @@ public:
     using DefineExtendingClass = ExtendingClass;       
 };
 
+template <typename T, typename... TOptions>
+class MsgIdLayerOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public MsgIdLayerOptionsParser<TOptions...>
+{
+    using BaseImpl = MsgIdLayerOptionsParser<TOptions...>;
+public:
+    static const bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+    using FactoryOptions = 
+        typename std::decay<
+            decltype(
+                std::tuple_cat(
+                    std::declval<std::tuple<comms::option::app::Instrumentation<T> > >(),
+                    std::declval<typename BaseImpl::FactoryOptions>()
+                )
+            )
+        >::type;
+};
+
 template <typename... TOptions>
 class MsgIdLayerOptionsParser<
     comms::option::app::EmptyOption,
@@ -9,6 +9,7 @@
 
 #include <tuple>
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -28,6 +29,8 @@ class MsgSizeLayerOptionsParser<>
 {
 public:
     static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 
     template <typename TLayer>
     using DefineExtendingClass = TLayer;
@@ -45,6 +48,15 @@ public:
     using DefineExtendingClass = ExtendingClass;    
 };
 
+template <typename T, typename... TOptions>
+class MsgSizeLayerOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public MsgSizeLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class MsgSizeLayerOptionsParser<
     comms::option::app::EmptyOption,
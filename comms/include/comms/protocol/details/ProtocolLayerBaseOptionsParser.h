@@ -8,6 +8,8 @@
 #pragma once
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
+#include "comms/util/type_traits.h"
 
 namespace comms
 {
@@ -28,6 +30,8 @@ class ProtocolLayerBaseOptionsParser<>
 public:
     static constexpr bool HasForceReadUntilDataSplit = false;
     static constexpr bool HasDisallowReadUntilDataSplit = false;
+    static constexpr bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 };
 
 template <typename... TOptions>
@@ -48,6 +52,15 @@ public:
     static constexpr bool HasDisallowReadUntilDataSplit = true;
 };
 
+template <typename T, typename... TOptions>
+class ProtocolLayerBaseOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public ProtocolLayerBaseOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class ProtocolLayerBaseOptionsParser<
     comms::option::app::EmptyOption,
@@ -62,6 +75,15 @@ class ProtocolLayerBaseOptionsParser<
 {
 };
 
+template <typename TParsedOptions>
+using ProtocolLayerInstrumentationOptionT =
+    typename comms::util::Conditional<
+        TParsedOptions::HasInstrumentation
+    >::template Type<
+        comms::option::app::Instrumentation<typename TParsedOptions::InstrumentationHooks>,
+        comms::option::app::EmptyOption
+    >;
+
 } // namespace details
 
 } // namespace protocol
@@ -92,6 +92,52 @@ constexpr bool protocolLayerHasDoGetId()
     return ProtocolLayerHasDoGetId<T>::Value;
 }
 
+template <typename T, bool THasElementType>
+struct ProtocolLayerMsgObjTypeHelper;
+
+template <typename T>
+struct ProtocolLayerMsgObjTypeHelper<T, true>
+{
+    using Type = typename T::element_type;
+};
+
+template <typename T>
+struct ProtocolLayerMsgObjTypeHelper<T, false>
+{
+    using Type = T;
+};
+
+template <typename T, bool THasInterface>
+struct ProtocolLayerHasOrigFrameViewHelper;
+
+template <typename T>
+struct ProtocolLayerHasOrigFrameViewHelper<T, true>
+{
+    static const bool Value = T::InterfaceOptions::HasOrigFrameView;
+};
+
+template <typename T>
+struct ProtocolLayerHasOrigFrameViewHelper<T, false>
+{
+    static const bool Value = false;
+};
+
+template <typename T>
+struct ProtocolLayerHasOrigFrameView
+{
+    using MsgType =
+        typename ProtocolLayerMsgObjTypeHelper<T, comms::details::hasElementType<T>()>::Type;
+
+    static const bool Value =
+        ProtocolLayerHasOrigFrameViewHelper<MsgType, comms::details::hasInterfaceOptions<MsgType>()>::Value;
+};
+
+template <typename T>
+constexpr bool protocolLayerHasOrigFrameView()
+{
+    return ProtocolLayerHasOrigFrameView<T>::Value;
+}
+
 template <class T, class R = void>
 struct ProtocolLayerEnableIfHasMsgPtr { using Type = R; };
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 
 namespace comms
 {
@@ -27,6 +28,8 @@ class SyncPrefixLayerOptionsParser<>
 {
 public:
     static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 
     template <typename TLayer>
     using DefineExtendingClass = TLayer;
@@ -44,6 +47,15 @@ public:
     using DefineExtendingClass = ExtendingClass;    
 };
 
+template <typename T, typename... TOptions>
+class SyncPrefixLayerOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public SyncPrefixLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class SyncPrefixLayerOptionsParser<
     comms::option::app::EmptyOption,
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "comms/options.h"
+#include "comms/EmptyInstrumentation.h"
 #include "TransportValueLayerBases.h"
 
 namespace comms
@@ -29,6 +30,8 @@ class TransportValueLayerOptionsParser<>
 public:
     static const bool HasPseudoValue = false;
     static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasInstrumentation = false;
+    using InstrumentationHooks = comms::EmptyInstrumentation;
 
     template <typename TBase>
     using BuildPseudoBase = TBase;
@@ -60,6 +63,15 @@ public:
     using DefineExtendingClass = ExtendingClass;    
 };
 
+template <typename T, typename... TOptions>
+class TransportValueLayerOptionsParser<comms::option::app::Instrumentation<T>, TOptions...> :
+        public TransportValueLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInstrumentation = true;
+    using InstrumentationHooks = T;
+};
+
 template <typename... TOptions>
 class TransportValueLayerOptionsParser<
     comms::option::app::EmptyOption,
@@ -0,0 +1,857 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// Contains definition of @ref comms::util::ChunkedWriter class.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/field/ArrayList.h"
+#include "comms/field/String.h"
+#include "comms/protocol/ChecksumLayer.h"
+#include "comms/protocol/MsgDataLayer.h"
+#include "comms/protocol/MsgIdLayer.h"
+#include "comms/protocol/MsgSizeLayer.h"
+#include "comms/protocol/SyncPrefixLayer.h"
+#include "comms/util/access.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+namespace details
+{
+
+// State of the write of a single serialisation unit (a field or
+// an element of a sequence field).
+struct ChunkedWriterUnit
+{
+    std::uint8_t* buf_ = nullptr;
+    std::size_t* pos_ = nullptr;
+    std::size_t size_ = 0U;
+    std::size_t skip_ = 0U; // Produced by the previous calls
+    std::size_t count_ = 0U; // Produced by the unit so far
+    std::size_t done_ = 0U; // Produced by the unit and stored so far
+};
+
+// Output iterator used to write the unit. The bytes of the unit produced
+// by the previous calls are skipped, the ones following the end of the
+// output buffer are dropped.
+class ChunkedWriterUnitIterator
+{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = std::uint8_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit ChunkedWriterUnitIterator(ChunkedWriterUnit& unit) : unit_(&unit) {}
+
+    ChunkedWriterUnitIterator& operator=(std::uint8_t byte)
+    {
+        auto& unit = *unit_;
+        if (unit.done_ == unit.count_) {
+            if (unit.count_ < unit.skip_) {
+                ++unit.done_;
+            }
+            else if (*unit.pos_ < unit.size_) {
+                unit.buf_[*unit.pos_] = byte;
+                ++(*unit.pos_);
+                ++unit.done_;
+            }
+        }
+
+        ++unit.count_;
+        return *this;
+    }
+
+    ChunkedWriterUnitIterator& operator*()
+    {
+        return *this;
+    }
+
+    ChunkedWriterUnitIterator& operator++()
+    {
+        return *this;
+    }
+
+    ChunkedWriterUnitIterator& operator++(int)
+    {
+        return *this;
+    }
+
+private:
+    ChunkedWriterUnit* unit_ = nullptr;
+};
+
+template <typename TField>
+class ChunkedWriterFieldUnit
+{
+public:
+    explicit ChunkedWriterFieldUnit(const TField& field) : field_(field) {}
+
+    template <typename TIter>
+    comms::ErrorStatus operator()(TIter& iter) const
+    {
+        return field_.write(iter, field_.length());
+    }
+
+private:
+    const TField& field_;
+};
+
+template <typename T, typename TEndian>
+class ChunkedWriterRawUnit
+{
+public:
+    explicit ChunkedWriterRawUnit(T value) : value_(value) {}
+
+    template <typename TIter>
+    comms::ErrorStatus operator()(TIter& iter) const
+    {
+        comms::util::writeData(value_, iter, TEndian());
+        return comms::ErrorStatus::Success;
+    }
+
+private:
+    T value_;
+};
+
+// The sequence fields written element by element (and resumed in the middle)
+// are the ones which serialisation is fully determined by the optional
+// size / serialisation length prefix and the elements themselves.
+template <typename TField, bool TIsSequence = comms::field::isArrayList<TField>() || comms::field::isString<TField>()>
+struct ChunkedWriterIsSplitSequence
+{
+    static const bool Value = false;
+};
+
+template <typename TField>
+struct ChunkedWriterIsSplitSequence<TField, true>
+{
+    using ParsedOptions = typename TField::ParsedOptions;
+    static const bool Value =
+        (!ParsedOptions::HasSequenceFixedSize) &&
+        (!ParsedOptions::HasSequenceTrailingFieldSuffix) &&
+        (!ParsedOptions::HasSequenceTerminationFieldSuffix) &&
+        (!ParsedOptions::HasSequenceElemLengthForcing) &&
+        (!ParsedOptions::HasSequenceElemSerLengthFieldPrefix) &&
+        (!ParsedOptions::HasSequenceElemFixedSerLengthFieldPrefix) &&
+        (!ParsedOptions::HasEmptySerialization) &&
+        (!ParsedOptions::HasVersionsRange) &&
+        (!ParsedOptions::HasCustomWrite);
+};
+
+// The layers are recognised by their base class, which allows usage of
+// the protocol stack classes extending the standard layers.
+template <typename TField, typename TNextLayer, typename... TOptions>
+comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>
+chunkedWriterLayerBase(const comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TNextLayer, typename... TOptions>
+comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>
+chunkedWriterLayerBase(const comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TMessage, typename TAllMessages, typename TNextLayer, typename... TOptions>
+comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>
+chunkedWriterLayerBase(const comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>*);
+
+template <typename TField, typename TCalc, typename TNextLayer, typename... TOptions>
+comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>
+chunkedWriterLayerBase(const comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>*);
+
+template <typename... TOptions>
+comms::protocol::MsgDataLayer<TOptions...>
+chunkedWriterLayerBase(const comms::protocol::MsgDataLayer<TOptions...>*);
+
+struct ChunkedWriterUnsupportedLayer {};
+
+ChunkedWriterUnsupportedLayer chunkedWriterLayerBase(const void*);
+
+// Every layer contributes one or more write steps (which are
+// executed in order) and the checksum calculations (if any).
+template <typename TLayer, std::size_t TChecksumIdx>
+struct ChunkedWriterLayerPlan
+{
+    static_assert(!std::is_same<TLayer, TLayer>::value,
+        "Only SyncPrefixLayer, MsgSizeLayer, MsgIdLayer, ChecksumLayer "
+        "and MsgDataLayer are supported");
+};
+
+template <typename TLayer, std::size_t TChecksumIdx = 0U>
+using ChunkedWriterPlan =
+    ChunkedWriterLayerPlan<decltype(chunkedWriterLayerBase(static_cast<const TLayer*>(nullptr))), TChecksumIdx>;
+
+template <typename TField, typename TNextLayer, std::size_t TChecksumIdx, typename... TOptions>
+struct ChunkedWriterLayerPlan<comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>, TChecksumIdx>
+{
+    using Layer = comms::protocol::SyncPrefixLayer<TField, TNextLayer, TOptions...>;
+    using NextPlan = ChunkedWriterPlan<TNextLayer, TChecksumIdx>;
+    using Checksums = typename NextPlan::Checksums;
+    static const std::size_t StepsCount = 1U + NextPlan::StepsCount;
+
+    template <typename TWriter, typename TMsg>
+    static bool writeStep(TWriter& writer, const Layer& layer, const TMsg& msg, std::size_t step)
+    {
+        if (step == 0U) {
+            return writer.writeField(TField());
+        }
+
+        return NextPlan::writeStep(writer, layer.nextLayer(), msg, step - 1U);
+    }
+
+    template <typename TChecksums>
+    static void update(TChecksums& checksums, std::size_t step, const std::uint8_t* data, std::size_t len)
+    {
+        if (step != 0U) {
+            NextPlan::update(checksums, step - 1U, data, len);
+        }
+    }
+};
+
+template <typename TField, typename TNextLayer, std::size_t TChecksumIdx, typename... TOptions>
+struct ChunkedWriterLayerPlan<comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>, TChecksumIdx>
+{
+    using Layer = comms::protocol::MsgSizeLayer<TField, TNextLayer, TOptions...>;
+    using NextPlan = ChunkedWriterPlan<TNextLayer, TChecksumIdx>;
+    using Checksums = typename NextPlan::Checksums;
+    static const std::size_t StepsCount = 1U + NextPlan::StepsCount;
+
+    template <typename TWriter, typename TMsg>
+    static bool writeStep(TWriter& writer, const Layer& layer, const TMsg& msg, std::size_t step)
+    {
+        if (step == 0U) {
+            TField field;
+            field.value() = static_cast<typename TField::ValueType>(layer.nextLayer().length(msg));
+            return writer.writeField(field);
+        }
+
+        return NextPlan::writeStep(writer, layer.nextLayer(), msg, step - 1U);
+    }
+
+    template <typename TChecksums>
+    static void update(TChecksums& checksums, std::size_t step, const std::uint8_t* data, std::size_t len)
+    {
+        if (step != 0U) {
+            NextPlan::update(checksums, step - 1U, data, len);
+        }
+    }
+};
+
+template <
+    typename TField,
+    typename TMessage,
+    typename TAllMessages,
+    typename TNextLayer,
+    std::size_t TChecksumIdx,
+    typename... TOptions>
+struct ChunkedWriterLayerPlan<
+    comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>,
+    TChecksumIdx>
+{
+    using Layer = comms::protocol::MsgIdLayer<TField, TMessage, TAllMessages, TNextLayer, TOptions...>;
+    using NextPlan = ChunkedWriterPlan<TNextLayer, TChecksumIdx>;
+    using Checksums = typename NextPlan::Checksums;
+    static const std::size_t StepsCount = 1U + NextPlan::StepsCount;
+
+    template <typename TWriter, typename TMsg>
+    static bool writeStep(TWriter& writer, const Layer& layer, const TMsg& msg, std::size_t step)
+    {
+        if (step == 0U) {
+            TField field;
+            field.value() = static_cast<typename TField::ValueType>(msg.doGetId());
+            return writer.writeField(field);
+        }
+
+        return NextPlan::writeStep(writer, layer.nextLayer(), msg, step - 1U);
+    }
+
+    template <typename TChecksums>
+    static void update(TChecksums& checksums, std::size_t step, const std::uint8_t* data, std::size_t len)
+    {
+        if (step != 0U) {
+            NextPlan::update(checksums, step - 1U, data, len);
+        }
+    }
+};
+
+// Starts the calculation (first step), writes the wrapped layers and
+// the calculated checksum (last step). The calculation state is carried
+// by the writer between the calls.
+template <typename TField, typename TCalc, typename TNextLayer, std::size_t TChecksumIdx, typename... TOptions>
+struct ChunkedWriterLayerPlan<comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>, TChecksumIdx>
+{
+    using Layer = comms::protocol::ChecksumLayer<TField, TCalc, TNextLayer, TOptions...>;
+    using NextPlan = ChunkedWriterPlan<TNextLayer, TChecksumIdx + 1U>;
+    using State = typename std::decay<decltype(TCalc::init())>::type;
+    using Checksums =
+        decltype(std::tuple_cat(std::declval<std::tuple<State> >(), std::declval<typename NextPlan::Checksums>()));
+    static const std::size_t StepsCount = 2U + NextPlan::StepsCount;
+
+    template <typename TWriter, typename TMsg>
+    static bool writeStep(TWriter& writer, const Layer& layer, const TMsg& msg, std::size_t step)
+    {
+        auto& state = std::get<TChecksumIdx>(writer.checksums());
+        if (step == 0U) {
+            state = TCalc::init();
+            return true;
+        }
+
+        if (step <= NextPlan::StepsCount) {
+            return NextPlan::writeStep(writer, layer.nextLayer(), msg, step - 1U);
+        }
+
+        TField field;
+        field.value() = static_cast<typename TField::ValueType>(TCalc().finalise(state));
+        return writer.writeField(field);
+    }
+
+    template <typename TChecksums>
+    static void update(TChecksums& checksums, std::size_t step, const std::uint8_t* data, std::size_t len)
+    {
+        if ((step == 0U) || (NextPlan::StepsCount < step)) {
+            return;
+        }
+
+        auto& state = std::get<TChecksumIdx>(checksums);
+        auto iter = data;
+        state = TCalc().update(state, iter, len);
+        NextPlan::update(checksums, step - 1U, data, len);
+    }
+};
+
+template <std::size_t TChecksumIdx, typename... TOptions>
+struct ChunkedWriterLayerPlan<comms::protocol::MsgDataLayer<TOptions...>, TChecksumIdx>
+{
+    using Layer = comms::protocol::MsgDataLayer<TOptions...>;
+    using Checksums = std::tuple<>;
+    static const std::size_t StepsCount = 1U;
+
+    template <typename TWriter, typename TMsg>
+    static bool writeStep(TWriter& writer, const Layer& layer, const TMsg& msg, std::size_t step)
+    {
+        static_cast<void>(layer);
+        static_cast<void>(step);
+        COMMS_ASSERT(step == 0U);
+        return writer.writeFields(msg.fields());
+    }
+
+    template <typename TChecksums>
+    static void update(TChecksums& checksums, std::size_t step, const std::uint8_t* data, std::size_t len)
+    {
+        static_cast<void>(checksums);
+        static_cast<void>(step);
+        static_cast<void>(data);
+        static_cast<void>(len);
+    }
+};
+
+} // namespace details
+
+/// @brief Resumable serialisation of the frames into the fixed size
+///     output buffers.
+/// @details Allows serialisation of the frames, which are too long to
+///     fit into a single output buffer (for example messages with
+///     large lists of raw data). Every call to @ref write() fills the
+///     provided output buffer with the next portion of the frame and
+///     returns when the buffer is full, even if it happens in the middle
+///     of a field. The next call to @ref write() (potentially with a
+///     different buffer) continues from that place.
+///     @code
+///     comms::util::ChunkedWriter<ProtStack> writer;
+///     do {
+///         auto es = writer.write(stack, msg, buf, bufSize);
+///         if (es != comms::ErrorStatus::Success) {
+///             ... // handle error
+///             break;
+///         }
+///
+///         sendData(buf, writer.writtenBytes());
+///     } while (!writer.complete());
+///     @endcode
+///     The stack and the message must not be modified until the frame
+///     is complete (or @ref reset() is invoked).
+///
+///     The writer records the layer, the message field and the element
+///     of the sequence field (@ref comms::field::ArrayList or
+///     @ref comms::field::String) being written, as well as the number
+///     of already produced bytes of the current field (or element).
+///     The next call resumes from there without re-serialising the
+///     preceding data, i.e. the cost of every call is proportional to
+///     the size of the output buffer rather than to the frame length.
+///     The sequences of single byte integral values are copied in bulk.
+///
+///     The values of the transport fields are expected to be known up front:
+///     @li @ref comms::protocol::MsgSizeLayer writes the length reported
+///         by the wrapped layers.
+///     @li @ref comms::protocol::MsgIdLayer writes the numeric ID of
+///         the message.
+///     @li @ref comms::protocol::ChecksumLayer updates the checksum with
+///         every portion of the wrapped data written into the output buffer
+///         and carries the intermediate value to the next call.
+///         It requires the checksum calculator to provide @b init(),
+///         @b update() and @b finalise() member functions (all the
+///         calculators from comms::protocol::checksum namespace do).
+///
+///     Only @ref comms::protocol::SyncPrefixLayer, @ref comms::protocol::MsgSizeLayer,
+///     @ref comms::protocol::MsgIdLayer, @ref comms::protocol::ChecksumLayer
+///     and @ref comms::protocol::MsgDataLayer (as well as the classes
+///     extending them) are supported. The customisations of the field
+///     value preparation in the extending classes are not applied.
+///     The sequence fields are resumed element by element only when they
+///     are direct members of the message and have no options which
+///     affect serialisation of the elements (such as fixed size, suffixes
+///     or element prefixes), the rest of the fields are resumed by
+///     re-serialising them and skipping the already produced bytes.
+/// @tparam TStack Protocol stack (top layer) type.
+/// @headerfile comms/util/ChunkedWriter.h
+template <typename TStack>
+class ChunkedWriter
+{
+    using Plan = details::ChunkedWriterPlan<TStack>;
+
+public:
+    /// @brief Write the next portion of the frame.
+    /// @details Stores the bytes following the ones produced by the previous
+    ///     invocations into the provided buffer. Upon successful return,
+    ///     @ref writtenBytes() reports the number of bytes stored in the buffer
+    ///     and @ref complete() reports whether it was the last portion of
+    ///     the frame. In case the previous frame has been completed, the
+    ///     write of a new frame is started. In case of failure, the state of
+    ///     the writer is reset, the portions of the frame returned prior
+    ///     to the failure are expected to be discarded by the caller.
+    /// @tparam TMsg Type of the message, expected to be the actual message
+    ///     type (extending @ref comms::MessageBase).
+    /// @param[in] stack Protocol stack object.
+    /// @param[in] msg Message object.
+    /// @param[out] buf Output buffer.
+    /// @param[in] size Size of the output buffer, must be greater than 0.
+    /// @param[in] maxLen Maximal allowed length of the whole frame.
+    /// @return Status of the write operation, comms::ErrorStatus::BufferOverflow
+    ///     is returned when the frame is longer than @b maxLen.
+    template <typename TMsg>
+    comms::ErrorStatus write(
+        const TStack& stack,
+        const TMsg& msg,
+        std::uint8_t* buf,
+        std::size_t size,
+        std::size_t maxLen = std::numeric_limits<std::size_t>::max())
+    {
+        COMMS_ASSERT(buf != nullptr);
+        COMMS_ASSERT(0U < size);
+        if (complete_) {
+            reset();
+        }
+
+        if (!started_) {
+            total_ = stack.length(msg);
+            if (maxLen < total_) {
+                reset();
+                return comms::ErrorStatus::BufferOverflow;
+            }
+
+            started_ = true;
+        }
+
+        buf_ = buf;
+        size_ = size;
+        pos_ = 0U;
+        updatePos_ = 0U;
+        es_ = comms::ErrorStatus::Success;
+
+        while (step_ < Plan::StepsCount) {
+            bool stepDone = Plan::writeStep(*this, stack, msg, step_);
+            updateChecksums();
+            if (es_ != comms::ErrorStatus::Success) {
+                auto es = es_;
+                reset();
+                return es;
+            }
+
+            if (!stepDone) {
+                break;
+            }
+
+            ++step_;
+            field_ = 0U;
+            elem_ = 0U;
+            skip_ = 0U;
+            prefixDone_ = false;
+        }
+
+        offset_ += pos_;
+        complete_ = (Plan::StepsCount <= step_);
+        COMMS_ASSERT((!complete_) || (offset_ == total_));
+        buf_ = nullptr;
+        size_ = 0U;
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Number of bytes stored in the output buffer by the
+    ///     last call to @ref write().
+    std::size_t writtenBytes() const
+    {
+        return pos_;
+    }
+
+    /// @brief Number of bytes of the current frame produced so far.
+    std::size_t frameOffset() const
+    {
+        return offset_;
+    }
+
+    /// @brief Full length of the current frame, known after the
+    ///     first call to @ref write().
+    std::size_t frameLength() const
+    {
+        return total_;
+    }
+
+    /// @brief Check whether the last call to @ref write() has produced
+    ///     the last portion of the frame.
+    bool complete() const
+    {
+        return complete_;
+    }
+
+    /// @brief Abandon the current frame, the next call to
+    ///     @ref write() starts from the beginning of the frame.
+    void reset()
+    {
+        buf_ = nullptr;
+        size_ = 0U;
+        pos_ = 0U;
+        updatePos_ = 0U;
+        total_ = 0U;
+        offset_ = 0U;
+        step_ = 0U;
+        field_ = 0U;
+        elem_ = 0U;
+        skip_ = 0U;
+        prefixDone_ = false;
+        started_ = false;
+        complete_ = false;
+        checksums_ = Checksums();
+    }
+
+private:
+    template <typename, std::size_t>
+    friend struct details::ChunkedWriterLayerPlan;
+
+    using Checksums = typename Plan::Checksums;
+
+    template <typename... TParams>
+    using HasFieldTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using NoFieldTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using SequenceTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FieldTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using SizePrefixTag = comms::details::tag::Tag5<>;
+
+    template <typename... TParams>
+    using SerLengthPrefixTag = comms::details::tag::Tag6<>;
+
+    template <typename... TParams>
+    using NoPrefixTag = comms::details::tag::Tag7<>;
+
+    template <typename... TParams>
+    using ByteElemTag = comms::details::tag::Tag8<>;
+
+    template <typename... TParams>
+    using RawElemTag = comms::details::tag::Tag9<>;
+
+    template <typename... TParams>
+    using FieldElemTag = comms::details::tag::Tag10<>;
+
+    template <typename TField>
+    using PrefixTag =
+        typename std::conditional<
+            TField::ParsedOptions::HasSequenceSizeFieldPrefix,
+            SizePrefixTag<>,
+            typename std::conditional<
+                TField::ParsedOptions::HasSequenceSerLengthFieldPrefix,
+                SerLengthPrefixTag<>,
+                NoPrefixTag<>
+            >::type
+        >::type;
+
+    template <typename TField, typename TElem = typename std::decay<decltype(std::declval<TField>().value()[0])>::type>
+    using ElemTag =
+        typename std::conditional<
+            std::is_integral<TElem>::value && (sizeof(TElem) == sizeof(std::uint8_t)),
+            ByteElemTag<>,
+            typename std::conditional<
+                std::is_integral<TElem>::value,
+                RawElemTag<>,
+                FieldElemTag<>
+            >::type
+        >::type;
+
+    Checksums& checksums()
+    {
+        return checksums_;
+    }
+
+    void updateChecksums()
+    {
+        if (updatePos_ < pos_) {
+            Plan::update(checksums_, step_, buf_ + updatePos_, pos_ - updatePos_);
+        }
+
+        updatePos_ = pos_;
+    }
+
+    template <typename TFunc>
+    bool writeUnit(const TFunc& func)
+    {
+        details::ChunkedWriterUnit unit;
+        unit.buf_ = buf_;
+        unit.pos_ = &pos_;
+        unit.size_ = size_;
+        unit.skip_ = skip_;
+
+        details::ChunkedWriterUnitIterator iter(unit);
+        auto es = func(iter);
+        if (es != comms::ErrorStatus::Success) {
+            es_ = es;
+            return false;
+        }
+
+        if (unit.done_ < unit.count_) {
+            skip_ = unit.done_;
+            return false;
+        }
+
+        skip_ = 0U;
+        return true;
+    }
+
+    template <typename TField>
+    bool writeField(const TField& field)
+    {
+        return writeUnit(details::ChunkedWriterFieldUnit<TField>(field));
+    }
+
+    template <typename TFields>
+    bool writeFields(const TFields& fields)
+    {
+        return writeFieldsFrom<0U>(fields);
+    }
+
+    template <std::size_t TIdx, typename TFields>
+    bool writeFieldsFrom(const TFields& fields)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                TIdx < std::tuple_size<TFields>::value
+            >::template Type<
+                HasFieldTag,
+                NoFieldTag
+            >;
+        return writeFieldsFrom<TIdx>(fields, Tag());
+    }
+
+    template <std::size_t TIdx, typename TFields, typename... TParams>
+    bool writeFieldsFrom(const TFields& fields, NoFieldTag<TParams...>)
+    {
+        static_cast<void>(fields);
+        return true;
+    }
+
+    template <std::size_t TIdx, typename TFields, typename... TParams>
+    bool writeFieldsFrom(const TFields& fields, HasFieldTag<TParams...>)
+    {
+        if (field_ == TIdx) {
+            if (!writeMsgField(std::get<TIdx>(fields))) {
+                return false;
+            }
+
+            ++field_;
+            elem_ = 0U;
+            prefixDone_ = false;
+        }
+
+        return writeFieldsFrom<TIdx + 1U>(fields);
+    }
+
+    template <typename TField>
+    bool writeMsgField(const TField& field)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                details::ChunkedWriterIsSplitSequence<TField>::Value
+            >::template Type<
+                SequenceTag,
+                FieldTag
+            >;
+        return writeMsgField(field, Tag());
+    }
+
+    template <typename TField, typename... TParams>
+    bool writeMsgField(const TField& field, FieldTag<TParams...>)
+    {
+        return writeField(field);
+    }
+
+    template <typename TField, typename... TParams>
+    bool writeMsgField(const TField& field, SequenceTag<TParams...>)
+    {
+        if (!prefixDone_) {
+            if (!writePrefix(field, PrefixTag<TField>())) {
+                return false;
+            }
+
+            prefixDone_ = true;
+        }
+
+        return writeElements(field, ElemTag<TField>());
+    }
+
+    template <typename TField, typename... TParams>
+    bool writePrefix(const TField& field, NoPrefixTag<TParams...>)
+    {
+        static_cast<void>(field);
+        return true;
+    }
+
+    template <typename TField, typename... TParams>
+    bool writePrefix(const TField& field, SizePrefixTag<TParams...>)
+    {
+        using PrefixField = typename TField::ParsedOptions::SequenceSizeFieldPrefix;
+        PrefixField prefix;
+        prefix.value() = static_cast<typename PrefixField::ValueType>(field.value().size());
+        return writeField(prefix);
+    }
+
+    template <typename TField, typename... TParams>
+    bool writePrefix(const TField& field, SerLengthPrefixTag<TParams...>)
+    {
+        using PrefixField = typename TField::ParsedOptions::SequenceSerLengthFieldPrefix;
+        PrefixField prefix;
+        prefix.value() = static_cast<typename PrefixField::ValueType>(elementsLength(field, ElemTag<TField>()));
+        return writeField(prefix);
+    }
+
+    template <typename TField, typename... TParams>
+    static std::size_t elementsLength(const TField& field, ByteElemTag<TParams...>)
+    {
+        return static_cast<std::size_t>(field.value().size());
+    }
+
+    template <typename TField, typename... TParams>
+    static std::size_t elementsLength(const TField& field, RawElemTag<TParams...>)
+    {
+        using Elem = typename std::decay<decltype(field.value()[0])>::type;
+        return static_cast<std::size_t>(field.value().size()) * sizeof(Elem);
+    }
+
+    template <typename TField, typename... TParams>
+    static std::size_t elementsLength(const TField& field, FieldElemTag<TParams...>)
+    {
+        std::size_t result = 0U;
+        for (auto& elem : field.value()) {
+            result += elem.length();
+        }
+        return result;
+    }
+
+    template <typename TField, typename... TParams>
+    bool writeElements(const TField& field, ByteElemTag<TParams...>)
+    {
+        COMMS_ASSERT(skip_ == 0U);
+        auto& elems = field.value();
+        auto count = static_cast<std::size_t>(elems.size());
+        while (elem_ < count) {
+            if (size_ <= pos_) {
+                return false;
+            }
+
+            auto len = std::min(count - elem_, size_ - pos_);
+            for (std::size_t idx = 0U; idx < len; ++idx) {
+                buf_[pos_ + idx] = static_cast<std::uint8_t>(elems[elem_ + idx]);
+            }
+
+            pos_ += len;
+            elem_ += len;
+        }
+
+        return true;
+    }
+
+    template <typename TField, typename... TParams>
+    bool writeElements(const TField& field, RawElemTag<TParams...>)
+    {
+        using Elem = typename std::decay<decltype(field.value()[0])>::type;
+        using Unit = details::ChunkedWriterRawUnit<Elem, typename TField::Endian>;
+        auto& elems = field.value();
+        auto count = static_cast<std::size_t>(elems.size());
+        for (; elem_ < count; ++elem_) {
+            if (!writeUnit(Unit(elems[elem_]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename TField, typename... TParams>
+    bool writeElements(const TField& field, FieldElemTag<TParams...>)
+    {
+        auto& elems = field.value();
+        auto count = static_cast<std::size_t>(elems.size());
+        for (; elem_ < count; ++elem_) {
+            if (!writeField(elems[elem_])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::uint8_t* buf_ = nullptr;
+    std::size_t size_ = 0U;
+    std::size_t pos_ = 0U;
+    std::size_t updatePos_ = 0U; // Bytes of the buffer reported to the checksums
+    std::size_t total_ = 0U;
+    std::size_t offset_ = 0U;
+    std::size_t step_ = 0U; // Current write step of the layers
+    std::size_t field_ = 0U; // Current message field
+    std::size_t elem_ = 0U; // Current element of the sequence field
+    std::size_t skip_ = 0U; // Already produced bytes of the current field / element
+    Checksums checksums_;
+    comms::ErrorStatus es_ = comms::ErrorStatus::Success;
+    bool prefixDone_ = false;
+    bool started_ = false;
+    bool complete_ = false;
+};
+
+} // namespace util
+
+} // namespace comms
@@ -0,0 +1,202 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// Contains definition of @ref comms::util::LatencyHistogram class
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Lock-free histogram with log-linear buckets.
+/// @details Every value below @b 2^(TSubBucketBits+1) has its own bucket,
+///     while every following power of two range is split into @b 2^TSubBucketBits
+///     equally sized buckets, i.e. the relative error of the reported
+///     values doesn't exceed @b 1/2^TSubBucketBits. All the updates are
+///     performed using relaxed atomic operations and may be invoked from
+///     multiple threads concurrently.
+/// @tparam TSubBucketBits Number of bits used to split every power of two range.
+/// @headerfile comms/util/LatencyHistogram.h
+template <unsigned TSubBucketBits = 2U>
+class LatencyHistogram
+{
+    static_assert(TSubBucketBits < 8U, "Too many sub-buckets");
+    static const std::size_t SubBucketsCount = static_cast<std::size_t>(1U) << TSubBucketBits;
+    static const std::size_t BucketsCount = (65U - TSubBucketBits) * SubBucketsCount;
+
+public:
+    /// @brief Type of the recorded value.
+    using ValueType = std::uint64_t;
+
+    /// @brief Default constructor
+    LatencyHistogram()
+    {
+        clear();
+    }
+
+    /// @brief Copy constructor is deleted
+    LatencyHistogram(const LatencyHistogram&) = delete;
+
+    /// @brief Copy assignment is deleted
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /// @brief Number of sub-buckets in every power of two range.
+    static constexpr std::size_t subBucketsCount()
+    {
+        return SubBucketsCount;
+    }
+
+    /// @brief Total number of buckets.
+    static constexpr std::size_t bucketsCount()
+    {
+        return BucketsCount;
+    }
+
+    /// @brief Record new value.
+    void record(ValueType value)
+    {
+        m_buckets[bucketIdx(value)].fetch_add(1U, std::memory_order_relaxed);
+        m_count.fetch_add(1U, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        auto currMax = m_max.load(std::memory_order_relaxed);
+        while ((currMax < value) &&
+               (!m_max.compare_exchange_weak(currMax, value, std::memory_order_relaxed))) {}
+    }
+
+    /// @brief Reset all the recorded values.
+    /// @details Not expected to be invoked concurrently with @ref record().
+    void clear()
+    {
+        for (auto& b : m_buckets) {
+            b.store(0U, std::memory_order_relaxed);
+        }
+
+        m_count.store(0U, std::memory_order_relaxed);
+        m_sum.store(0U, std::memory_order_relaxed);
+        m_max.store(0U, std::memory_order_relaxed);
+    }
+
+    /// @brief Number of recorded values.
+    std::uint64_t count() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Sum of all the recorded values.
+    ValueType sum() const
+    {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Max recorded value.
+    ValueType max() const
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of values recorded in the specified bucket.
+    std::uint64_t bucketCount(std::size_t idx) const
+    {
+        return m_buckets[idx].load(std::memory_order_relaxed);
+    }
+
+    /// @brief Approximate value below which the requested percent of the
+    ///     recorded values fall.
+    /// @param[in] pct Percentile in range [0, 100].
+    /// @return Upper bound of the bucket containing the requested percentile,
+    ///     but not greater than @ref max(), @b 0 when no values were recorded.
+    ValueType percentile(double pct) const
+    {
+        auto total = count();
+        if (total == 0U) {
+            return 0U;
+        }
+
+        auto threshold = static_cast<std::uint64_t>((static_cast<double>(total) * pct) / 100.0);
+        if (threshold == 0U) {
+            threshold = 1U;
+        }
+
+        std::uint64_t accumulated = 0U;
+        auto maxValue = max();
+        for (std::size_t idx = 0U; idx < bucketsCount(); ++idx) {
+            accumulated += bucketCount(idx);
+            if (accumulated < threshold) {
+                continue;
+            }
+
+            if ((bucketsCount() - 1U) <= idx) {
+                return maxValue;
+            }
+
+            auto upper = bucketLowerBound(idx + 1U) - 1U;
+            if (maxValue < upper) {
+                return maxValue;
+            }
+
+            return upper;
+        }
+
+        return maxValue;
+    }
+
+    /// @brief Index of the bucket the value belongs to.
+    static std::size_t bucketIdx(ValueType value)
+    {
+        if (value < (2U * subBucketsCount())) {
+            return static_cast<std::size_t>(value);
+        }
+
+        auto msb = msbIdx(value);
+        auto shift = msb - TSubBucketBits;
+        auto sub = static_cast<std::size_t>((value >> shift) & (subBucketsCount() - 1U));
+        return ((shift + 1U) * subBucketsCount()) + sub;
+    }
+
+    /// @brief Minimal value that belongs to the specified bucket.
+    static ValueType bucketLowerBound(std::size_t idx)
+    {
+        if (idx < (2U * subBucketsCount())) {
+            return static_cast<ValueType>(idx);
+        }
+
+        auto shift = static_cast<unsigned>((idx / subBucketsCount()) - 1U);
+        auto sub = static_cast<ValueType>(idx % subBucketsCount());
+        return (static_cast<ValueType>(subBucketsCount()) + sub) << shift;
+    }
+
+private:
+    static unsigned msbIdx(ValueType value)
+    {
+        unsigned result = 0U;
+        for (unsigned shift = 32U; 0U < shift; shift /= 2U) {
+            if ((value >> shift) != 0U) {
+                value >>= shift;
+                result += shift;
+            }
+        }
+        return result;
+    }
+
+    std::atomic<std::uint64_t> m_buckets[BucketsCount];
+    std::atomic<std::uint64_t> m_count;
+    std::atomic<ValueType> m_sum;
+    std::atomic<ValueType> m_max;
+};
+
+} // namespace util
+
+} // namespace comms
@@ -20,10 +20,12 @@
 #include <type_traits>
 #include <iterator>
 #include <algorithm>
+#include <cstring>
 
 #include "comms/Assert.h"
 #include "comms/util/SizeToType.h"
 #include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
 
 namespace comms
 {
@@ -34,6 +36,31 @@ namespace util
 namespace details
 {
 
+// Same width integral conversion doesn't change the bits.
+template <typename T, typename U>
+using StaticQueueIsSameRepr =
+    std::integral_constant<
+        bool,
+        std::is_same<T, U>::value ||
+        (std::is_integral<T>::value &&
+         std::is_integral<U>::value &&
+         (!std::is_same<T, bool>::value) &&
+         (!std::is_same<U, bool>::value) &&
+         (sizeof(T) == sizeof(U)))
+    >;
+
+template <typename T, typename TIter>
+using StaticQueueIsBulkCopy =
+    std::integral_constant<
+        bool,
+        std::is_trivial<T>::value &&
+        std::is_pointer<TIter>::value &&
+        StaticQueueIsSameRepr<
+            T,
+            typename std::remove_cv<typename std::iterator_traits<TIter>::value_type>::type
+        >::value
+    >;
+
 template <typename T>
 class StaticQueueBase
 {
@@ -115,9 +142,7 @@ protected:
 
     void clear()
     {
-        while (!empty()) {
-            popFront();
-        }
+        clearInternal(ElemTypeTag<>());
     }
 
     bool empty() const
@@ -182,10 +207,7 @@ protected:
     void popFront(std::size_t count)
     {
         COMMS_ASSERT(count <= size());
-        while ((!empty()) && (count > 0)) {
-            popFront();
-            --count;
-        }
+        popFrontInternal(count, ElemTypeTag<>());
     }
 
     void popBack()
@@ -206,10 +228,7 @@ protected:
     void popBack(std::size_t count)
     {
         COMMS_ASSERT(count <= size());
-        while ((!empty()) && (count > 0)) {
-            popBack();
-            --count;
-        }
+        popBackInternal(count, ElemTypeTag<>());
     }
 
     Reference operator[](std::size_t index)
@@ -386,30 +405,7 @@ protected:
             return;
         }
 
-        auto rangeOne = arrayOne();
-        auto rangeOneSize = std::distance(rangeOne.first, rangeOne.second);
-        COMMS_ASSERT(0 < rangeOneSize);
-        auto rangeTwo = arrayTwo();
-        auto rangeTwoSize = std::distance(rangeTwo.first, rangeTwo.second);
-        COMMS_ASSERT(0 < rangeTwoSize);
-        COMMS_ASSERT((rangeOneSize + rangeTwoSize) == size());
-        auto remSpaceSize = capacity() - size();
-
-        if (rangeTwoSize <= remSpaceSize) {
-            lineariseByMoveOneTwo(rangeOne, rangeTwo);
-            return;
-        }
-
-        if (rangeOneSize <= remSpaceSize) {
-            lineariseByMoveTwoOne(rangeOne, rangeTwo);
-            return;
-        }
-
-        if (rangeOneSize < rangeTwoSize) {
-            lineariseByPopOne();
-        }
-
-        lineariseByPopTwo();
+        lineariseInternal(ElemTypeTag<>());
     }
 
     bool linearised() const
@@ -490,9 +486,9 @@ protected:
         auto rangeTwo = arrayTwo();
 
         auto isInRangeFunc =
-            [](LinearisedIterator pos, const LinearisedIteratorRange range) -> bool
+            [](LinearisedIterator iter, const LinearisedIteratorRange range) -> bool
             {
-                return ((range.first <= pos) && (pos < range.second));
+                return ((range.first <= iter) && (iter < range.second));
             };
 
         COMMS_ASSERT(isInRangeFunc(pos, rangeOne) ||
@@ -629,14 +625,10 @@ protected:
         COMMS_ASSERT(empty());
 
         auto rangeOne = other.arrayOne();
-        for (auto iter = rangeOne.first; iter != rangeOne.second; ++iter) {
-            pushBackNotFull(std::forward<ElemRefType>(*iter));
-        }
+        assignRangeInternal<ElemRefType>(rangeOne.first, rangeOne.second, ElemTypeTag<>());
 
         auto rangeTwo = other.arrayTwo();
-        for (auto iter = rangeTwo.first; iter != rangeTwo.second; ++iter) {
-            pushBackNotFull(std::forward<ElemRefType>(*iter));
-        }
+        assignRangeInternal<ElemRefType>(rangeTwo.first, rangeTwo.second, ElemTypeTag<>());
     }
 
     template <typename U>
@@ -659,6 +651,20 @@ protected:
         emplaceBackNotFull(std::forward<TArgs>(args)...);
     }
 
+    template <typename TIter>
+    void pushBack(TIter from, TIter to)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                StaticQueueIsBulkCopy<ValueType, TIter>::value
+            >::template Type<
+                BulkOpTag,
+                ElemOpTag
+            >;
+
+        pushBackRangeInternal(from, to, Tag());
+    }
+
     template <typename U>
     void pushFront(U&& value)
     {
@@ -734,6 +740,193 @@ protected:
     }
 
 private:
+    template <typename... TParams>
+    using BulkOpTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using ElemOpTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using ElemTypeTag =
+        typename comms::util::LazyShallowConditional<
+            std::is_trivial<ValueType>::value
+        >::template Type<
+            BulkOpTag,
+            ElemOpTag
+        >;
+
+    Pointer rawData()
+    {
+        return reinterpret_cast<Pointer>(&data_[0]);
+    }
+
+    void clearInternal(ElemOpTag<>)
+    {
+        while (!empty()) {
+            popFront();
+        }
+    }
+
+    void clearInternal(BulkOpTag<>)
+    {
+        count_ = 0;
+        startIdx_ = 0;
+    }
+
+    void popFrontInternal(std::size_t count, ElemOpTag<>)
+    {
+        while ((!empty()) && (count > 0)) {
+            popFront();
+            --count;
+        }
+    }
+
+    void popFrontInternal(std::size_t count, BulkOpTag<>)
+    {
+        count = std::min(count, size());
+        count_ -= count;
+        startIdx_ += count;
+        if (capacity() <= startIdx_) {
+            startIdx_ -= capacity();
+        }
+
+        if (empty()) {
+            startIdx_ = 0;
+        }
+    }
+
+    void popBackInternal(std::size_t count, ElemOpTag<>)
+    {
+        while ((!empty()) && (count > 0)) {
+            popBack();
+            --count;
+        }
+    }
+
+    void popBackInternal(std::size_t count, BulkOpTag<>)
+    {
+        count_ -= std::min(count, size());
+    }
+
+    void lineariseInternal(ElemOpTag<>)
+    {
+
+        auto rangeOne = arrayOne();
+        auto rangeOneSize = std::distance(rangeOne.first, rangeOne.second);
+        COMMS_ASSERT(0 < rangeOneSize);
+        auto rangeTwo = arrayTwo();
+        auto rangeTwoSize = std::distance(rangeTwo.first, rangeTwo.second);
+        COMMS_ASSERT(0 < rangeTwoSize);
+        COMMS_ASSERT((rangeOneSize + rangeTwoSize) == size());
+        auto remSpaceSize = capacity() - size();
+
+        if (rangeTwoSize <= remSpaceSize) {
+            lineariseByMoveOneTwo(rangeOne, rangeTwo);
+            return;
+        }
+
+        if (rangeOneSize <= remSpaceSize) {
+            lineariseByMoveTwoOne(rangeOne, rangeTwo);
+            return;
+        }
+
+        if (rangeOneSize < rangeTwoSize) {
+            lineariseByPopOne();
+        }
+
+        lineariseByPopTwo();
+    }
+
+    void lineariseInternal(BulkOpTag<>)
+    {
+        auto rangeOne = arrayOne();
+        auto rangeOneSize = static_cast<std::size_t>(std::distance(rangeOne.first, rangeOne.second));
+        COMMS_ASSERT(0U < rangeOneSize);
+        auto rangeTwo = arrayTwo();
+        auto rangeTwoSize = static_cast<std::size_t>(std::distance(rangeTwo.first, rangeTwo.second));
+        COMMS_ASSERT(0U < rangeTwoSize);
+        COMMS_ASSERT((rangeOneSize + rangeTwoSize) == size());
+        auto remSpaceSize = capacity() - size();
+        auto* dataPtr = rawData();
+        COMMS_ASSERT(rangeTwo.first == dataPtr);
+
+        if (rangeOneSize <= remSpaceSize) {
+            std::memmove(dataPtr + rangeOneSize, dataPtr, rangeTwoSize * sizeof(ValueType));
+            std::memcpy(dataPtr, rangeOne.first, rangeOneSize * sizeof(ValueType));
+            startIdx_ = 0;
+            return;
+        }
+
+        if (rangeTwoSize <= remSpaceSize) {
+            std::memmove(dataPtr + remSpaceSize, rangeOne.first, rangeOneSize * sizeof(ValueType));
+            std::memcpy(dataPtr + remSpaceSize + rangeOneSize, dataPtr, rangeTwoSize * sizeof(ValueType));
+            startIdx_ = remSpaceSize;
+            return;
+        }
+
+        // Close the gap and swap the ranges in place
+        std::memmove(dataPtr + rangeTwoSize, rangeOne.first, rangeOneSize * sizeof(ValueType));
+        std::rotate(dataPtr, dataPtr + rangeTwoSize, dataPtr + size());
+        startIdx_ = 0;
+    }
+
+    template <typename TElemRef, typename TIter>
+    void assignRangeInternal(TIter from, TIter to, ElemOpTag<>)
+    {
+        for (auto iter = from; iter != to; ++iter) {
+            pushBackNotFull(std::forward<TElemRef>(*iter));
+        }
+    }
+
+    template <typename TElemRef, typename TIter>
+    void assignRangeInternal(TIter from, TIter to, BulkOpTag<>)
+    {
+        pushBackBulk(from, to);
+    }
+
+    template <typename TIter>
+    void pushBackRangeInternal(TIter from, TIter to, ElemOpTag<>)
+    {
+        for (; from != to; ++from) {
+            COMMS_ASSERT(!full());
+            if (full()) {
+                return;
+            }
+
+            pushBackNotFull(*from);
+        }
+    }
+
+    template <typename TIter>
+    void pushBackRangeInternal(TIter from, TIter to, BulkOpTag<>)
+    {
+        pushBackBulk(from, to);
+    }
+
+    template <typename TIter>
+    void pushBackBulk(TIter from, TIter to)
+    {
+        auto count = static_cast<std::size_t>(std::distance(from, to));
+        COMMS_ASSERT(count <= (capacity() - size()));
+        count = std::min(count, capacity() - size());
+        if (count == 0U) {
+            return;
+        }
+
+        auto endIdx = startIdx_ + size();
+        if (capacity() <= endIdx) {
+            endIdx -= capacity();
+        }
+
+        auto firstCount = std::min(count, capacity() - endIdx);
+        std::memcpy(rawData() + endIdx, from, firstCount * sizeof(ValueType));
+        if (firstCount < count) {
+            std::memcpy(rawData(), from + firstCount, (count - firstCount) * sizeof(ValueType));
+        }
+
+        count_ += count;
+    }
+
 
     template <typename U>
     void createValueAtIndex(U&& value, std::size_t index)
@@ -795,9 +988,9 @@ private:
             return arrayTwo().second - 1;
         }
 
-        auto isInRangeFunc = [](LinearisedIterator pos, const LinearisedIteratorRange range) -> bool
+        auto isInRangeFunc = [](LinearisedIterator iter, const LinearisedIteratorRange range) -> bool
             {
-                return ((range.first <= pos) && (pos < range.second));
+                return ((range.first <= iter) && (iter < range.second));
             };
 
         COMMS_ASSERT(isInRangeFunc(pos, rangeOne) ||
@@ -1492,6 +1685,12 @@ protected:
         Base::pushBack(reinterpret_cast<BaseConstReference>(value));
     }
 
+    template <typename TIter>
+    void pushBack(TIter from, TIter to)
+    {
+        Base::pushBack(from, to);
+    }
+
     void pushFront(ConstReference value)
     {
         Base::pushFront(reinterpret_cast<BaseConstReference>(value));
@@ -1725,7 +1924,7 @@ protected:
 template <typename T>
 class StaticQueueBaseOptimised : public StaticQueueBase<T>
 {
-    usign Base = StaticQueueBase<T>;
+    using Base = StaticQueueBase<T>;
 protected:
 
     using StorageTypePtr = typename Base::StorageTypePtr;
@@ -1801,7 +2000,7 @@ class StaticQueueBaseOptimised<std::int64_t> : public CastWrapperQueueBase<std::
     using Base = CastWrapperQueueBase<std::int64_t, std::uint64_t>;
 protected:
 
-    using StorageTypePtr = stypename Base::StorageTypePtr;
+    using StorageTypePtr = typename Base::StorageTypePtr;
 
     StaticQueueBaseOptimised(StorageTypePtr data, std::size_t capacity)
         : Base(data, capacity)
@@ -1819,7 +2018,7 @@ class StaticQueueBaseOptimised<T*> : public CastWrapperQueueBase<T*, typename co
     using Base = CastWrapperQueueBase<T*, typename comms::util::SizeToType<sizeof(T*)>::Type>;
 protected:
 
-    using Base = typename Base::StorageTypePtr;
+    using StorageTypePtr = typename Base::StorageTypePtr;
 
     StaticQueueBaseOptimised(StorageTypePtr data, std::size_t capacity)
         : Base(data, capacity)
@@ -2214,6 +2413,23 @@ public:
         Base::pushBack(std::forward<U>(value));
     }
 
+    /// @brief Add range of elements to the end of the queue.
+    /// @details Trivial element types are copied in bulk (using
+    ///     @b std::memcpy()) when the range is specified by pointers.
+    ///     Otherwise the elements are copied one by one.
+    /// @param[in] from Iterator to the first element of the range.
+    /// @param[in] to Iterator past the last element of the range.
+    /// @pre The queue has enough space to store all the elements, i.e.
+    ///     @code std::distance(from, to) <= (capacity() - size()) @endcode
+    /// @note Thread safety: Unsafe
+    /// @note Exception guarantee: No throw in case the copy constructor
+    ///       of the stored elements doesn't throw. Basic guarantee otherwise.
+    template <typename TIter>
+    void pushBack(TIter from, TIter to)
+    {
+        Base::pushBack(from, to);
+    }
+
     /// @brief Construct new element at the end of the queue.
     /// @details Passes all the provided arguments to the constructor of the
     ///          element.
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <array>
 #include <algorithm>
 #include <iterator>
@@ -15,6 +16,8 @@
 
 #include "comms/CompileControl.h"
 #include "comms/Assert.h"
+#include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
 
 namespace comms
 {
@@ -25,6 +28,32 @@ namespace util
 namespace details
 {
 
+// Same width integral conversion doesn't change the bits, the
+// signed types are stored as unsigned ones anyway.
+template <typename T, typename U>
+using StaticVectorIsSameRepr =
+    std::integral_constant<
+        bool,
+        std::is_same<T, U>::value ||
+        (std::is_integral<T>::value &&
+         std::is_integral<U>::value &&
+         (!std::is_same<T, bool>::value) &&
+         (!std::is_same<U, bool>::value) &&
+         (sizeof(T) == sizeof(U)))
+    >;
+
+template <typename T, typename TIter>
+using StaticVectorIsBulkCopy =
+    std::integral_constant<
+        bool,
+        std::is_trivial<T>::value &&
+        std::is_pointer<TIter>::value &&
+        StaticVectorIsSameRepr<
+            T,
+            typename std::remove_cv<typename std::iterator_traits<TIter>::value_type>::type
+        >::value
+    >;
+
 template <typename T>
 class StaticVectorBase
 {
@@ -113,35 +142,24 @@ public:
     template <typename TIter>
     void assign(TIter from, TIter to)
     {
-        clear();
-        for (auto iter = from; iter != to; ++iter) {
-            if (capacity() <= size()) {
-                static constexpr bool Not_all_elements_are_copied = false;
-                static_cast<void>(Not_all_elements_are_copied);
-                COMMS_ASSERT(Not_all_elements_are_copied);
-                return;
-            }
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                StaticVectorIsBulkCopy<T, TIter>::value
+            >::template Type<
+                BulkOpTag,
+                ElemOpTag
+            >;
 
-            new (cellPtr(size())) T(*(reinterpret_cast<const T*>(&*iter)));
-            ++size_;
-        }
+        assignInternal(from, to, Tag());
     }
 
     void fill(std::size_t count, const T& value)
     {
-        clear();
-        COMMS_ASSERT(count <= capacity());
-        for (auto idx = 0U; idx < count; ++idx) {
-            new (cellPtr(idx)) T(value);
-        }
-        size_ = count;
+        fillInternal(count, value, ElemTypeTag<>());
     }
 
     void clear() {
-        for (auto idx = 0U; idx < size(); ++idx) {
-            elem(idx).~T();
-        }
-        size_ = 0;
+        clearInternal(ElemTypeTag<>());
     }
 
 
@@ -229,6 +247,208 @@ public:
     {
         COMMS_ASSERT(pos <= end());
         COMMS_ASSERT((size() + count) <= capacity());
+        if (count == 0U) {
+            return begin() + std::distance(cbegin(), pos);
+        }
+
+        return insertInternal(pos, count, value, ElemTypeTag<>());
+    }
+
+    template <typename TIter>
+    T* insert(const T* pos, TIter from, TIter to)
+    {
+        using IterCategory = typename std::iterator_traits<TIter>::iterator_category;
+        using Tag =
+            typename comms::util::Conditional<
+                StaticVectorIsBulkCopy<T, TIter>::value
+            >::template Type<
+                BulkOpTag<>,
+                IterCategory
+            >;
+        return insert_internal(pos, from, to, Tag());
+    }
+
+    template <typename... TArgs>
+    T* emplace(const T* iter, TArgs&&... args)
+    {
+        auto* insertIter = begin() + std::distance(cbegin(), iter);
+        if (iter == cend()) {
+            emplace_back(std::forward<TArgs>(args)...);
+            return insertIter;
+        }
+
+        COMMS_ASSERT(!empty());
+        push_back(std::move(back()));
+        std::move_backward(insertIter, end() - 2, end() - 1);
+        insertIter->~T();
+        new (insertIter) T(std::forward<TArgs>(args)...);
+        return insertIter;
+    }
+
+    T* erase(const T* from, const T* to)
+    {
+        COMMS_ASSERT(from <= cend());
+        COMMS_ASSERT(to <= cend());
+        COMMS_ASSERT(from <= to);
+        if (from == to) {
+            return begin() + std::distance(cbegin(), from);
+        }
+
+        return eraseInternal(from, to, ElemTypeTag<>());
+    }
+
+    template <typename U>
+    void push_back(U&& value)
+    {
+        COMMS_ASSERT(size() < capacity());
+        new (cellPtr(size())) T(std::forward<U>(value));
+        ++size_;
+    }
+
+    template <typename... TArgs>
+    void emplace_back(TArgs&&... args)
+    {
+        COMMS_ASSERT(size() < capacity());
+        new (cellPtr(size())) T(std::forward<TArgs>(args)...);
+        ++size_;
+    }
+
+    void resize(std::size_t count, const T& value)
+    {
+        if (count < size()) {
+            erase(begin() + count, end());
+            COMMS_ASSERT(count == size());
+            return;
+        }
+
+        insert(end(), count - size(), value);
+    }
+
+    void swap(StaticVectorBase<T>& other)
+    {
+        swapInternal(other, ElemTypeTag<>());
+    }
+
+private:
+    CellType& cell(std::size_t idx)
+    {
+        COMMS_ASSERT(idx < capacity());
+        return data_[idx];
+    }
+
+    const CellType& cell(std::size_t idx) const
+    {
+        COMMS_ASSERT(idx < capacity());
+        return data_[idx];
+    }
+
+    CellType* cellPtr(std::size_t idx)
+    {
+        COMMS_ASSERT(idx < capacity());
+        return &data_[idx];
+    }
+
+    T& elem(std::size_t idx)
+    {
+        return reinterpret_cast<T&>(cell(idx));
+    }
+
+    const T& elem(std::size_t idx) const
+    {
+        return reinterpret_cast<const T&>(cell(idx));
+    }
+
+    template <typename... TParams>
+    using BulkOpTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using ElemOpTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using ElemTypeTag =
+        typename comms::util::LazyShallowConditional<
+            std::is_trivial<T>::value
+        >::template Type<
+            BulkOpTag,
+            ElemOpTag
+        >;
+
+    T* rawData()
+    {
+        return reinterpret_cast<T*>(data_);
+    }
+
+    template <typename TIter>
+    void assignInternal(TIter from, TIter to, ElemOpTag<>)
+    {
+        clear();
+        for (auto iter = from; iter != to; ++iter) {
+            if (capacity() <= size()) {
+                static constexpr bool Not_all_elements_are_copied = false;
+                static_cast<void>(Not_all_elements_are_copied);
+                COMMS_ASSERT(Not_all_elements_are_copied);
+                return;
+            }
+
+            new (cellPtr(size())) T(*iter);
+            ++size_;
+        }
+    }
+
+    template <typename TIter>
+    void assignInternal(TIter from, TIter to, BulkOpTag<>)
+    {
+        clear();
+        auto count = static_cast<std::size_t>(std::distance(from, to));
+        if (capacity() < count) {
+            static constexpr bool Not_all_elements_are_copied = false;
+            static_cast<void>(Not_all_elements_are_copied);
+            COMMS_ASSERT(Not_all_elements_are_copied);
+            count = capacity();
+        }
+
+        if (count == 0U) {
+            return;
+        }
+
+        std::memmove(rawData(), from, count * sizeof(T));
+        size_ = count;
+    }
+
+    void fillInternal(std::size_t count, const T& value, ElemOpTag<>)
+    {
+        clear();
+        COMMS_ASSERT(count <= capacity());
+        for (auto idx = 0U; idx < count; ++idx) {
+            new (cellPtr(idx)) T(value);
+        }
+        size_ = count;
+    }
+
+    void fillInternal(std::size_t count, const T& value, BulkOpTag<>)
+    {
+        T valueCopy(value);
+        clear();
+        COMMS_ASSERT(count <= capacity());
+        std::fill_n(rawData(), count, valueCopy);
+        size_ = count;
+    }
+
+    void clearInternal(ElemOpTag<>)
+    {
+        for (auto idx = 0U; idx < size(); ++idx) {
+            elem(idx).~T();
+        }
+        size_ = 0;
+    }
+
+    void clearInternal(BulkOpTag<>)
+    {
+        size_ = 0;
+    }
+
+    T* insertInternal(const T* pos, std::size_t count, const T& value, ElemOpTag<>)
+    {
         auto* posIter = begin() + std::distance(cbegin(), pos);
         if (end() <= posIter) {
             while (0 < count) {
@@ -279,36 +499,19 @@ public:
         return posIter;
     }
 
-    template <typename TIter>
-    T* insert(const T* pos, TIter from, TIter to)
-    {
-        using Tag = typename std::iterator_traits<TIter>::iterator_category;
-        return insert_internal(pos, from, to, Tag());
-    }
-
-    template <typename... TArgs>
-    T* emplace(const T* iter, TArgs&&... args)
+    T* insertInternal(const T* pos, std::size_t count, const T& value, BulkOpTag<>)
     {
-        auto* insertIter = begin() + std::distance(cbegin(), iter);
-        if (iter == cend()) {
-            emplace_back(std::forward<TArgs>(args)...);
-            return insertIter;
-        }
-
-        COMMS_ASSERT(!empty());
-        push_back(std::move(back()));
-        std::move_backward(insertIter, end() - 2, end() - 1);
-        insertIter->~T();
-        new (insertIter) T(std::forward<TArgs>(args)...);
-        return insertIter;
+        T valueCopy(value);
+        auto* posIter = begin() + std::distance(cbegin(), pos);
+        auto tailCount = static_cast<std::size_t>(std::distance(posIter, end()));
+        std::memmove(posIter + count, posIter, tailCount * sizeof(T));
+        std::fill_n(posIter, count, valueCopy);
+        size_ += count;
+        return posIter;
     }
 
-    T* erase(const T* from, const T* to)
+    T* eraseInternal(const T* from, const T* to, ElemOpTag<>)
     {
-        COMMS_ASSERT(from <= cend());
-        COMMS_ASSERT(to <= cend());
-        COMMS_ASSERT(from <= to);
-
         auto tailCount = static_cast<std::size_t>(std::distance(to, cend()));
         auto eraseCount = static_cast<std::size_t>(std::distance(from, to));
 
@@ -328,36 +531,17 @@ public:
         return moveDest;
     }
 
-    template <typename U>
-    void push_back(U&& value)
-    {
-        COMMS_ASSERT(size() < capacity());
-        new (cellPtr(size())) T(std::forward<U>(value));
-        ++size_;
-    }
-
-    template <typename... TArgs>
-    void emplace_back(TArgs&&... args)
-    {
-        COMMS_ASSERT(size() < capacity());
-        new (cellPtr(size())) T(std::forward<TArgs>(args)...);
-        ++size_;
-    }
-
-    void resize(std::size_t count, const T& value)
+    T* eraseInternal(const T* from, const T* to, BulkOpTag<>)
     {
-        if (count < size()) {
-            erase(begin() + count, end());
-            COMMS_ASSERT(count == size());
-            return;
-        }
-
-        while (size() < count) {
-            push_back(value);
-        }
+        auto tailCount = static_cast<std::size_t>(std::distance(to, cend()));
+        auto eraseCount = static_cast<std::size_t>(std::distance(from, to));
+        auto* moveDest = begin() + std::distance(cbegin(), from);
+        std::memmove(moveDest, to, tailCount * sizeof(T));
+        size_ -= eraseCount;
+        return moveDest;
     }
 
-    void swap(StaticVectorBase<T>& other)
+    void swapInternal(StaticVectorBase<T>& other, ElemOpTag<>)
     {
         auto swapSize = std::min(other.size(), size());
         for (auto idx = 0U; idx < swapSize; ++idx) {
@@ -390,33 +574,30 @@ public:
         other.erase(other.begin() + thisSize, other.end());
     }
 
-private:
-    CellType& cell(std::size_t idx)
+    void swapInternal(StaticVectorBase<T>& other, BulkOpTag<>)
     {
-        COMMS_ASSERT(idx < capacity());
-        return data_[idx];
-    }
+        auto swapSize = std::min(other.size(), size());
+        std::swap_ranges(begin(), begin() + swapSize, other.begin());
 
-    const CellType& cell(std::size_t idx) const
-    {
-        COMMS_ASSERT(idx < capacity());
-        return data_[idx];
-    }
+        auto otherSize = other.size();
+        auto thisSize = size();
 
-    CellType* cellPtr(std::size_t idx)
-    {
-        COMMS_ASSERT(idx < capacity());
-        return &data_[idx];
-    }
+        if (otherSize == thisSize) {
+            return;
+        }
 
-    T& elem(std::size_t idx)
-    {
-        return reinterpret_cast<T&>(cell(idx));
-    }
+        if (otherSize < thisSize) {
+            auto limit = std::min(thisSize, other.capacity());
+            std::memcpy(other.begin() + swapSize, begin() + swapSize, (limit - swapSize) * sizeof(T));
+            other.size_ = limit;
+            size_ = otherSize;
+            return;
+        }
 
-    const T& elem(std::size_t idx) const
-    {
-        return reinterpret_cast<const T&>(cell(idx));
+        auto limit = std::min(otherSize, capacity());
+        std::memcpy(begin() + swapSize, other.begin() + swapSize, (limit - swapSize) * sizeof(T));
+        size_ = limit;
+        other.size_ = thisSize;
     }
 
     template <typename TIter>
@@ -433,6 +614,10 @@ private:
         }
 
         auto count = static_cast<std::size_t>(std::distance(from, to));
+        if (count == 0U) {
+            return posIter;
+        }
+
         COMMS_ASSERT(!empty());
         auto tailCount = static_cast<std::size_t>(std::distance(posIter, end()));
         if (count <= tailCount) {
@@ -493,6 +678,30 @@ private:
         return ret;
     }
 
+    template <typename TIter>
+    T* insert_bulk(const T* pos, TIter from, TIter to)
+    {
+        COMMS_ASSERT(pos <= end());
+        auto count = static_cast<std::size_t>(std::distance(from, to));
+        COMMS_ASSERT((size() + count) <= capacity());
+        auto* posIter = begin() + std::distance(cbegin(), pos);
+        if (count == 0U) {
+            return posIter;
+        }
+
+        auto tailCount = static_cast<std::size_t>(std::distance(posIter, end()));
+        std::memmove(posIter + count, posIter, tailCount * sizeof(T));
+        std::memcpy(posIter, from, count * sizeof(T));
+        size_ += count;
+        return posIter;
+    }
+
+    template <typename TIter>
+    T* insert_internal(const T* pos, TIter from, TIter to, BulkOpTag<>)
+    {
+        return insert_bulk(pos, from, to);
+    }
+
     template <typename TIter>
     T* insert_internal(const T* pos, TIter from, TIter to, std::random_access_iterator_tag)
     {
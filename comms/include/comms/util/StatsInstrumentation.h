@@ -0,0 +1,611 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// Contains definition of @ref comms::util::InstrumentationStats and
+///     @ref comms::util::StatsInstrumentation classes.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "comms/EmptyInstrumentation.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/util/LatencyHistogram.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Lock-free statistics collected by the @ref comms::util::StatsInstrumentation.
+/// @details The layers are identified by the number of layers from the
+///     reported one up to and including the data layer (the @b NumOfLayers
+///     constant of the layer class). The messages are identified by their
+///     numeric ID. All the updates are performed using relaxed atomic operations
+///     and may be invoked from multiple threads concurrently.
+/// @tparam TMaxLayers Max number of the recorded layers.
+/// @tparam TMaxMsgIds Max number of the recorded message IDs, the statistics
+///     of the messages that didn't fit are aggregated in the
+///     "overflow" entry.
+/// @headerfile comms/util/StatsInstrumentation.h
+template <std::size_t TMaxLayers = 8U, std::size_t TMaxMsgIds = 64U>
+class InstrumentationStats
+{
+    static const std::size_t NumOfStatuses =
+        static_cast<std::size_t>(comms::ErrorStatus::NumOfErrorStatuses);
+
+public:
+    /// @brief Type of the histogram used to record durations (in nanoseconds)
+    using Histogram = comms::util::LatencyHistogram<>;
+
+    /// @brief Statistics of a single operation type.
+    struct OpStats
+    {
+        OpStats()
+        {
+            clear();
+        }
+
+        void record(comms::ErrorStatus es, std::size_t bytes, std::uint64_t durationNs)
+        {
+            auto idx = static_cast<std::size_t>(es);
+            if (idx < NumOfStatuses) {
+                m_statuses[idx].fetch_add(1U, std::memory_order_relaxed);
+            }
+
+            m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            m_latency.record(durationNs);
+        }
+
+        void clear()
+        {
+            for (auto& s : m_statuses) {
+                s.store(0U, std::memory_order_relaxed);
+            }
+            m_bytes.store(0U, std::memory_order_relaxed);
+            m_latency.clear();
+        }
+
+        std::uint64_t count() const
+        {
+            return m_latency.count();
+        }
+
+        std::uint64_t statusCount(comms::ErrorStatus es) const
+        {
+            return m_statuses[static_cast<std::size_t>(es)].load(std::memory_order_relaxed);
+        }
+
+        std::uint64_t bytes() const
+        {
+            return m_bytes.load(std::memory_order_relaxed);
+        }
+
+        const Histogram& latency() const
+        {
+            return m_latency;
+        }
+
+    private:
+        std::atomic<std::uint64_t> m_statuses[NumOfStatuses];
+        std::atomic<std::uint64_t> m_bytes;
+        Histogram m_latency;
+    };
+
+    /// @brief Statistics of a single protocol layer.
+    struct LayerStats
+    {
+        LayerStats()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            m_read.clear();
+            m_write.clear();
+            for (auto& s : m_originatedErrors) {
+                s.store(0U, std::memory_order_relaxed);
+            }
+        }
+
+        /// @brief Read operations statistics
+        OpStats m_read;
+
+        /// @brief Write operations statistics
+        OpStats m_write;
+
+        /// @brief Number of read errors detected by this layer (not reported by the inner ones).
+        std::atomic<std::uint64_t> m_originatedErrors[NumOfStatuses];
+    };
+
+    /// @brief Statistics of a single message ID.
+    struct MsgStats
+    {
+        MsgStats()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            m_read.clear();
+            m_dispatch.clear();
+            m_created.store(0U, std::memory_order_relaxed);
+            m_createFailed.store(0U, std::memory_order_relaxed);
+        }
+
+        /// @brief Read (decode) operations statistics
+        OpStats m_read;
+
+        /// @brief Dispatch operations statistics
+        OpStats m_dispatch;
+
+        /// @brief Number of created message objects
+        std::atomic<std::uint64_t> m_created;
+
+        /// @brief Number of failed message objects creations
+        std::atomic<std::uint64_t> m_createFailed;
+    };
+
+    /// @brief Default constructor
+    InstrumentationStats() = default;
+
+    /// @brief Copy constructor is deleted
+    InstrumentationStats(const InstrumentationStats&) = delete;
+
+    /// @brief Copy assignment is deleted
+    InstrumentationStats& operator=(const InstrumentationStats&) = delete;
+
+    /// @brief Record layer read operation.
+    void recordLayerRead(
+        std::size_t numOfLayers,
+        comms::ErrorStatus es,
+        std::size_t bytes,
+        std::uint64_t durationNs,
+        bool originated)
+    {
+        auto* layer = layerStats(numOfLayers);
+        if (layer == nullptr) {
+            return;
+        }
+
+        layer->m_read.record(es, bytes, durationNs);
+        if (!originated) {
+            return;
+        }
+
+        auto idx = static_cast<std::size_t>(es);
+        if (idx < NumOfStatuses) {
+            layer->m_originatedErrors[idx].fetch_add(1U, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Record layer write operation.
+    void recordLayerWrite(
+        std::size_t numOfLayers,
+        comms::ErrorStatus es,
+        std::size_t bytes,
+        std::uint64_t durationNs)
+    {
+        auto* layer = layerStats(numOfLayers);
+        if (layer != nullptr) {
+            layer->m_write.record(es, bytes, durationNs);
+        }
+    }
+
+    /// @brief Record message read (decode) operation.
+    void recordMsgRead(
+        std::uintmax_t id,
+        comms::ErrorStatus es,
+        std::size_t bytes,
+        std::uint64_t durationNs)
+    {
+        msgStats(id).m_read.record(es, bytes, durationNs);
+    }
+
+    /// @brief Record message object creation.
+    void recordMsgCreate(std::uintmax_t id, bool created)
+    {
+        auto& stats = msgStats(id);
+        if (created) {
+            stats.m_created.fetch_add(1U, std::memory_order_relaxed);
+            return;
+        }
+
+        stats.m_createFailed.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /// @brief Record message dispatch operation.
+    void recordMsgDispatch(std::uintmax_t id, std::uint64_t durationNs)
+    {
+        msgStats(id).m_dispatch.record(comms::ErrorStatus::Success, 0U, durationNs);
+    }
+
+    /// @brief Record dispatch of the message, which ID cannot be retrieved.
+    void recordUnknownMsgDispatch(std::uint64_t durationNs)
+    {
+        m_overflowMsg.m_dispatch.record(comms::ErrorStatus::Success, 0U, durationNs);
+    }
+
+    /// @brief Access statistics of the layer, @b nullptr if not recorded.
+    const LayerStats* layer(std::size_t numOfLayers) const
+    {
+        if ((numOfLayers == 0U) || (TMaxLayers < numOfLayers)) {
+            return nullptr;
+        }
+
+        return &m_layers[numOfLayers - 1U];
+    }
+
+    /// @brief Access statistics of the message ID, @b nullptr if not recorded.
+    const MsgStats* msg(std::uintmax_t id) const
+    {
+        for (auto& entry : m_msgs) {
+            if ((entry.m_state.load(std::memory_order_acquire) == EntryState_Ready) &&
+                (entry.m_id == id)) {
+                return &entry.m_stats;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// @brief Access aggregated statistics of the message IDs that didn't
+    ///     fit into the table as well as dispatch of the messages without
+    ///     ID information.
+    const MsgStats& overflowMsg() const
+    {
+        return m_overflowMsg;
+    }
+
+    /// @brief Reset all the collected statistics.
+    /// @details Not expected to be invoked concurrently with the updates.
+    ///     The IDs of the already recorded messages preserve their table entries.
+    void clear()
+    {
+        for (auto& l : m_layers) {
+            l.clear();
+        }
+
+        for (auto& entry : m_msgs) {
+            entry.m_stats.clear();
+        }
+
+        m_overflowMsg.clear();
+    }
+
+    /// @brief Dump the collected statistics in human readable form.
+    /// @tparam TStream Output stream type, such as @b std::ostream.
+    template <typename TStream>
+    void dump(TStream& out) const
+    {
+        for (auto idx = TMaxLayers; 0U < idx; --idx) {
+            auto& l = m_layers[idx - 1U];
+            if ((l.m_read.count() == 0U) && (l.m_write.count() == 0U)) {
+                continue;
+            }
+
+            out << "layer " << idx << ":\n";
+            dumpOp(out, "read", l.m_read);
+            dumpStatuses(out, "originated", l.m_originatedErrors);
+            dumpOp(out, "write", l.m_write);
+        }
+
+        for (auto& entry : m_msgs) {
+            if (entry.m_state.load(std::memory_order_acquire) != EntryState_Ready) {
+                continue;
+            }
+
+            out << "msg " << static_cast<unsigned long long>(entry.m_id) << ":\n";
+            dumpMsg(out, entry.m_stats);
+        }
+
+        if ((m_overflowMsg.m_read.count() != 0U) ||
+            (m_overflowMsg.m_dispatch.count() != 0U) ||
+            (m_overflowMsg.m_created.load(std::memory_order_relaxed) != 0U) ||
+            (m_overflowMsg.m_createFailed.load(std::memory_order_relaxed) != 0U)) {
+            out << "msg (other):\n";
+            dumpMsg(out, m_overflowMsg);
+        }
+    }
+
+    /// @brief Retrieve name of the error status.
+    static const char* errorStatusName(comms::ErrorStatus es)
+    {
+        static const char* Map[] = {
+            "Success",
+            "UpdateRequired",
+            "NotEnoughData",
+            "ProtocolError",
+            "BufferOverflow",
+            "InvalidMsgId",
+            "InvalidMsgData",
+            "MsgAllocFailure",
+            "NotSupported"
+        };
+        static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+        static_assert(MapSize == NumOfStatuses, "Invalid map");
+
+        auto idx = static_cast<std::size_t>(es);
+        if (MapSize <= idx) {
+            return "Unknown";
+        }
+
+        return Map[idx];
+    }
+
+private:
+    enum EntryState : unsigned
+    {
+        EntryState_Empty,
+        EntryState_Claimed,
+        EntryState_Ready
+    };
+
+    struct MsgEntry
+    {
+        std::atomic<unsigned> m_state{EntryState_Empty};
+        std::uintmax_t m_id = 0U;
+        MsgStats m_stats;
+    };
+
+    LayerStats* layerStats(std::size_t numOfLayers)
+    {
+        if ((numOfLayers == 0U) || (TMaxLayers < numOfLayers)) {
+            return nullptr;
+        }
+
+        return &m_layers[numOfLayers - 1U];
+    }
+
+    MsgStats& msgStats(std::uintmax_t id)
+    {
+        auto startIdx = static_cast<std::size_t>(id % TMaxMsgIds);
+        for (std::size_t count = 0U; count < TMaxMsgIds; ++count) {
+            auto& entry = m_msgs[(startIdx + count) % TMaxMsgIds];
+            auto state = entry.m_state.load(std::memory_order_acquire);
+            if (state == EntryState_Empty) {
+                unsigned expected = EntryState_Empty;
+                if (entry.m_state.compare_exchange_strong(expected, EntryState_Claimed, std::memory_order_acq_rel)) {
+                    entry.m_id = id;
+                    entry.m_state.store(EntryState_Ready, std::memory_order_release);
+                    return entry.m_stats;
+                }
+
+                state = expected;
+            }
+
+            while (state != EntryState_Ready) {
+                state = entry.m_state.load(std::memory_order_acquire);
+            }
+
+            if (entry.m_id == id) {
+                return entry.m_stats;
+            }
+        }
+
+        return m_overflowMsg;
+    }
+
+    template <typename TStream>
+    static void dumpOp(TStream& out, const char* name, const OpStats& op)
+    {
+        if (op.count() == 0U) {
+            return;
+        }
+
+        auto& lat = op.latency();
+        out << "  " << name << ": count=" << op.count() <<
+            " bytes=" << op.bytes() <<
+            " p50=" << lat.percentile(50.0) << "ns" <<
+            " p90=" << lat.percentile(90.0) << "ns" <<
+            " p99=" << lat.percentile(99.0) << "ns" <<
+            " max=" << lat.max() << "ns\n";
+
+        for (std::size_t idx = 1U; idx < NumOfStatuses; ++idx) {
+            auto es = static_cast<comms::ErrorStatus>(idx);
+            auto count = op.statusCount(es);
+            if (count != 0U) {
+                out << "    " << errorStatusName(es) << "=" << count << '\n';
+            }
+        }
+    }
+
+    template <typename TStream>
+    static void dumpStatuses(TStream& out, const char* name, const std::atomic<std::uint64_t> (&statuses)[NumOfStatuses])
+    {
+        for (std::size_t idx = 1U; idx < NumOfStatuses; ++idx) {
+            auto count = statuses[idx].load(std::memory_order_relaxed);
+            if (count != 0U) {
+                out << "  " << name << " " << errorStatusName(static_cast<comms::ErrorStatus>(idx)) << "=" << count << '\n';
+            }
+        }
+    }
+
+    template <typename TStream>
+    static void dumpMsg(TStream& out, const MsgStats& stats)
+    {
+        out << "  created=" << stats.m_created.load(std::memory_order_relaxed) <<
+            " failed=" << stats.m_createFailed.load(std::memory_order_relaxed) << '\n';
+        dumpOp(out, "read", stats.m_read);
+        dumpOp(out, "dispatch", stats.m_dispatch);
+    }
+
+    LayerStats m_layers[TMaxLayers];
+    MsgEntry m_msgs[TMaxMsgIds];
+    MsgStats m_overflowMsg;
+};
+
+/// @brief Instrumentation hooks collecting statistics into
+///     @ref comms::util::InstrumentationStats.
+/// @details Expected to be passed to @ref comms::option::app::Instrumentation
+///     option. The statistics object is shared by all the hooks of the same
+///     type and is accessed using @ref stats() static member function, for
+///     example:
+///     @code
+///     using MyHooks = comms::util::StatsInstrumentation<MyProtocolTag>;
+///     using MyStack =
+///         comms::protocol::SyncPrefixLayer<
+///             ...,
+///             comms::option::app::Instrumentation<MyHooks>
+///         >;
+///     ...
+///     MyHooks::stats().dump(std::cout);
+///     @endcode
+///     The durations are measured using @b std::chrono::steady_clock and
+///     recorded in nanoseconds. The layer reporting the read error first
+///     (i.e. the innermost one) is recorded as the one originating the error.
+///     The message IDs are expected to be numeric (or enum) values.
+/// @tparam TTag Arbitrary tag type allowing usage of separate statistics for
+///     separate protocol stacks.
+/// @tparam TStats Type of the statistics object.
+/// @headerfile comms/util/StatsInstrumentation.h
+template <typename TTag = void, typename TStats = InstrumentationStats<> >
+class StatsInstrumentation : public comms::EmptyInstrumentation
+{
+public:
+    /// @brief Type of the statistics object.
+    using Stats = TStats;
+
+    /// @brief Access the shared statistics object.
+    static Stats& stats()
+    {
+        static Stats Obj;
+        return Obj;
+    }
+
+    /// @brief Record start of the layer read.
+    template <typename TLayer>
+    void layerReadBegin(const TLayer&, std::size_t)
+    {
+        errorAttributed() = false;
+        start();
+    }
+
+    /// @brief Record end of the layer read.
+    template <typename TLayer>
+    void layerReadEnd(const TLayer&, comms::ErrorStatus es, std::size_t consumed)
+    {
+        auto originated = (es != comms::ErrorStatus::Success) && (!errorAttributed());
+        if (originated) {
+            errorAttributed() = true;
+        }
+
+        stats().recordLayerRead(TLayer::NumOfLayers, es, consumed, elapsed(), originated);
+    }
+
+    /// @brief Record start of the layer write.
+    template <typename TLayer>
+    void layerWriteBegin(const TLayer&, std::size_t)
+    {
+        start();
+    }
+
+    /// @brief Record end of the layer write.
+    template <typename TLayer>
+    void layerWriteEnd(const TLayer&, comms::ErrorStatus es, std::size_t written)
+    {
+        stats().recordLayerWrite(TLayer::NumOfLayers, es, written, elapsed());
+    }
+
+    /// @brief Record start of the message read.
+    template <typename TId>
+    void msgReadBegin(const TId&, std::size_t)
+    {
+        start();
+    }
+
+    /// @brief Record end of the message read.
+    template <typename TId>
+    void msgReadEnd(const TId& id, comms::ErrorStatus es, std::size_t consumed)
+    {
+        stats().recordMsgRead(static_cast<std::uintmax_t>(id), es, consumed, elapsed());
+    }
+
+    /// @brief Record end of the message object creation.
+    template <typename TId>
+    void msgCreateEnd(const TId& id, unsigned, bool created)
+    {
+        stats().recordMsgCreate(static_cast<std::uintmax_t>(id), created);
+    }
+
+    /// @brief Record start of the message dispatch.
+    template <typename TMsg>
+    void dispatchBegin(const TMsg&)
+    {
+        start();
+    }
+
+    /// @brief Record end of the message dispatch.
+    template <typename TMsg>
+    void dispatchEnd(const TMsg& msg)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                TMsg::hasGetId()
+            >::template Type<
+                HasIdTag,
+                NoIdTag
+            >;
+
+        recordDispatch(msg, elapsed(), Tag());
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    template <typename... TParams>
+    using HasIdTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using NoIdTag = comms::details::tag::Tag2<>;
+
+    static bool& errorAttributed()
+    {
+        static thread_local bool Attributed = false;
+        return Attributed;
+    }
+
+    void start()
+    {
+        m_start = Clock::now();
+    }
+
+    std::uint64_t elapsed() const
+    {
+        auto diff = Clock::now() - m_start;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(diff).count());
+    }
+
+    template <typename TMsg>
+    static void recordDispatch(const TMsg& msg, std::uint64_t durationNs, HasIdTag<>)
+    {
+        stats().recordMsgDispatch(static_cast<std::uintmax_t>(msg.getId()), durationNs);
+    }
+
+    template <typename TMsg>
+    static void recordDispatch(const TMsg& msg, std::uint64_t durationNs, NoIdTag<>)
+    {
+        static_cast<void>(msg);
+        stats().recordUnknownMsgDispatch(durationNs);
+    }
+
+    Clock::time_point m_start;
+};
+
+} // namespace util
+
+} // namespace comms
@@ -316,6 +316,22 @@ public:
         return Ptr(new TObj(std::forward<TArgs>(args)...));
     }
 
+    /// @brief Allocation function using default-initialisation.
+    /// @details Similar to @ref alloc(), but the object is default-initialised
+    ///     (@b new @b TObj) rather than value-initialised (@b new @b TObj()),
+    ///     i.e. the memory areas not initialised by the constructors (such as
+    ///     storage area of @ref comms::util::StaticVector) are not zeroed.
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from TInterface.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj>
+    static Ptr allocDefaultInit()
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+        return Ptr(new TObj);
+    }
+
     /// @brief Function used to wrap raw pointer into a smart one
     /// @tparam Type of the object, expected to be the
     ///     same as or derived from TInterface.
@@ -376,6 +392,23 @@ public:
         return Ptr(new TObj(std::forward<TArgs>(args)...), Deleter(id, idx));
     }
 
+    /// @brief Allocation function using default-initialisation.
+    /// @details Similar to @ref alloc(), but the object is default-initialised
+    ///     (@b new @b TObj) rather than value-initialised (@b new @b TObj()).
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from TInterface.
+    /// @param[in] id Numeric ID of the message
+    /// @param[in] idx Index of the message type among types with same ID
+    ///     provided in @b TAllMessages tuple.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj>
+    static Ptr allocDefaultInit(TId id, unsigned idx)
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+        return Ptr(new TObj, Deleter(id, idx));
+    }
+
     /// @brief Inquiry whether allocation is possible
     /// @return Always @b true.
     static constexpr bool canAllocate()
@@ -425,25 +458,29 @@ public:
             return Ptr();
         }
 
-        static_assert(std::is_base_of<TInterface, TObj>::value,
-            "TObj does not inherit from TInterface");
-
-        static_assert(comms::util::IsInTuple<TAllTypes>::template Type<TObj>::value, 
-            "TObj must be in provided tuple of supported types");
-
-        static_assert(
-            std::has_virtual_destructor<TInterface>::value ||
-            std::is_same<TInterface, TObj>::value,
-            "TInterface is expected to have virtual destructor");
+        checkObjType<TObj>();
+        new (&place_) TObj(std::forward<TArgs>(args)...);
+        return ownAllocated();
+    }
 
-        static_assert(sizeof(TObj) <= sizeof(place_), "Object is too big");
+    /// @brief Allocation function using default-initialisation.
+    /// @details Similar to @ref alloc(), but the object is default-initialised
+    ///     (@b new @b TObj) rather than value-initialised (@b new @b TObj()),
+    ///     i.e. the memory areas not initialised by the constructors (such as
+    ///     storage area of @ref comms::util::StaticVector) are not zeroed.
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from @b TInterface.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj>
+    Ptr allocDefaultInit()
+    {
+        if (allocated_) {
+            return Ptr();
+        }
 
-        new (&place_) TObj(std::forward<TArgs>(args)...);
-        Ptr obj(
-            reinterpret_cast<TInterface*>(&place_),
-            details::InPlaceDeleter<TInterface>(&allocated_));
-        allocated_ = true;
-        return obj;
+        checkObjType<TObj>();
+        new (&place_) TObj;
+        return ownAllocated();
     }
 
     /// @brief Inquire whether the object is already allocated.
@@ -488,6 +525,32 @@ public:
 private:
     using AlignedStorage = typename TupleAsAlignedUnion<TAllTypes>::Type;
 
+    template <typename TObj>
+    static void checkObjType()
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+
+        static_assert(comms::util::IsInTuple<TAllTypes>::template Type<TObj>::value, 
+            "TObj must be in provided tuple of supported types");
+
+        static_assert(
+            std::has_virtual_destructor<TInterface>::value ||
+            std::is_same<TInterface, TObj>::value,
+            "TInterface is expected to have virtual destructor");
+
+        static_assert(sizeof(TObj) <= sizeof(AlignedStorage), "Object is too big");
+    }
+
+    Ptr ownAllocated()
+    {
+        Ptr obj(
+            reinterpret_cast<TInterface*>(&place_),
+            details::InPlaceDeleter<TInterface>(&allocated_));
+        allocated_ = true;
+        return obj;
+    }
+
     AlignedStorage place_;
     bool allocated_ = false;
 
@@ -545,20 +608,30 @@ public:
             return Ptr();
         }
 
-        static_assert(std::is_base_of<TInterface, TObj>::value,
-            "TObj does not inherit from TInterface");
-
-        static_assert(comms::util::IsInTuple<TAllocMessages>::template Type<TObj>::value, ""
-            "TObj must be in provided tuple of supported types");
+        checkObjType<TObj>();
+        new (&place_) TObj(std::forward<TArgs>(args)...);
+        return ownAllocated(id, idx);
+    }
 
-        static_assert(sizeof(TObj) <= sizeof(place_), "Object is too big");
+    /// @brief Allocation function using default-initialisation.
+    /// @details Similar to @ref alloc(), but the object is default-initialised
+    ///     (@b new @b TObj) rather than value-initialised (@b new @b TObj()).
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from @b TInterface.
+    /// @param[in] id Numeric ID of the message
+    /// @param[in] idx Index of the message type among types with same ID
+    ///     provided in @b TOrigMessages tuple.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj>
+    Ptr allocDefaultInit(TId id, unsigned idx)
+    {
+        if (allocated_) {
+            return Ptr();
+        }
 
-        new (&place_) TObj(std::forward<TArgs>(args)...);
-        Ptr obj(
-            reinterpret_cast<TInterface*>(&place_),
-            Deleter(id, idx, allocated_));
-        allocated_ = true;
-        return obj;
+        checkObjType<TObj>();
+        new (&place_) TObj;
+        return ownAllocated(id, idx);
     }
 
     /// @brief Inquire whether the object is already allocated.
@@ -582,6 +655,27 @@ public:
 private:
     using AlignedStorage = typename TupleAsAlignedUnion<TAllocMessages>::Type;
 
+    template <typename TObj>
+    static void checkObjType()
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+
+        static_assert(comms::util::IsInTuple<TAllocMessages>::template Type<TObj>::value, ""
+            "TObj must be in provided tuple of supported types");
+
+        static_assert(sizeof(TObj) <= sizeof(AlignedStorage), "Object is too big");
+    }
+
+    Ptr ownAllocated(TId id, unsigned idx)
+    {
+        Ptr obj(
+            reinterpret_cast<TInterface*>(&place_),
+            Deleter(id, idx, allocated_));
+        allocated_ = true;
+        return obj;
+    }
+
     AlignedStorage place_;
     bool allocated_ = false;
 
@@ -624,6 +718,24 @@ public:
         return iter->template alloc<TObj>(std::forward<TArgs>(args)...);
     }
 
+    /// @copydoc InPlaceSingle::allocDefaultInit
+    template <typename TObj>
+    Ptr allocDefaultInit()
+    {
+        auto iter = std::find_if(
+            pool_.begin(), pool_.end(),
+            [](const PoolElem& elem) -> bool
+            {
+                return !elem.allocated();
+            });
+
+        if (iter == pool_.end()) {
+            return Ptr();
+        }
+
+        return iter->template allocDefaultInit<TObj>();
+    }
+
     /// @brief Function used to wrap raw pointer into a smart one
     /// @tparam Type of the object, expected to be the
     ///     same as or derived from TInterface.
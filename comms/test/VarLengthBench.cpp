@@ -0,0 +1,238 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Measures decoding / encoding of the lists of var-length integers:
+//  - "byte loop" - element by element, reading byte by byte (forward iterator)
+//  - "elem loop" - element by element, word at a time (random access iterator)
+//  - "bulk" - whole list at once.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "comms/comms.h"
+
+namespace
+{
+
+// Hides random access capabilities of the wrapped pointer
+class ForwardIter
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::uint8_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::uint8_t*;
+    using reference = const std::uint8_t&;
+
+    explicit ForwardIter(const std::uint8_t* ptr) : m_ptr(ptr) {}
+
+    reference operator*() const
+    {
+        return *m_ptr;
+    }
+
+    ForwardIter& operator++()
+    {
+        ++m_ptr;
+        return *this;
+    }
+
+    ForwardIter operator++(int)
+    {
+        auto copy = *this;
+        ++m_ptr;
+        return copy;
+    }
+
+    bool operator==(const ForwardIter& other) const
+    {
+        return m_ptr == other.m_ptr;
+    }
+
+    bool operator!=(const ForwardIter& other) const
+    {
+        return m_ptr != other.m_ptr;
+    }
+
+private:
+    const std::uint8_t* m_ptr = nullptr;
+};
+
+using FieldBase = comms::Field<comms::option::LittleEndian>;
+
+using Elem =
+    comms::field::IntValue<
+        FieldBase,
+        std::uint32_t,
+        comms::option::VarLength<1, 5>
+    >;
+
+using List =
+    comms::field::ArrayList<
+        FieldBase,
+        Elem
+    >;
+
+using Clock = std::chrono::steady_clock;
+using Buffer = std::vector<std::uint8_t>;
+
+const std::size_t ValuesCount = 1000000U;
+const unsigned Repeats = 20U;
+
+// Mostly small values with occasional large ones
+List makeList(unsigned smallPercent)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<unsigned> percentDist(0U, 99U);
+    std::uniform_int_distribution<std::uint32_t> smallDist(0U, 0x7fU);
+    std::uniform_int_distribution<std::uint32_t> largeDist(0x80U, 0xfffffffU);
+
+    List list;
+    auto& vec = list.value();
+    vec.resize(ValuesCount);
+    for (auto& elem : vec) {
+        if (percentDist(gen) < smallPercent) {
+            elem.value() = smallDist(gen);
+            continue;
+        }
+
+        elem.value() = largeDist(gen);
+    }
+    return list;
+}
+
+template <typename TFunc>
+double measure(const char* name, std::size_t bytesCount, TFunc&& func)
+{
+    std::uint64_t checksum = 0U;
+    auto start = Clock::now();
+    for (auto idx = 0U; idx < Repeats; ++idx) {
+        checksum += func();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    auto nsPerValue = elapsed / (static_cast<double>(ValuesCount) * Repeats);
+    auto mbPerSec = (static_cast<double>(bytesCount) * Repeats * 1000.0) / elapsed;
+    std::cout << "    " << name << ": " << nsPerValue << " ns/value, "
+              << mbPerSec << " MB/s (checksum " << checksum << ")" << std::endl;
+    return nsPerValue;
+}
+
+template <typename TIter>
+std::uint64_t readElemLoop(TIter iter, std::size_t len, List::ValueType& vec)
+{
+    vec.clear();
+    std::uint64_t sum = 0U;
+    while (0U < len) {
+        Elem elem;
+        auto fromIter = iter;
+        auto es = elem.read(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            std::cerr << "ERROR: Unexpected read failure" << std::endl;
+            break;
+        }
+
+        len -= static_cast<std::size_t>(std::distance(fromIter, iter));
+        sum += elem.value();
+        vec.push_back(elem);
+    }
+    return sum;
+}
+
+void runScenario(unsigned smallPercent)
+{
+    auto srcList = makeList(smallPercent);
+    Buffer buf(srcList.length());
+    auto writeIter = &buf[0];
+    if (srcList.write(writeIter, buf.size()) != comms::ErrorStatus::Success) {
+        std::cerr << "ERROR: Failed to encode the list" << std::endl;
+        return;
+    }
+
+    std::cout << smallPercent << "% single byte values, " << buf.size() << " bytes:" << std::endl;
+
+    List::ValueType vec;
+    vec.reserve(ValuesCount);
+    measure("decode byte loop", buf.size(),
+        [&buf, &vec]() -> std::uint64_t
+        {
+            return readElemLoop(ForwardIter(buf.data()), buf.size(), vec);
+        });
+
+    measure("decode elem loop", buf.size(),
+        [&buf, &vec]() -> std::uint64_t
+        {
+            return readElemLoop(buf.data(), buf.size(), vec);
+        });
+
+    List list;
+    list.value().reserve(ValuesCount);
+    measure("decode bulk", buf.size(),
+        [&buf, &list]() -> std::uint64_t
+        {
+            const std::uint8_t* iter = buf.data();
+            auto es = list.read(iter, buf.size());
+            if (es != comms::ErrorStatus::Success) {
+                std::cerr << "ERROR: Unexpected read failure" << std::endl;
+            }
+            std::uint64_t sum = 0U;
+            for (auto& elem : list.value()) {
+                sum += elem.value();
+            }
+            return sum;
+        });
+
+    if (list != srcList) {
+        std::cerr << "ERROR: Decoded list is different" << std::endl;
+    }
+
+    Buffer outBuf(buf.size());
+    measure("encode elem loop", buf.size(),
+        [&srcList, &outBuf]() -> std::uint64_t
+        {
+            auto iter = &outBuf[0];
+            auto len = outBuf.size();
+            for (auto& elem : srcList.value()) {
+                auto es = elem.write(iter, len);
+                if (es != comms::ErrorStatus::Success) {
+                    std::cerr << "ERROR: Unexpected write failure" << std::endl;
+                    break;
+                }
+                len -= elem.length();
+            }
+            return outBuf.back();
+        });
+
+    measure("encode bulk", buf.size(),
+        [&srcList, &outBuf]() -> std::uint64_t
+        {
+            auto iter = &outBuf[0];
+            auto es = srcList.write(iter, outBuf.size());
+            if (es != comms::ErrorStatus::Success) {
+                std::cerr << "ERROR: Unexpected write failure" << std::endl;
+            }
+            return outBuf.back();
+        });
+
+    if (outBuf != buf) {
+        std::cerr << "ERROR: Encoded data is different" << std::endl;
+    }
+}
+
+} // namespace
+
+int main()
+{
+    for (auto percent : {100U, 90U, 50U}) {
+        runScenario(percent);
+    }
+    return 0;
+}
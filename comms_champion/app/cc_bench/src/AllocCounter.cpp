@@ -0,0 +1,152 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "AllocCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+#define CC_BENCH_COUNT_MALLOC
+#endif
+
+namespace
+{
+
+std::atomic<unsigned long long> AllocationsCount(0U);
+
+void countAllocation()
+{
+    AllocationsCount.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void* allocate(std::size_t size)
+{
+#ifndef CC_BENCH_COUNT_MALLOC
+    // Otherwise counted by malloc() below
+    countAllocation();
+#endif
+
+    if (size == 0U) {
+        size = 1U;
+    }
+
+    return std::malloc(size);
+}
+
+}  // namespace
+
+namespace comms_bench
+{
+
+unsigned long long allocationsCount()
+{
+    return AllocationsCount.load(std::memory_order_relaxed);
+}
+
+bool mallocCounted()
+{
+#ifdef CC_BENCH_COUNT_MALLOC
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace comms_bench
+
+#ifdef CC_BENCH_COUNT_MALLOC
+
+// Qt containers (QString, QByteArray, QVariantMap, etc...) allocate
+// their data using malloc() / realloc() directly. Wrap the C allocation
+// functions of glibc to count them as well.
+
+extern "C" {
+
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+
+void* malloc(std::size_t size) noexcept
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+    countAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+} // extern "C"
+
+#endif // #ifdef CC_BENCH_COUNT_MALLOC
+
+// Replacement of the global allocation functions to count allocations
+// performed by the whole pipeline.
+
+void* operator new(std::size_t size)
+{
+    auto* ptr = allocate(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
@@ -0,0 +1,30 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace comms_bench
+{
+
+unsigned long long allocationsCount();
+
+// Whether the direct invocations of malloc() / calloc() / realloc()
+// are included in the allocationsCount(), otherwise only the
+// allocations using operator new are counted.
+bool mallocCounted();
+
+}  // namespace comms_bench
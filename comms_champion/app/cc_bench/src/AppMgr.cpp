@@ -0,0 +1,586 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "AppMgr.h"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QStringList>
+CC_ENABLE_WARNINGS()
+
+#include "AllocCounter.h"
+#include "ProbeFilter.h"
+
+namespace cc = comms_champion;
+
+namespace comms_bench
+{
+
+namespace
+{
+
+const std::string Sep(", ");
+const unsigned long long DefaultCount = 100000U;
+const unsigned DefaultBatch = 64U;
+const std::size_t DefaultRawChunkSize = 4096U;
+const int LoopbackTimeout = 1000;
+
+const char* StageNames[] = {
+    "socket",
+    "filters",
+    "protocol",
+    "handler",
+    "total"
+};
+
+}  // namespace
+
+AppMgr::NullStreamBuf::int_type AppMgr::NullStreamBuf::overflow(int_type ch)
+{
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize AppMgr::NullStreamBuf::xsputn(const char_type* str, std::streamsize count)
+{
+    static_cast<void>(str);
+    return count;
+}
+
+AppMgr::AppMgr()
+  : m_nullStream(&m_nullBuf)
+{
+    static_assert(std::extent<decltype(StageNames)>::value == Stage_NumOfValues,
+        "Invalid map");
+
+    m_msgMgr.setMsgAddedCallbackFunc(
+        [this](cc::MessagePtr msg)
+        {
+            if (!msg) {
+                static constexpr bool Application_message_was_not_provided = false;
+                static_cast<void>(Application_message_was_not_provided);
+                assert(Application_message_was_not_provided);
+                return;
+            }
+
+            msgAdded(*msg);
+        });
+
+    m_msgMgr.setErrorReportCallbackFunc(
+        [](const QString& error)
+        {
+            std::cerr << "ERROR: " << error.toStdString() << std::endl;
+        });
+
+    m_loopbackTimer.setSingleShot(true);
+    connect(
+        &m_loopbackTimer, SIGNAL(timeout()),
+        this, SLOT(loopbackTimeout()));
+}
+
+AppMgr::~AppMgr() noexcept = default;
+
+bool AppMgr::start(const Config& config)
+{
+    if (config.m_pluginsDir.isEmpty()) {
+        std::cerr << "ERROR: Unknown plugins directory!" << std::endl;
+        return false;
+    }
+    m_pluginMgr.setPluginsDir(config.m_pluginsDir);
+
+    if (config.m_pluginConfigFile.isEmpty()) {
+        std::cerr << "ERROR: The plugins configuration file wasn't provided" << std::endl;
+        return false;
+    }
+    auto plugins = m_pluginMgr.loadPluginsFromConfigFile(config.m_pluginConfigFile);
+    if (plugins.empty()) {
+        std::cerr << "ERROR: No plugins were loaded" << std::endl;
+        return false;
+    }
+
+    if (!applyPlugins(plugins)) {
+        std::cerr << "ERROR: Failed to apply plugins" << std::endl;
+        return false;
+    }
+
+    m_config = config;
+    if (m_config.m_count == 0U) {
+        m_config.m_count = DefaultCount;
+    }
+
+    if (m_config.m_batch == 0U) {
+        m_config.m_batch = DefaultBatch;
+    }
+
+    if (!m_config.m_handlerDisabled) {
+        m_handler.reset(new comms_dump::CsvDumpMessageHandler(m_nullStream, Sep));
+    }
+
+    if (!prepareStream()) {
+        return false;
+    }
+
+    m_msgMgr.setRecvEnabled(true);
+    m_msgMgr.start();
+
+    if (!m_socket->socketConnect()) {
+        std::cerr << "ERROR: Socket failed to connect!" << std::endl;
+        return false;
+    }
+
+    m_startAllocs = allocationsCount();
+    m_startTime = Clock::now();
+    QTimer::singleShot(0, this, SLOT(pushBatch()));
+    return true;
+}
+
+void AppMgr::pushBatch()
+{
+    if (m_finished) {
+        return;
+    }
+
+    assert(!m_chunks.empty());
+    for (auto idx = 0U; (idx < m_config.m_batch) && (m_chunksPushed < m_chunksTotal); ++idx) {
+        auto& chunk = m_chunks[static_cast<std::size_t>(m_chunksPushed % m_chunks.size())];
+        auto dataPtr = cc::makeDataInfo();
+        auto begIter = m_stream.begin() + static_cast<std::ptrdiff_t>(chunk.m_offset);
+        dataPtr->m_data.assign(begIter, begIter + static_cast<std::ptrdiff_t>(chunk.m_size));
+        ++m_chunksPushed;
+
+        if (m_config.m_loopback) {
+            m_sendTimes.push_back(Clock::now());
+            m_msgMgr.sendData(std::move(dataPtr));
+            continue;
+        }
+
+        m_socket->inject(std::move(dataPtr));
+    }
+
+    // Keep memory consumption bounded
+    m_msgMgr.deleteAllMsgs();
+
+    if (m_chunksPushed < m_chunksTotal) {
+        QTimer::singleShot(0, this, SLOT(pushBatch()));
+        return;
+    }
+
+    if (!m_config.m_loopback) {
+        finish();
+        return;
+    }
+
+    m_loopbackTimer.start(LoopbackTimeout);
+}
+
+void AppMgr::loopbackTimeout()
+{
+    std::cerr << "WARNING: Only " << m_chunksReceived << " out of " << m_chunksTotal <<
+        " chunks were received back, does the socket loop the data back?" << std::endl;
+    finish();
+}
+
+bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
+{
+    typedef cc::Plugin::ListOfFilters ListOfFilters;
+
+    struct ApplyInfo
+    {
+        cc::SocketPtr m_socket;
+        ListOfFilters m_filters;
+        cc::ProtocolPtr m_protocol;
+    };
+
+    auto applyInfo = ApplyInfo();
+    for (auto& info : plugins) {
+        cc::Plugin* plugin = m_pluginMgr.loadPlugin(*info);
+        if (plugin == nullptr) {
+            static constexpr bool Failed_to_load_plugin = false;
+            static_cast<void>(Failed_to_load_plugin);
+            assert(Failed_to_load_plugin);
+            continue;
+        }
+
+        if (!applyInfo.m_socket) {
+            applyInfo.m_socket = plugin->createSocket();
+        }
+
+        applyInfo.m_filters.append(plugin->createFilters());
+
+        if (!applyInfo.m_protocol) {
+            applyInfo.m_protocol = plugin->createProtocol();
+        }
+    }
+
+    if (!applyInfo.m_socket) {
+        std::cerr << "ERROR: Socket hasn't been set!" << std::endl;
+        return false;
+    }
+
+    if (!applyInfo.m_protocol) {
+        std::cerr << "ERROR: Protocol hasn't been set!" << std::endl;
+        return false;
+    }
+
+    m_socket = std::make_shared<BenchSocket>(std::move(applyInfo.m_socket));
+    m_socket->setReceiveStartedCallback(
+        [this](std::size_t size)
+        {
+            receiveStarted(size);
+        });
+    m_socket->setReceiveCompletedCallback(
+        [this]()
+        {
+            receiveCompleted();
+        });
+
+    m_msgMgr.setSocket(m_socket);
+
+    for (auto& filter : applyInfo.m_filters) {
+        m_msgMgr.addFilter(std::move(filter));
+    }
+
+    auto probe = std::make_shared<ProbeFilter>();
+    probe->setProbeCallback(
+        [this]()
+        {
+            filtersProbed();
+        });
+    m_msgMgr.addFilter(std::move(probe));
+
+    m_msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+
+    m_pluginMgr.setAppliedPlugins(plugins);
+    return true;
+}
+
+bool AppMgr::prepareStream()
+{
+    auto protocol = m_msgMgr.getProtocol();
+    assert(protocol);
+
+    bool result = false;
+    if (!m_config.m_rawFile.isEmpty()) {
+        result = prepareRawStream();
+    }
+    else if (!m_config.m_framesFile.isEmpty()) {
+        result = prepareRecordedFrames(*protocol);
+    }
+    else {
+        result = prepareSyntheticFrames(*protocol);
+    }
+
+    if (!result) {
+        return false;
+    }
+
+    if (m_stream.empty()) {
+        std::cerr << "ERROR: No data to benchmark with" << std::endl;
+        return false;
+    }
+
+    prepareChunks();
+
+    if (m_frameEnds.empty()) {
+        m_cyclesCount = m_config.m_count;
+    }
+    else {
+        auto framesCount = static_cast<unsigned long long>(m_frameEnds.size());
+        m_cyclesCount = (m_config.m_count + framesCount - 1U) / framesCount;
+    }
+
+    m_chunksTotal = m_cyclesCount * m_chunks.size();
+    return true;
+}
+
+bool AppMgr::prepareSyntheticFrames(cc::Protocol& protocol)
+{
+    auto allMsgs = protocol.createAllMessages();
+    if (m_config.m_mix.isEmpty()) {
+        for (auto& msg : allMsgs) {
+            assert(msg);
+            addFrame(protocol, *msg);
+        }
+        return true;
+    }
+
+    struct MixEntry
+    {
+        cc::MessagePtr m_msg;
+        unsigned m_weight = 1U;
+    };
+
+    std::vector<MixEntry> mix;
+    unsigned maxWeight = 0U;
+    auto entries = m_config.m_mix.split(',', QString::SkipEmptyParts);
+    for (auto& e : entries) {
+        auto parts = e.split(':');
+        assert(!parts.isEmpty());
+        auto id = parts[0].trimmed();
+
+        unsigned weight = 1U;
+        if (1 < parts.size()) {
+            bool ok = false;
+            weight = parts[1].trimmed().toUInt(&ok);
+            if ((!ok) || (weight == 0U)) {
+                std::cerr << "ERROR: Invalid message mix entry: " << e.toStdString() << std::endl;
+                return false;
+            }
+        }
+
+        auto iter =
+            std::find_if(
+                allMsgs.begin(), allMsgs.end(),
+                [&id](const cc::MessagePtr& msg) -> bool
+                {
+                    return msg->idAsString() == id;
+                });
+
+        if (iter == allMsgs.end()) {
+            std::cerr << "ERROR: Unknown message ID in the mix: " << id.toStdString() << std::endl;
+            return false;
+        }
+
+        MixEntry entry;
+        entry.m_msg = *iter;
+        entry.m_weight = weight;
+        mix.push_back(std::move(entry));
+        maxWeight = std::max(maxWeight, weight);
+    }
+
+    // Interleave messages according to their weights
+    for (auto round = 0U; round < maxWeight; ++round) {
+        for (auto& entry : mix) {
+            if (round < entry.m_weight) {
+                addFrame(protocol, *entry.m_msg);
+            }
+        }
+    }
+    return true;
+}
+
+bool AppMgr::prepareRecordedFrames(cc::Protocol& protocol)
+{
+    auto msgs =
+        m_msgFileMgr.load(
+            cc::MsgFileMgr::Type::Send,
+            m_config.m_framesFile,
+            protocol);
+
+    if (msgs.empty()) {
+        std::cerr << "ERROR: No messages were loaded from " << m_config.m_framesFile.toStdString() << std::endl;
+        return false;
+    }
+
+    for (auto& msg : msgs) {
+        assert(msg);
+        addFrame(protocol, *msg);
+    }
+    return true;
+}
+
+bool AppMgr::prepareRawStream()
+{
+    QFile rawFile(m_config.m_rawFile);
+    if (!rawFile.open(QIODevice::ReadOnly)) {
+        std::cerr << "ERROR: Failed to open " << m_config.m_rawFile.toStdString() << std::endl;
+        return false;
+    }
+
+    auto data = rawFile.readAll();
+    auto* begIter = reinterpret_cast<const std::uint8_t*>(data.constData());
+    m_stream.assign(begIter, begIter + data.size());
+    return true;
+}
+
+void AppMgr::addFrame(cc::Protocol& protocol, cc::Message& msg)
+{
+    auto dataPtr = protocol.write(msg);
+    if ((!dataPtr) || (dataPtr->m_data.empty())) {
+        std::cerr << "WARNING: Failed to serialise message " << msg.name() << std::endl;
+        return;
+    }
+
+    m_stream.insert(m_stream.end(), dataPtr->m_data.begin(), dataPtr->m_data.end());
+    m_frameEnds.push_back(m_stream.size());
+}
+
+void AppMgr::prepareChunks()
+{
+    if ((m_config.m_chunkSize == 0U) && (!m_frameEnds.empty())) {
+        std::size_t offset = 0U;
+        for (auto end : m_frameEnds) {
+            Chunk chunk;
+            chunk.m_offset = offset;
+            chunk.m_size = end - offset;
+            m_chunks.push_back(chunk);
+            offset = end;
+        }
+        return;
+    }
+
+    std::size_t chunkSize = m_config.m_chunkSize;
+    if (chunkSize == 0U) {
+        chunkSize = DefaultRawChunkSize;
+    }
+
+    for (std::size_t offset = 0U; offset < m_stream.size(); offset += chunkSize) {
+        Chunk chunk;
+        chunk.m_offset = offset;
+        chunk.m_size = std::min(chunkSize, m_stream.size() - offset);
+        m_chunks.push_back(chunk);
+    }
+}
+
+void AppMgr::receiveStarted(std::size_t size)
+{
+    auto now = Clock::now();
+    if (m_config.m_loopback && (!m_sendTimes.empty())) {
+        record(Stage_Socket, m_sendTimes.front(), now);
+        m_sendTimes.pop_front();
+    }
+
+    m_recvStart = now;
+    m_protocolPending = false;
+    m_bytesCount += size;
+}
+
+void AppMgr::receiveCompleted()
+{
+    record(Stage_Total, m_recvStart, Clock::now());
+    ++m_chunksReceived;
+
+    if ((!m_config.m_loopback) || (m_chunksPushed < m_chunksTotal)) {
+        return;
+    }
+
+    if (m_chunksReceived < m_chunksTotal) {
+        m_loopbackTimer.start(LoopbackTimeout);
+        return;
+    }
+
+    finish();
+}
+
+void AppMgr::filtersProbed()
+{
+    auto now = Clock::now();
+    record(Stage_Filters, m_recvStart, now);
+    m_filtersDone = now;
+    m_protocolPending = true;
+}
+
+void AppMgr::msgAdded(cc::Message& msg)
+{
+    auto now = Clock::now();
+    if (m_protocolPending) {
+        record(Stage_Protocol, m_filtersDone, now);
+        m_protocolPending = false;
+    }
+
+    ++m_msgsCount;
+    if (!m_handler) {
+        return;
+    }
+
+    msg.dispatch(*m_handler);
+    record(Stage_Handler, now, Clock::now());
+}
+
+void AppMgr::record(Stage stage, Timestamp from, Timestamp to)
+{
+    auto diff = std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count();
+    m_stages[stage].record(static_cast<Histogram::ValueType>(std::max(diff, decltype(diff)(0))));
+}
+
+void AppMgr::finish()
+{
+    if (m_finished) {
+        return;
+    }
+
+    m_finished = true;
+    m_endTime = Clock::now();
+    m_endAllocs = allocationsCount();
+    m_loopbackTimer.stop();
+    m_msgMgr.deleteAllMsgs();
+
+    report();
+    QTimer::singleShot(0, qApp, SLOT(quit()));
+}
+
+void AppMgr::report()
+{
+    auto elapsedUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(m_endTime - m_startTime).count();
+    auto elapsedSec = static_cast<double>(std::max(elapsedUs, decltype(elapsedUs)(1))) / 1000000.0;
+    auto allocs = m_endAllocs - m_startAllocs;
+
+    std::cout <<
+        "Chunks: " << m_chunksReceived << " (" << m_bytesCount << " bytes)\n" <<
+        "Messages: " << m_msgsCount << "\n" <<
+        "Elapsed: " << elapsedUs << " us\n" <<
+        "Throughput: " << static_cast<unsigned long long>(static_cast<double>(m_msgsCount) / elapsedSec) << " msgs/s, " <<
+            static_cast<unsigned long long>(static_cast<double>(m_bytesCount) / elapsedSec) << " bytes/s\n" <<
+        "Allocations: " << allocs;
+
+    if (0U < m_msgsCount) {
+        std::cout << " (" << std::fixed << std::setprecision(2) <<
+            (static_cast<double>(allocs) / static_cast<double>(m_msgsCount)) << " per message)";
+    }
+
+    if (!mallocCounted()) {
+        std::cout << "\n    Note: only operator new is counted, the direct malloc() " <<
+            "allocations (e.g. by QString, QByteArray, QVariantMap) are not included";
+    }
+
+    static const int NameWidth = 10;
+    static const int ValueWidth = 12;
+    std::cout << "\n\nLatency (ns):\n" << std::left << std::setw(NameWidth) << "stage" << std::right;
+    for (auto* title : {"count", "avg", "p50", "p90", "p99", "p99.9", "max"}) {
+        std::cout << std::setw(ValueWidth) << title;
+    }
+    std::cout << '\n';
+
+    for (auto idx = 0U; idx < Stage_NumOfValues; ++idx) {
+        auto& hist = m_stages[idx];
+        if (hist.count() == 0U) {
+            continue;
+        }
+
+        std::cout <<
+            std::left << std::setw(NameWidth) << StageNames[idx] << std::right <<
+            std::setw(ValueWidth) << hist.count() <<
+            std::setw(ValueWidth) << (hist.sum() / hist.count()) <<
+            std::setw(ValueWidth) << hist.percentile(50.0) <<
+            std::setw(ValueWidth) << hist.percentile(90.0) <<
+            std::setw(ValueWidth) << hist.percentile(99.0) <<
+            std::setw(ValueWidth) << hist.percentile(99.9) <<
+            std::setw(ValueWidth) << hist.max() << '\n';
+    }
+    std::cout << std::flush;
+}
+
+} /* namespace comms_bench */
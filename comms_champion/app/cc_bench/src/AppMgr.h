@@ -0,0 +1,155 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <streambuf>
+#include <ostream>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms/util/LatencyHistogram.h"
+#include "comms_champion/PluginMgr.h"
+#include "comms_champion/MsgMgr.h"
+#include "comms_champion/MsgFileMgr.h"
+
+#include "BenchSocket.h"
+#include "CsvDumpMessageHandler.h"
+
+namespace comms_bench
+{
+
+class AppMgr  : public QObject
+{
+    Q_OBJECT
+public:
+    struct Config
+    {
+        QString m_pluginsDir;
+        QString m_pluginConfigFile;
+        QString m_framesFile;
+        QString m_rawFile;
+        QString m_mix;
+        unsigned long long m_count = 0U;
+        unsigned m_chunkSize = 0U;
+        unsigned m_batch = 0U;
+        bool m_loopback = false;
+        bool m_handlerDisabled = false;
+    };
+
+    AppMgr();
+    ~AppMgr() noexcept;
+
+    bool start(const Config& config);
+
+private slots:
+    void pushBatch();
+    void loopbackTimeout();
+
+private:
+    typedef comms_champion::PluginMgr::ListOfPluginInfos ListOfPluginInfos;
+    typedef std::unique_ptr<comms_dump::CsvDumpMessageHandler> CsvDumpMessageHandlerPtr;
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point Timestamp;
+    typedef comms::util::LatencyHistogram<> Histogram;
+    typedef std::vector<std::uint8_t> DataSeq;
+
+    enum Stage
+    {
+        Stage_Socket,
+        Stage_Filters,
+        Stage_Protocol,
+        Stage_Handler,
+        Stage_Total,
+        Stage_NumOfValues
+    };
+
+    struct Chunk
+    {
+        std::size_t m_offset = 0U;
+        std::size_t m_size = 0U;
+    };
+
+    typedef std::vector<Chunk> ChunksList;
+
+    class NullStreamBuf : public std::streambuf
+    {
+    protected:
+        virtual int_type overflow(int_type ch) override;
+        virtual std::streamsize xsputn(const char_type* str, std::streamsize count) override;
+    };
+
+    bool applyPlugins(const ListOfPluginInfos& plugins);
+    bool prepareStream();
+    bool prepareSyntheticFrames(comms_champion::Protocol& protocol);
+    bool prepareRecordedFrames(comms_champion::Protocol& protocol);
+    bool prepareRawStream();
+    void addFrame(comms_champion::Protocol& protocol, comms_champion::Message& msg);
+    void prepareChunks();
+    void receiveStarted(std::size_t size);
+    void receiveCompleted();
+    void filtersProbed();
+    void msgAdded(comms_champion::Message& msg);
+    void record(Stage stage, Timestamp from, Timestamp to);
+    void finish();
+    void report();
+
+    comms_champion::PluginMgr m_pluginMgr;
+    comms_champion::MsgMgr m_msgMgr;
+    comms_champion::MsgFileMgr m_msgFileMgr;
+    std::shared_ptr<BenchSocket> m_socket;
+    Config m_config;
+    NullStreamBuf m_nullBuf;
+    std::ostream m_nullStream;
+    CsvDumpMessageHandlerPtr m_handler;
+
+    DataSeq m_stream;
+    std::vector<std::size_t> m_frameEnds;
+    ChunksList m_chunks;
+    unsigned long long m_cyclesCount = 0U;
+    unsigned long long m_chunksTotal = 0U;
+    unsigned long long m_chunksPushed = 0U;
+    unsigned long long m_chunksReceived = 0U;
+
+    std::deque<Timestamp> m_sendTimes;
+    Timestamp m_recvStart;
+    Timestamp m_filtersDone;
+    bool m_protocolPending = false;
+
+    Timestamp m_startTime;
+    Timestamp m_endTime;
+    unsigned long long m_startAllocs = 0U;
+    unsigned long long m_endAllocs = 0U;
+    unsigned long long m_msgsCount = 0U;
+    unsigned long long m_bytesCount = 0U;
+    Histogram m_stages[Stage_NumOfValues];
+    QTimer m_loopbackTimer;
+    bool m_finished = false;
+};
+
+} /* namespace comms_bench */
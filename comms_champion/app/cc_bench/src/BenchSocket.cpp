@@ -0,0 +1,101 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "BenchSocket.h"
+
+#include <cassert>
+
+namespace cc = comms_champion;
+
+namespace comms_bench
+{
+
+BenchSocket::BenchSocket(cc::SocketPtr socket)
+  : m_socket(std::move(socket))
+{
+    assert(m_socket);
+    m_socket->setDataReceivedCallback(
+        [this](cc::DataInfoPtr dataPtr)
+        {
+            deliver(std::move(dataPtr));
+        });
+
+    m_socket->setErrorReportCallback(
+        [this](const QString& msg)
+        {
+            reportError(msg);
+        });
+
+    m_socket->setDisconnectedReportCallback(
+        [this]()
+        {
+            reportDisconnected();
+        });
+}
+
+BenchSocket::~BenchSocket() noexcept = default;
+
+void BenchSocket::inject(cc::DataInfoPtr dataPtr)
+{
+    deliver(std::move(dataPtr));
+}
+
+bool BenchSocket::startImpl()
+{
+    return m_socket->start();
+}
+
+void BenchSocket::stopImpl()
+{
+    m_socket->stop();
+}
+
+bool BenchSocket::socketConnectImpl()
+{
+    return m_socket->socketConnect();
+}
+
+void BenchSocket::socketDisconnectImpl()
+{
+    m_socket->socketDisconnect();
+}
+
+void BenchSocket::sendDataImpl(cc::DataInfoPtr dataPtr)
+{
+    m_socket->sendData(std::move(dataPtr));
+}
+
+unsigned BenchSocket::connectionPropertiesImpl() const
+{
+    return m_socket->connectionProperties();
+}
+
+void BenchSocket::deliver(cc::DataInfoPtr dataPtr)
+{
+    assert(dataPtr);
+    if (m_receiveStartedCallback) {
+        m_receiveStartedCallback(dataPtr->m_data.size());
+    }
+
+    reportDataReceived(std::move(dataPtr));
+
+    if (m_receiveCompletedCallback) {
+        m_receiveCompletedCallback();
+    }
+}
+
+}  // namespace comms_bench
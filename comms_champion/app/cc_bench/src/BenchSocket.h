@@ -0,0 +1,67 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "comms_champion/Socket.h"
+
+namespace comms_bench
+{
+
+class BenchSocket : public comms_champion::Socket
+{
+public:
+    using ReceiveStartedCallback = std::function<void (std::size_t size)>;
+    using ReceiveCompletedCallback = std::function<void ()>;
+
+    explicit BenchSocket(comms_champion::SocketPtr socket);
+    ~BenchSocket() noexcept;
+
+    void inject(comms_champion::DataInfoPtr dataPtr);
+
+    template <typename TFunc>
+    void setReceiveStartedCallback(TFunc&& func)
+    {
+        m_receiveStartedCallback = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setReceiveCompletedCallback(TFunc&& func)
+    {
+        m_receiveCompletedCallback = std::forward<TFunc>(func);
+    }
+
+protected:
+    virtual bool startImpl() override;
+    virtual void stopImpl() override;
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(comms_champion::DataInfoPtr dataPtr) override;
+    virtual unsigned connectionPropertiesImpl() const override;
+
+private:
+    void deliver(comms_champion::DataInfoPtr dataPtr);
+
+    comms_champion::SocketPtr m_socket;
+    ReceiveStartedCallback m_receiveStartedCallback;
+    ReceiveCompletedCallback m_receiveCompletedCallback;
+};
+
+}  // namespace comms_bench
@@ -0,0 +1,49 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <functional>
+
+#include "comms_champion/Filter.h"
+
+namespace comms_bench
+{
+
+class ProbeFilter : public comms_champion::Filter
+{
+public:
+    using ProbeCallback = std::function<void ()>;
+
+    ProbeFilter();
+    ~ProbeFilter() noexcept;
+
+    template <typename TFunc>
+    void setProbeCallback(TFunc&& func)
+    {
+        m_probeCallback = std::forward<TFunc>(func);
+    }
+
+protected:
+    virtual void recvDataIntoImpl(comms_champion::DataInfoPtr dataPtr, DataInfosList& output) override;
+    virtual void sendDataIntoImpl(comms_champion::DataInfoPtr dataPtr, DataInfosList& output) override;
+
+private:
+    ProbeCallback m_probeCallback;
+};
+
+}  // namespace comms_bench
@@ -0,0 +1,241 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <iostream>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QStringList>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+#include "comms_champion/Protocol.h"
+#include "comms_champion/PluginMgr.h"
+#include "comms_champion/DataInfo.h"
+
+#include "AppMgr.h"
+
+namespace cc = comms_champion;
+
+namespace
+{
+
+const QString PluginsOptStr("plugins");
+const QString FramesOptStr("frames");
+const QString RawOptStr("raw");
+const QString MixOptStr("mix");
+const QString CountOptStr("count");
+const QString ChunkOptStr("chunk");
+const QString BatchOptStr("batch");
+const QString LoopbackOptStr("loopback");
+const QString NoHandlerOptStr("no-handler");
+
+void metaTypesRegisterAll()
+{
+    qRegisterMetaType<cc::MessagePtr>();
+    qRegisterMetaType<cc::ProtocolPtr>();
+    qRegisterMetaType<cc::PluginMgr::PluginInfoPtr>();
+    qRegisterMetaType<cc::DataInfoPtr>();
+}
+
+void prepareCommandLineOptions(QCommandLineParser& parser)
+{
+    parser.addHelpOption();
+
+    QCommandLineOption pluginsOpt(
+        QStringList() << "p" << PluginsOptStr,
+        QCoreApplication::translate("main", "Provide plugins configuration file."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(pluginsOpt);
+
+    QCommandLineOption framesOpt(
+        QStringList() << "f" << FramesOptStr,
+        QCoreApplication::translate("main", "Use messages from the provided messages file "
+                                            "(created using cc_view) instead of synthetic ones."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(framesOpt);
+
+    QCommandLineOption rawOpt(
+        RawOptStr,
+        QCoreApplication::translate("main", "Use recorded raw input data from the provided file "
+                                            "instead of the serialised messages."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(rawOpt);
+
+    QCommandLineOption mixOpt(
+        QStringList() << "m" << MixOptStr,
+        QCoreApplication::translate("main", "Mix of synthetic messages, comma separated list of "
+                                            "message IDs with optional weights, such as \"1:10,2,5:3\". "
+                                            "Default is single message of every available type."),
+        QCoreApplication::translate("main", "mix")
+    );
+    parser.addOption(mixOpt);
+
+    QCommandLineOption countOpt(
+        QStringList() << "c" << CountOptStr,
+        QCoreApplication::translate("main", "Number of frames to push through the pipeline, "
+                                            "rounded up to the whole message mix. Number of passes "
+                                            "over the file when raw data is used. Default is 100000."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(countOpt);
+
+    QCommandLineOption chunkOpt(
+        ChunkOptStr,
+        QCoreApplication::translate("main", "Size of the data chunk reported by the socket. "
+                                            "Default is 0, which means a single frame per chunk "
+                                            "(4096 bytes when raw data is used)."),
+        QCoreApplication::translate("main", "bytes")
+    );
+    parser.addOption(chunkOpt);
+
+    QCommandLineOption batchOpt(
+        BatchOptStr,
+        QCoreApplication::translate("main", "Number of chunks pushed on every event loop "
+                                            "iteration. Default is 64."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(batchOpt);
+
+    QCommandLineOption loopbackOpt(
+        LoopbackOptStr,
+        QCoreApplication::translate("main", "Send the data via the socket and expect it to be "
+                                            "received back (echo socket), instead of injecting it "
+                                            "as the one received by the socket.")
+    );
+    parser.addOption(loopbackOpt);
+
+    QCommandLineOption noHandlerOpt(
+        NoHandlerOptStr,
+        QCoreApplication::translate("main", "Don't dispatch received messages to the CSV dump handler.")
+    );
+    parser.addOption(noHandlerOpt);
+}
+
+QString getRootDir()
+{
+    QDir appDir(qApp->applicationDirPath());
+    QDir binDir(CC_BINDIR);
+    while (true) {
+        auto appDirName = appDir.dirName();
+        if (appDirName.isEmpty()) {
+            break;
+        }
+
+        auto binDirName = binDir.dirName();
+        if (binDirName.isEmpty()) {
+            break;
+        }
+
+        if (appDirName != binDirName) {
+            break;
+        }
+
+        appDir.cdUp();
+        binDir.cdUp();
+    }
+
+    return appDir.path();
+}
+
+QString getPluginsDir()
+{
+    QDir dir(getRootDir());
+    if (!dir.cd(CC_PLUGINDIR)) {
+        return QString();
+    }
+
+    return dir.path();
+}
+
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    metaTypesRegisterAll();
+
+    QCommandLineParser parser;
+    prepareCommandLineOptions(parser);
+    parser.process(app);
+
+    if (!parser.isSet(PluginsOptStr)) {
+        std::cerr << "ERROR: Unknown plugins configuration, please use \"--" <<
+            PluginsOptStr.toStdString() << "\" option to provide the file.\n" << std::endl;
+        return -1;
+    }
+
+    auto pluginsDir = getPluginsDir();
+    if (pluginsDir.isEmpty()) {
+        std::cerr << "ERROR: Failed to find plugins directory!" << std::endl;
+        return -1;
+    }
+    app.addLibraryPath(pluginsDir);
+
+    auto config = comms_bench::AppMgr::Config();
+    config.m_pluginsDir = pluginsDir;
+    config.m_pluginConfigFile = parser.value(PluginsOptStr);
+
+    if (parser.isSet(FramesOptStr)) {
+        config.m_framesFile = parser.value(FramesOptStr);
+    }
+
+    if (parser.isSet(RawOptStr)) {
+        config.m_rawFile = parser.value(RawOptStr);
+    }
+
+    if (parser.isSet(MixOptStr)) {
+        config.m_mix = parser.value(MixOptStr);
+    }
+
+    if (parser.isSet(CountOptStr)) {
+        config.m_count = parser.value(CountOptStr).toULongLong();
+    }
+
+    if (parser.isSet(ChunkOptStr)) {
+        config.m_chunkSize = parser.value(ChunkOptStr).toUInt();
+    }
+
+    if (parser.isSet(BatchOptStr)) {
+        config.m_batch = parser.value(BatchOptStr).toUInt();
+    }
+
+    if (parser.isSet(LoopbackOptStr)) {
+        config.m_loopback = true;
+    }
+
+    if (parser.isSet(NoHandlerOptStr)) {
+        config.m_handlerDisabled = true;
+    }
+
+    comms_bench::AppMgr appMgr;
+    if (!appMgr.start(config)) {
+        std::cerr << "Failed to start!" << std::endl;
+        return -1;
+    }
+
+    auto retval = app.exec();
+    return retval;
+}
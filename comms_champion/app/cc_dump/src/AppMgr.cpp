@@ -28,6 +28,10 @@ CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/message.h"
 
+#ifdef CC_DUMP_NATIVE_SOCKET
+#include "NativeSocket.h"
+#endif // #ifdef CC_DUMP_NATIVE_SOCKET
+
 namespace cc = comms_champion;
 
 namespace comms_dump
@@ -53,11 +57,7 @@ AppMgr::AppMgr()
                 return;
             }
 
-            auto type = cc::property::message::Type().getFrom(*msg);
-            assert((type == cc::Message::Type::Sent) ||
-                   (type == cc::Message::Type::Received));
-            if ((type == cc::Message::Type::Sent) &&
-                (!m_config.m_recordOutgoing)) {
+            if (isSkipped(*msg) || (!m_query.matches(*msg))) {
                 return;
             }
 
@@ -80,6 +80,44 @@ AppMgr::AppMgr()
             QTimer::singleShot(static_cast<int>(m_config.m_lastWait), qApp, SLOT(quit()));
         });
 
+    m_msgSendMgr.setSendDataCallbackFunc(
+        [this](cc::DataInfoPtr dataPtr)
+        {
+            m_msgMgr.sendData(std::move(dataPtr));
+        });
+
+    m_msgSendMgr.setLoadCompleteCallbackFunc(
+        [this](const cc::MsgSendMgr::LoadStats& stats)
+        {
+            std::cerr <<
+                "Sent " << stats.m_sentCount << " messages (" << stats.m_sentBytes << " bytes) in " <<
+                stats.m_elapsedUs << " us\n" <<
+                "Achieved rate: " << stats.m_achievedRate << " msgs/s" << std::endl;
+
+            if (m_config.m_load.m_rate == 0U) {
+                // No deadlines when sending as fast as possible
+                return;
+            }
+
+            std::cerr <<
+                "Lateness (us): min=" << stats.m_minLatenessUs << ", avg=" << stats.m_avgLatenessUs <<
+                ", max=" << stats.m_maxLatenessUs << "\n" <<
+                "Jitter: " << stats.m_jitterUs << " us" << std::endl;
+        });
+
+    m_msgMgr.setSocketDisconnectReportCallbackFunc(
+        [this]()
+        {
+            // Nothing else is going to be received, such as at the end
+            // of replay or when the remote side terminates the connection.
+            flushOutput();
+            if (m_config.m_lastWait == 0U) {
+                return;
+            }
+
+            QTimer::singleShot(static_cast<int>(m_config.m_lastWait), qApp, SLOT(quit()));
+        });
+
     connect(
         &m_flushTimer, SIGNAL(timeout()),
         this, SLOT(flushOutput()));
@@ -105,12 +143,18 @@ bool AppMgr::start(const Config& config)
         return false;
     }
 
+    m_config = config;
     if (!applyPlugins(plugins)) {
         std::cerr << "ERROR: Failed to apply plugins" << std::endl;
         return false;
     }
 
-    m_config = config;
+    if (!m_query.parse(m_config.m_filter)) {
+        std::cerr << "ERROR: Invalid filter query: " << m_config.m_filter.toStdString() << std::endl;
+        return false;
+    }
+    m_query.setThreadsCount(m_config.m_threads);
+
     if (!m_config.m_quiet) {
         m_csvDump.reset(new CsvDumpMessageHandler(std::cout, Sep));
 
@@ -123,6 +167,10 @@ bool AppMgr::start(const Config& config)
         m_record.reset(new RecordMessageHandler(m_config.m_inMsgsFile));
     }
 
+    if (!m_config.m_searchFile.isEmpty()) {
+        return search();
+    }
+
     m_msgMgr.setRecvEnabled(true);
     m_msgMgr.start();
 
@@ -146,7 +194,13 @@ bool AppMgr::start(const Config& config)
                 config.m_outMsgsFile,
                 *protocol);
 
-        if (!msgsToSend.empty()) {
+        if (msgsToSend.empty()) {
+            // Nothing to send
+        }
+        else if (m_config.m_loadMode) {
+            m_msgSendMgr.startLoad(protocol, msgsToSend, m_config.m_load);
+        }
+        else {
             m_msgSendMgr.start(protocol, msgsToSend);
         }
     }
@@ -201,6 +255,13 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
         }
     }
 
+    if (!m_config.m_nativeSocket.isEmpty()) {
+        applyInfo.m_socket = createNativeSocket();
+        if (!applyInfo.m_socket) {
+            return false;
+        }
+    }
+
     if (!applyInfo.m_socket) {
         std::cerr << "ERROR: Socket hasn't been set!" << std::endl;
         return false;
@@ -223,6 +284,66 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
     return true;
 }
 
+comms_champion::SocketPtr AppMgr::createNativeSocket() const
+{
+#ifdef CC_DUMP_NATIVE_SOCKET
+    auto nativeConfig = NativeSocket::Config();
+    if (!NativeSocket::parseConfig(m_config.m_nativeSocket, nativeConfig)) {
+        std::cerr << "ERROR: Invalid native socket specification: " << m_config.m_nativeSocket.toStdString() << std::endl;
+        return cc::SocketPtr();
+    }
+
+    return cc::SocketPtr(new NativeSocket(nativeConfig));
+#else // #ifdef CC_DUMP_NATIVE_SOCKET
+    std::cerr << "ERROR: Native socket is not supported on this platform" << std::endl;
+    return cc::SocketPtr();
+#endif // #ifdef CC_DUMP_NATIVE_SOCKET
+}
+
+bool AppMgr::isSkipped(const comms_champion::Message& msg) const
+{
+    auto type = cc::property::message::Type().getFrom(msg);
+    assert((type == cc::Message::Type::Sent) ||
+           (type == cc::Message::Type::Received));
+    return (type == cc::Message::Type::Sent) && (!m_config.m_recordOutgoing);
+}
+
+bool AppMgr::search()
+{
+    auto protocol = m_msgMgr.getProtocol();
+    assert(protocol);
+
+    auto msgs =
+        m_msgFileMgr.load(
+            cc::MsgFileMgr::Type::Recv,
+            m_config.m_searchFile,
+            *protocol);
+
+    if (msgs.empty()) {
+        std::cerr << "ERROR: No messages were loaded from " << m_config.m_searchFile.toStdString() << std::endl;
+        return false;
+    }
+
+    cc::MsgQuery::MsgsList allMsgs(msgs.begin(), msgs.end());
+    msgs.clear();
+
+    m_query.run(
+        allMsgs,
+        [this](const cc::MsgQuery::MsgsList& found)
+        {
+            for (auto& m : found) {
+                assert(m);
+                if (!isSkipped(*m)) {
+                    dispatchMsg(*m);
+                }
+            }
+        });
+
+    flushOutput();
+    QTimer::singleShot(0, qApp, SLOT(quit()));
+    return true;
+}
+
 void AppMgr::dispatchMsg(comms_champion::Message& msg)
 {
     if (m_csvDump) {
@@ -31,6 +31,7 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/MsgMgr.h"
 #include "comms_champion/MsgFileMgr.h"
 #include "comms_champion/MsgSendMgr.h"
+#include "comms_champion/MsgQuery.h"
 
 #include "CsvDumpMessageHandler.h"
 #include "RecordMessageHandler.h"
@@ -48,7 +49,13 @@ public:
         QString m_pluginConfigFile;
         QString m_outMsgsFile;
         QString m_inMsgsFile;
+        QString m_filter;
+        QString m_searchFile;
+        QString m_nativeSocket;
         unsigned m_lastWait = 0U;
+        unsigned m_threads = 0U;
+        comms_champion::MsgSendMgr::LoadConfig m_load;
+        bool m_loadMode = false;
         bool m_recordOutgoing = false;
         bool m_quiet = false;
     };
@@ -67,12 +74,16 @@ private:
     typedef std::unique_ptr<RecordMessageHandler> RecordMessageHandlerPtr;
 
     bool applyPlugins(const ListOfPluginInfos& plugins);
+    comms_champion::SocketPtr createNativeSocket() const;
+    bool isSkipped(const comms_champion::Message& msg) const;
+    bool search();
     void dispatchMsg(comms_champion::Message& msg);
 
     comms_champion::PluginMgr m_pluginMgr;
     comms_champion::MsgMgr m_msgMgr;
     comms_champion::MsgFileMgr m_msgFileMgr;
     comms_champion::MsgSendMgr m_msgSendMgr;
+    comms_champion::MsgQuery m_query;
     Config m_config;
     CsvDumpMessageHandlerPtr m_csvDump;
     RecordMessageHandlerPtr m_record;
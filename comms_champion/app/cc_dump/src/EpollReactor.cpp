@@ -0,0 +1,119 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "EpollReactor.h"
+
+#include <cassert>
+#include <cerrno>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace comms_dump
+{
+
+namespace
+{
+
+const std::size_t MaxEventsPerPoll = 256U;
+
+}  // namespace
+
+EpollReactor::EpollReactor()
+  : m_fd(::epoll_create1(EPOLL_CLOEXEC)),
+    m_events(MaxEventsPerPoll)
+{
+}
+
+EpollReactor::~EpollReactor() noexcept
+{
+    if (isValid()) {
+        ::close(m_fd);
+    }
+}
+
+EpollReactor::Token EpollReactor::add(int fd, unsigned events, Handler&& handler)
+{
+    assert(isValid());
+    auto token = m_nextToken;
+
+    epoll_event event;
+    event.events = events;
+    event.data.u64 = token;
+    if (::epoll_ctl(m_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        return 0U;
+    }
+
+    ++m_nextToken;
+    auto& entry = m_entries[token];
+    entry.m_fd = fd;
+    entry.m_handler = std::move(handler);
+    return token;
+}
+
+void EpollReactor::remove(Token token)
+{
+    auto iter = m_entries.find(token);
+    if ((iter == m_entries.end()) || (iter->second.m_removed)) {
+        return;
+    }
+
+    ::epoll_ctl(m_fd, EPOLL_CTL_DEL, iter->second.m_fd, nullptr);
+    if (m_dispatching) {
+        // The handler may be executing right now, erase it after dispatch
+        iter->second.m_removed = true;
+        m_removed.push_back(token);
+        return;
+    }
+
+    m_entries.erase(iter);
+}
+
+std::size_t EpollReactor::poll(int timeoutMs)
+{
+    assert(isValid());
+    assert(!m_dispatching);
+    auto count = 0;
+    do {
+        count = ::epoll_wait(m_fd, m_events.data(), static_cast<int>(m_events.size()), timeoutMs);
+    } while ((count < 0) && (errno == EINTR));
+
+    if (count <= 0) {
+        return 0U;
+    }
+
+    m_dispatching = true;
+    for (auto idx = 0; idx < count; ++idx) {
+        auto& event = m_events[static_cast<std::size_t>(idx)];
+        auto iter = m_entries.find(event.data.u64);
+        if ((iter == m_entries.end()) || (iter->second.m_removed)) {
+            continue;
+        }
+
+        iter->second.m_handler(event.events);
+    }
+    m_dispatching = false;
+
+    for (auto token : m_removed) {
+        m_entries.erase(token);
+    }
+    m_removed.clear();
+    return static_cast<std::size_t>(count);
+}
+
+} /* namespace comms_dump */
@@ -0,0 +1,90 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+struct epoll_event;
+
+namespace comms_dump
+{
+
+/// @brief Thin wrapper around Linux epoll facility.
+/// @details Doesn't own the registered file descriptors, it just dispatches
+///     readiness events to the handlers provided upon registration.
+///     The epoll descriptor itself (see fd()) becomes readable when
+///     any of the registered descriptors has pending events, which allows
+///     to drive the reactor from another event loop.
+class EpollReactor
+{
+public:
+    using Token = unsigned long long;
+    using Handler = std::function<void (unsigned events)>;
+
+    EpollReactor();
+    ~EpollReactor() noexcept;
+
+    EpollReactor(const EpollReactor&) = delete;
+    EpollReactor& operator=(const EpollReactor&) = delete;
+
+    bool isValid() const
+    {
+        return 0 <= m_fd;
+    }
+
+    int fd() const
+    {
+        return m_fd;
+    }
+
+    /// @brief Register file descriptor.
+    /// @return Token to be used for removal, 0 on failure.
+    Token add(int fd, unsigned events, Handler&& handler);
+
+    /// @brief Unregister file descriptor, allowed to be invoked from within handler.
+    void remove(Token token);
+
+    /// @brief Wait for events and dispatch them to the handlers.
+    /// @return Number of dispatched events.
+    std::size_t poll(int timeoutMs);
+
+private:
+    struct Entry
+    {
+        int m_fd = -1;
+        Handler m_handler;
+        bool m_removed = false;
+    };
+
+    using EntriesMap = std::unordered_map<Token, Entry>;
+    using EventsList = std::vector<epoll_event>;
+    using TokensList = std::vector<Token>;
+
+    int m_fd = -1;
+    Token m_nextToken = 1U;
+    EntriesMap m_entries;
+    EventsList m_events;
+    TokensList m_removed;
+    bool m_dispatching = false;
+};
+
+} /* namespace comms_dump */
@@ -0,0 +1,805 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "NativeSocket.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QStringList>
+#include <QtCore/QVariantList>
+#include <QtCore/QVariantMap>
+CC_ENABLE_WARNINGS()
+
+namespace cc = comms_champion;
+
+namespace comms_dump
+{
+
+namespace
+{
+
+const QString TcpFromPropName("tcp.from");
+const QString TcpToPropName("tcp.to");
+const QString UdpFromPropName("udp.from");
+const QString UdpToPropName("udp.to");
+
+const std::size_t ReadBufSize = 1024U * 1024U;
+const std::size_t UdpRecvBufSize = 4U * 1024U * 1024U;
+const unsigned StreamEvents = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+const unsigned InputEvents = EPOLLIN | EPOLLET;
+const ssize_t SyscallError = -1;
+
+bool isWouldBlock()
+{
+    return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+}
+
+bool setNonBlocking(int fd)
+{
+    auto flags = ::fcntl(fd, F_GETFL, 0);
+    if (flags < 0) {
+        return false;
+    }
+
+    return ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+QString addrToString(const sockaddr* addr)
+{
+    char buf[INET6_ADDRSTRLEN] = {0};
+    unsigned port = 0U;
+    if (addr->sa_family == AF_INET) {
+        auto* addr4 = reinterpret_cast<const sockaddr_in*>(addr);
+        ::inet_ntop(AF_INET, &addr4->sin_addr, buf, sizeof(buf));
+        port = ntohs(addr4->sin_port);
+    }
+    else if (addr->sa_family == AF_INET6) {
+        auto* addr6 = reinterpret_cast<const sockaddr_in6*>(addr);
+        ::inet_ntop(AF_INET6, &addr6->sin6_addr, buf, sizeof(buf));
+        port = ntohs(addr6->sin6_port);
+    }
+    else {
+        return QString();
+    }
+
+    return QString(buf) + ':' + QString("%1").arg(port);
+}
+
+QString localName(int fd)
+{
+    sockaddr_storage addr;
+    socklen_t len = sizeof(addr);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return QString();
+    }
+    return addrToString(reinterpret_cast<const sockaddr*>(&addr));
+}
+
+QString peerName(int fd)
+{
+    sockaddr_storage addr;
+    socklen_t len = sizeof(addr);
+    if (::getpeername(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return QString();
+    }
+    return addrToString(reinterpret_cast<const sockaddr*>(&addr));
+}
+
+// Resolves the host and connects new socket of requested type to it, the
+// connection is performed in blocking mode, just like the socket plugins do.
+int connectTo(const std::string& host, unsigned short port, int sockType, int existingFd = -1)
+{
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = sockType;
+
+    addrinfo* result = nullptr;
+    auto portStr = std::to_string(port);
+    if (::getaddrinfo(host.c_str(), portStr.c_str(), &hints, &result) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (auto* info = result; info != nullptr; info = info->ai_next) {
+        fd = existingFd;
+        if (fd < 0) {
+            fd = ::socket(info->ai_family, info->ai_socktype | SOCK_CLOEXEC, info->ai_protocol);
+        }
+
+        if (fd < 0) {
+            continue;
+        }
+
+        if (::connect(fd, info->ai_addr, info->ai_addrlen) == 0) {
+            break;
+        }
+
+        if (existingFd < 0) {
+            ::close(fd);
+        }
+        fd = -1;
+    }
+
+    ::freeaddrinfo(result);
+    return fd;
+}
+
+}  // namespace
+
+NativeSocket::NativeSocket(const Config& config)
+  : m_config(config),
+    m_notifier(m_reactor.fd(), QSocketNotifier::Read),
+    m_readBuf(ReadBufSize)
+{
+    static_assert((UdpBatchSize * UdpMaxDatagramSize) <= ReadBufSize,
+        "Read buffer is too small for UDP batch");
+
+    std::memset(m_udpMsgs.data(), 0, sizeof(m_udpMsgs));
+    for (auto idx = 0U; idx < UdpBatchSize; ++idx) {
+        auto& iov = m_udpIovs[idx];
+        iov.iov_base = &m_readBuf[idx * UdpMaxDatagramSize];
+        iov.iov_len = UdpMaxDatagramSize;
+
+        auto& hdr = m_udpMsgs[idx].msg_hdr;
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        hdr.msg_name = &m_udpAddrs[idx];
+    }
+
+    m_notifier.setEnabled(false);
+    connect(
+        &m_notifier, SIGNAL(activated(int)),
+        this, SLOT(reactorReady()));
+}
+
+NativeSocket::~NativeSocket() noexcept
+{
+    m_notifier.setEnabled(false);
+    closeAll();
+}
+
+bool NativeSocket::parseConfig(const QString& spec, Config& config)
+{
+    auto parts = spec.split(':');
+    if (parts.isEmpty()) {
+        return false;
+    }
+
+    auto parsePort =
+        [](const QString& str, PortType& port) -> bool
+        {
+            bool ok = false;
+            auto value = str.toUShort(&ok);
+            if ((!ok) || (value == 0U)) {
+                return false;
+            }
+
+            port = value;
+            return true;
+        };
+
+    auto type = parts.front();
+    parts.pop_front();
+
+    if ((type == "tcp-client") && (parts.size() == 2)) {
+        config.m_type = Type::TcpClient;
+        config.m_host = parts[0].toStdString();
+        return parsePort(parts[1], config.m_port);
+    }
+
+    if ((type == "tcp-server") && (parts.size() == 1)) {
+        config.m_type = Type::TcpServer;
+        return parsePort(parts[0], config.m_localPort);
+    }
+
+    if ((type == "udp") && ((parts.size() == 1) || (parts.size() == 3))) {
+        config.m_type = Type::Udp;
+        if (!parsePort(parts[0], config.m_localPort)) {
+            return false;
+        }
+
+        if (parts.size() == 1) {
+            return true;
+        }
+
+        config.m_host = parts[1].toStdString();
+        return parsePort(parts[2], config.m_port);
+    }
+
+    return false;
+}
+
+bool NativeSocket::socketConnectImpl()
+{
+    if (!m_reactor.isValid()) {
+        static const QString Error("Failed to create epoll instance.");
+        reportError(Error);
+        return false;
+    }
+
+    if ((!m_connections.empty()) || (0 <= m_listenFd)) {
+        static constexpr bool Already_connected = false;
+        static_cast<void>(Already_connected);
+        assert(Already_connected);
+        static const QString Error("Native socket is already connected.");
+        reportError(Error);
+        return false;
+    }
+
+    bool result = false;
+    switch (m_config.m_type) {
+        case Type::TcpClient: result = connectTcpClient(); break;
+        case Type::TcpServer: result = listenTcpServer(); break;
+        case Type::Udp: result = openUdp(); break;
+        default:
+        {
+            static constexpr bool Unexpected_type = false;
+            static_cast<void>(Unexpected_type);
+            assert(Unexpected_type);
+            break;
+        }
+    }
+
+    if (!result) {
+        closeAll();
+        return false;
+    }
+
+    m_notifier.setEnabled(true);
+
+    // Edge triggered descriptors may have become ready before
+    // the notifier was enabled.
+    QMetaObject::invokeMethod(this, "reactorReady", Qt::QueuedConnection);
+    return true;
+}
+
+void NativeSocket::socketDisconnectImpl()
+{
+    m_notifier.setEnabled(false);
+    for (auto& elem : m_connections) {
+        if (elem.first != 0U) {
+            m_closed.push_back(elem.first);
+        }
+    }
+
+    closeAll();
+    reportReceived();
+}
+
+void NativeSocket::sendDataImpl(cc::DataInfoPtr dataPtr)
+{
+    assert(dataPtr);
+    auto* data = dataPtr->m_data.data();
+    auto size = dataPtr->m_data.size();
+
+    if (m_config.m_type == Type::TcpServer) {
+        QVariantList toList;
+        std::vector<ConnectionId> failed;
+        for (auto& elem : m_connections) {
+            if (!writeStream(elem.second, data, size)) {
+                failed.push_back(elem.first);
+                continue;
+            }
+
+            toList.append(elem.second.m_name);
+        }
+
+        for (auto id : failed) {
+            closeConnection(id);
+        }
+
+        reportReceived();
+
+        dataPtr->m_extraProperties.insert(TcpFromPropName, m_localName);
+        dataPtr->m_extraProperties.insert(TcpToPropName, toList);
+        return;
+    }
+
+    auto iter = m_connections.find(0U);
+    if (iter == m_connections.end()) {
+        return;
+    }
+
+    if (m_config.m_type == Type::TcpClient) {
+        if (!writeStream(iter->second, data, size)) {
+            closeConnection(iter->first);
+            reportDisconnected();
+            return;
+        }
+
+        dataPtr->m_extraProperties.insert(TcpFromPropName, m_localName);
+        dataPtr->m_extraProperties.insert(TcpToPropName, m_peerName);
+        return;
+    }
+
+    assert(m_config.m_type == Type::Udp);
+    if ((!m_udpConnected) && (m_udpPeerLen == 0U)) {
+        // No peer to send to yet
+        return;
+    }
+
+    const sockaddr* peer = nullptr;
+    socklen_t peerLen = 0U;
+    if (!m_udpConnected) {
+        peer = reinterpret_cast<const sockaddr*>(&m_udpPeer);
+        peerLen = m_udpPeerLen;
+    }
+
+    // Datagrams are not queued, the one that doesn't fit is dropped
+    // the same way the network would do.
+    ssize_t count = SyscallError;
+    do {
+        count = ::sendto(iter->second.m_fd, data, size, MSG_NOSIGNAL, peer, peerLen);
+    } while ((count < 0) && (errno == EINTR));
+
+    if (count < 0) {
+        return;
+    }
+
+    dataPtr->m_extraProperties.insert(UdpFromPropName, m_localName);
+    dataPtr->m_extraProperties.insert(UdpToPropName, m_peerName);
+}
+
+unsigned NativeSocket::connectionPropertiesImpl() const
+{
+    return ConnectionProperty_Autoconnect;
+}
+
+void NativeSocket::reactorReady()
+{
+    while (0U < m_reactor.poll(0)) {}
+    reportReceived();
+}
+
+bool NativeSocket::connectTcpClient()
+{
+    auto host = m_config.m_host;
+    if (host.empty()) {
+        host = "127.0.0.1";
+    }
+
+    auto fd = connectTo(host, m_config.m_port, SOCK_STREAM);
+    if (fd < 0) {
+        reportError("Failed to connect to " + QString::fromStdString(host) + QString(":%1").arg(m_config.m_port));
+        return false;
+    }
+
+    int noDelay = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    m_localName = localName(fd);
+    m_peerName = peerName(fd);
+    return addConnection(0U, fd, m_peerName);
+}
+
+bool NativeSocket::listenTcpServer()
+{
+    m_listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_listenFd < 0) {
+        reportError("Failed to create TCP/IP server socket.");
+        return false;
+    }
+
+    int reuse = 1;
+    ::setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(m_config.m_localPort);
+
+    if ((::bind(m_listenFd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) ||
+        (::listen(m_listenFd, SOMAXCONN) != 0)) {
+        reportError("Failed to listen on specified TCP/IP port.");
+        return false;
+    }
+
+    m_localName = localName(m_listenFd);
+    m_listenToken =
+        m_reactor.add(
+            m_listenFd,
+            InputEvents,
+            [this](unsigned events)
+            {
+                static_cast<void>(events);
+                acceptConnections();
+            });
+
+    return m_listenToken != 0U;
+}
+
+bool NativeSocket::openUdp()
+{
+    auto fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        reportError("Failed to create UDP socket.");
+        return false;
+    }
+
+    int reuse = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Give more room to the bursts between the reactor wakeups,
+    // the kernel caps it by net.core.rmem_max anyway.
+    int recvBufSize = static_cast<int>(UdpRecvBufSize);
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &recvBufSize, sizeof(recvBufSize));
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(m_config.m_localPort);
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        reportError("Failed to bind UDP socket to port " + QString("%1").arg(m_config.m_localPort));
+        ::close(fd);
+        return false;
+    }
+
+    m_udpConnected = false;
+    if (!m_config.m_host.empty()) {
+        if (connectTo(m_config.m_host, m_config.m_port, SOCK_DGRAM, fd) < 0) {
+            reportError(
+                "Failed to connect UDP socket to " +
+                QString::fromStdString(m_config.m_host) + QString(":%1").arg(m_config.m_port));
+        }
+        else {
+            m_udpConnected = true;
+            m_peerName = peerName(fd);
+        }
+    }
+
+    m_localName = localName(fd);
+    auto& conn = m_connections[0U];
+    conn.m_fd = fd;
+    conn.m_token =
+        m_reactor.add(
+            fd,
+            InputEvents,
+            [this](unsigned events)
+            {
+                static_cast<void>(events);
+                readDatagrams();
+            });
+
+    return conn.m_token != 0U;
+}
+
+bool NativeSocket::addConnection(ConnectionId id, int fd, const QString& name)
+{
+    if (!setNonBlocking(fd)) {
+        ::close(fd);
+        return false;
+    }
+
+    auto& conn = m_connections[id];
+    conn.m_fd = fd;
+    conn.m_name = name;
+
+    QVariantMap endpoints;
+    if (m_config.m_type == Type::TcpServer) {
+        endpoints.insert(TcpFromPropName, name);
+        endpoints.insert(TcpToPropName, m_localName);
+    }
+    else {
+        endpoints.insert(TcpFromPropName, m_peerName);
+        endpoints.insert(TcpToPropName, m_localName);
+    }
+    conn.m_endpoints = cc::internDataEndpoints(endpoints);
+    conn.m_token =
+        m_reactor.add(
+            fd,
+            StreamEvents,
+            [this, id](unsigned events)
+            {
+                connectionEvent(id, events);
+            });
+
+    if (conn.m_token == 0U) {
+        closeConnection(id);
+        return false;
+    }
+
+    return true;
+}
+
+void NativeSocket::closeConnection(ConnectionId id)
+{
+    auto iter = m_connections.find(id);
+    if (iter == m_connections.end()) {
+        return;
+    }
+
+    m_reactor.remove(iter->second.m_token);
+    ::close(iter->second.m_fd);
+    m_connections.erase(iter);
+
+    if (id != 0U) {
+        // Reported after the data received from the connection
+        m_closed.push_back(id);
+    }
+}
+
+void NativeSocket::closeAll()
+{
+    for (auto& elem : m_connections) {
+        auto& conn = elem.second;
+        flushStream(conn);
+        m_reactor.remove(conn.m_token);
+        ::close(conn.m_fd);
+    }
+    m_connections.clear();
+
+    if (0 <= m_listenFd) {
+        m_reactor.remove(m_listenToken);
+        ::close(m_listenFd);
+        m_listenFd = -1;
+        m_listenToken = 0U;
+    }
+
+    m_udpConnected = false;
+    m_udpPeerLen = 0U;
+    m_udpLastSenderLen = 0U;
+    m_udpLastEndpoints.reset();
+}
+
+void NativeSocket::acceptConnections()
+{
+    while (true) {
+        sockaddr_storage addr;
+        socklen_t len = sizeof(addr);
+        auto fd = ::accept4(m_listenFd, reinterpret_cast<sockaddr*>(&addr), &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (0 <= fd) {
+            auto id = m_nextConnectionId;
+            ++m_nextConnectionId;
+            addConnection(id, fd, addrToString(reinterpret_cast<const sockaddr*>(&addr)));
+            continue;
+        }
+
+        if ((errno == EINTR) || (errno == ECONNABORTED)) {
+            continue;
+        }
+
+        if (!isWouldBlock()) {
+            reportReadError("accept");
+        }
+        break;
+    }
+}
+
+void NativeSocket::connectionEvent(ConnectionId id, unsigned events)
+{
+    auto iter = m_connections.find(id);
+    if (iter == m_connections.end()) {
+        return;
+    }
+
+    auto& conn = iter->second;
+    bool open = true;
+    if ((events & EPOLLOUT) != 0U) {
+        open = flushStream(conn);
+    }
+
+    if (open && ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0U)) {
+        open = readStream(id, conn);
+    }
+
+    if (open) {
+        return;
+    }
+
+    closeConnection(id);
+    if (m_config.m_type == Type::TcpClient) {
+        reportDisconnected();
+    }
+}
+
+bool NativeSocket::readStream(ConnectionId id, Connection& conn)
+{
+    // All the available data is accumulated in single data info object
+    cc::DataInfoPtr dataPtr;
+    bool open = true;
+    while (true) {
+        auto count = ::read(conn.m_fd, m_readBuf.data(), m_readBuf.size());
+        if (0 < count) {
+            if (!dataPtr) {
+                dataPtr = cc::makeDataInfo();
+                dataPtr->m_timestamp = cc::DataInfo::TimestampClock::now();
+                dataPtr->m_connectionId = id;
+            }
+
+            dataPtr->m_data.insert(dataPtr->m_data.end(), m_readBuf.begin(), m_readBuf.begin() + count);
+            continue;
+        }
+
+        if (count == 0) {
+            open = false;
+            break;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if (!isWouldBlock()) {
+            if (errno != ECONNRESET) {
+                reportReadError("read");
+            }
+            open = false;
+        }
+        break;
+    }
+
+    if (!dataPtr) {
+        return open;
+    }
+
+    dataPtr->m_endpoints = conn.m_endpoints;
+    m_received.push_back(std::move(dataPtr));
+    return open;
+}
+
+void NativeSocket::readDatagrams()
+{
+    auto iter = m_connections.find(0U);
+    if (iter == m_connections.end()) {
+        return;
+    }
+
+    auto fd = iter->second.m_fd;
+    while (true) {
+        for (auto& msg : m_udpMsgs) {
+            msg.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            msg.msg_hdr.msg_flags = 0;
+            msg.msg_len = 0U;
+        }
+
+        auto count = ::recvmmsg(fd, m_udpMsgs.data(), static_cast<unsigned>(m_udpMsgs.size()), MSG_DONTWAIT, nullptr);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (!isWouldBlock()) {
+                reportReadError("recvmmsg");
+            }
+            break;
+        }
+
+        auto timestamp = cc::DataInfo::TimestampClock::now();
+        for (auto idx = 0U; idx < static_cast<unsigned>(count); ++idx) {
+            auto& msg = m_udpMsgs[idx];
+            auto* data = reinterpret_cast<const std::uint8_t*>(m_udpIovs[idx].iov_base);
+            auto* sender = reinterpret_cast<const sockaddr*>(&m_udpAddrs[idx]);
+
+            auto dataPtr = cc::makeDataInfo();
+            dataPtr->m_timestamp = timestamp;
+            dataPtr->m_data.assign(data, data + msg.msg_len);
+            dataPtr->m_endpoints = udpEndpoints(sender, msg.msg_hdr.msg_namelen);
+            m_received.push_back(std::move(dataPtr));
+
+            if (m_udpConnected || (0U < m_udpPeerLen)) {
+                continue;
+            }
+
+            // Reply to the first sender, just like UDP socket plugin does,
+            // but without connecting the socket, which would filter out
+            // datagrams from other senders.
+            std::memcpy(&m_udpPeer, sender, msg.msg_hdr.msg_namelen);
+            m_udpPeerLen = msg.msg_hdr.msg_namelen;
+            m_peerName = addrToString(sender);
+        }
+
+        if (static_cast<unsigned>(count) < m_udpMsgs.size()) {
+            // Socket has been drained
+            break;
+        }
+    }
+}
+
+bool NativeSocket::writeStream(Connection& conn, const std::uint8_t* data, std::size_t size)
+{
+    if (!conn.m_pendingOut.empty()) {
+        // Preserve order, will be written when socket becomes writable
+        conn.m_pendingOut.insert(conn.m_pendingOut.end(), data, data + size);
+        return true;
+    }
+
+    std::size_t written = 0U;
+    while (written < size) {
+        auto count = ::send(conn.m_fd, data + written, size - written, MSG_NOSIGNAL);
+        if (0 <= count) {
+            written += static_cast<std::size_t>(count);
+            continue;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if (!isWouldBlock()) {
+            return false;
+        }
+
+        conn.m_pendingOut.assign(data + written, data + size);
+        break;
+    }
+    return true;
+}
+
+bool NativeSocket::flushStream(Connection& conn)
+{
+    if (conn.m_pendingOut.empty()) {
+        return true;
+    }
+
+    DataSeq pending;
+    pending.swap(conn.m_pendingOut);
+    return writeStream(conn, pending.data(), pending.size());
+}
+
+void NativeSocket::reportReceived()
+{
+    if (!m_received.empty()) {
+        Base::DataInfosList received;
+        received.swap(m_received);
+        reportDataListReceived(std::move(received));
+    }
+
+    std::vector<ConnectionId> closed;
+    closed.swap(m_closed);
+    for (auto id : closed) {
+        reportConnectionClosed(id);
+    }
+}
+
+void NativeSocket::reportReadError(const char* op)
+{
+    auto* errStr = std::strerror(errno);
+    reportError(QString("Native socket %1 failed: %2").arg(QString(op)).arg(QString(errStr)));
+}
+
+cc::DataEndpointsPtr NativeSocket::udpEndpoints(const sockaddr* sender, socklen_t len)
+{
+    if (m_udpLastEndpoints &&
+        (len == m_udpLastSenderLen) &&
+        (std::memcmp(sender, &m_udpLastSender, len) == 0)) {
+        return m_udpLastEndpoints;
+    }
+
+    QVariantMap endpoints;
+    endpoints.insert(UdpFromPropName, addrToString(sender));
+    endpoints.insert(UdpToPropName, m_localName);
+    m_udpLastEndpoints = cc::internDataEndpoints(endpoints);
+    std::memcpy(&m_udpLastSender, sender, len);
+    m_udpLastSenderLen = len;
+    return m_udpLastEndpoints;
+}
+
+} /* namespace comms_dump */
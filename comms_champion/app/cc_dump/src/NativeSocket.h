@@ -0,0 +1,155 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+
+#include "EpollReactor.h"
+
+namespace comms_dump
+{
+
+/// @brief Socket implemented directly on top of the native Linux sockets
+///     without using Qt networking.
+/// @details All the I/O is performed by the edge triggered @ref EpollReactor,
+///     which drains every ready descriptor into a large reusable buffer.
+///     All the data received during single reactor wakeup is reported at once
+///     using reportDataListReceived(). The UDP datagrams are received in
+///     batches using @b recvmmsg(). The reactor itself is driven by the
+///     application's event loop via single notifier on the epoll descriptor.
+class NativeSocket : public QObject,
+                     public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    typedef unsigned short PortType;
+
+    enum class Type
+    {
+        TcpClient,
+        TcpServer,
+        Udp,
+        NumOfValues
+    };
+
+    struct Config
+    {
+        Type m_type = Type::NumOfValues;
+        std::string m_host;
+        PortType m_port = 0U;
+        PortType m_localPort = 0U;
+    };
+
+    explicit NativeSocket(const Config& config);
+    ~NativeSocket() noexcept;
+
+    /// @brief Parse configuration specification string.
+    /// @details Supported formats are "tcp-client:<host>:<port>",
+    ///     "tcp-server:<port>" and "udp:<local_port>[:<host>:<port>]".
+    static bool parseConfig(const QString& spec, Config& config);
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(comms_champion::DataInfoPtr dataPtr) override;
+    virtual unsigned connectionPropertiesImpl() const override;
+
+private slots:
+    void reactorReady();
+
+private:
+    using ConnectionId = comms_champion::DataInfo::ConnectionId;
+    using DataSeq = comms_champion::DataInfo::DataSeq;
+
+    struct Connection
+    {
+        int m_fd = -1;
+        EpollReactor::Token m_token = 0U;
+        QString m_name;
+        comms_champion::DataEndpointsPtr m_endpoints;
+        DataSeq m_pendingOut;
+    };
+
+    using ConnectionsMap = std::map<ConnectionId, Connection>;
+
+    static const std::size_t UdpBatchSize = 16U;
+    static const std::size_t UdpMaxDatagramSize = 65536U;
+
+    using UdpMsgsArray = std::array<mmsghdr, UdpBatchSize>;
+    using UdpIovArray = std::array<iovec, UdpBatchSize>;
+    using UdpAddrsArray = std::array<sockaddr_storage, UdpBatchSize>;
+
+    bool connectTcpClient();
+    bool listenTcpServer();
+    bool openUdp();
+    bool addConnection(ConnectionId id, int fd, const QString& name);
+    void closeConnection(ConnectionId id);
+    void closeAll();
+    void acceptConnections();
+    void connectionEvent(ConnectionId id, unsigned events);
+    bool readStream(ConnectionId id, Connection& conn);
+    void readDatagrams();
+    bool writeStream(Connection& conn, const std::uint8_t* data, std::size_t size);
+    bool flushStream(Connection& conn);
+    void reportReadError(const char* op);
+    void reportReceived();
+    comms_champion::DataEndpointsPtr udpEndpoints(const sockaddr* sender, socklen_t len);
+
+    Config m_config;
+    EpollReactor m_reactor;
+    QSocketNotifier m_notifier;
+    ConnectionsMap m_connections;
+    ConnectionId m_nextConnectionId = 1U;
+    int m_listenFd = -1;
+    EpollReactor::Token m_listenToken = 0U;
+    QString m_localName;
+    QString m_peerName;
+    sockaddr_storage m_udpPeer;
+    socklen_t m_udpPeerLen = 0U;
+    bool m_udpConnected = false;
+    sockaddr_storage m_udpLastSender;
+    socklen_t m_udpLastSenderLen = 0U;
+    comms_champion::DataEndpointsPtr m_udpLastEndpoints;
+    DataSeq m_readBuf;
+    UdpMsgsArray m_udpMsgs;
+    UdpIovArray m_udpIovs;
+    UdpAddrsArray m_udpAddrs;
+    Base::DataInfosList m_received;
+    std::vector<ConnectionId> m_closed;
+};
+
+} /* namespace comms_dump */
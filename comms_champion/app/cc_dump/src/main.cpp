@@ -45,6 +45,14 @@ const QString InMsgsOptStr("received-msgs");
 const QString LastWaitOptStr("last-wait");
 const QString RecordSentOptStr("record-sent");
 const QString QuietOptStr("quiet");
+const QString RateOptStr("rate");
+const QString BurstOptStr("burst");
+const QString CountOptStr("count");
+const QString DurationOptStr("duration");
+const QString FilterOptStr("filter");
+const QString SearchOptStr("search");
+const QString ThreadsOptStr("threads");
+const QString NativeSocketOptStr("native-socket");
 
 void metaTypesRegisterAll()
 {
@@ -100,6 +108,79 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
     );
     parser.addOption(quietOpt);
 
+    QCommandLineOption rateOpt(
+        RateOptStr,
+        QCoreApplication::translate("main", "Load generation mode: send messages to send "
+                                            "in round-robin at the provided rate (messages per second), "
+                                            "ignoring their delays and repeats. "
+                                            "0 means as fast as possible. "
+                                            "The wait uses millisecond timer followed by polling "
+                                            "for the last millisecond, the achieved precision "
+                                            "is reported as lateness and jitter."),
+        QCoreApplication::translate("main", "msgs/s")
+    );
+    parser.addOption(rateOpt);
+
+    QCommandLineOption burstOpt(
+        BurstOptStr,
+        QCoreApplication::translate("main", "Load generation mode: number of messages sent "
+                                            "back to back on every deadline. Default is 1."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(burstOpt);
+
+    QCommandLineOption countOpt(
+        CountOptStr,
+        QCoreApplication::translate("main", "Load generation mode: total number of messages to send. "
+                                            "0 means unlimited."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(countOpt);
+
+    QCommandLineOption durationOpt(
+        DurationOptStr,
+        QCoreApplication::translate("main", "Load generation mode: duration (in milliseconds) "
+                                            "of the load generation. 0 means unlimited."),
+        QCoreApplication::translate("main", "ms")
+    );
+    parser.addOption(durationOpt);
+
+    QCommandLineOption filterOpt(
+        QStringList() << "f" << FilterOptStr,
+        QCoreApplication::translate("main", "Dump only messages matching the query, "
+                                            "space separated list of conditions, such as "
+                                            "\"id=1,2 name~text time>=1000 field.member>10\"."),
+        QCoreApplication::translate("main", "query")
+    );
+    parser.addOption(filterOpt);
+
+    QCommandLineOption searchOpt(
+        SearchOptStr,
+        QCoreApplication::translate("main", "Search mode: instead of connecting the socket, "
+                                            "load previously received messages from the file "
+                                            "and dump the ones matching the filter query."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(searchOpt);
+
+    QCommandLineOption threadsOpt(
+        ThreadsOptStr,
+        QCoreApplication::translate("main", "Number of threads to evaluate the filter query on "
+                                            "when searching the file specified by --search. "
+                                            "Default is 0, which means number of available CPU cores."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(threadsOpt);
+
+    QCommandLineOption nativeSocketOpt(
+        NativeSocketOptStr,
+        QCoreApplication::translate("main", "Use native epoll based socket (Linux only) instead of the "
+                                            "socket plugin. Supported specifications are "
+                                            "\"tcp-client:<host>:<port>\", \"tcp-server:<port>\" and "
+                                            "\"udp:<local_port>[:<host>:<port>]\"."),
+        QCoreApplication::translate("main", "spec")
+    );
+    parser.addOption(nativeSocketOpt);
 }
 
 QString getRootDir()
@@ -196,6 +277,42 @@ int main(int argc, char *argv[])
         config.m_quiet = true;
     }
 
+    if (parser.isSet(RateOptStr)) {
+        config.m_loadMode = true;
+        config.m_load.m_rate = parser.value(RateOptStr).toULongLong();
+    }
+
+    if (parser.isSet(BurstOptStr)) {
+        config.m_loadMode = true;
+        config.m_load.m_burst = parser.value(BurstOptStr).toUInt();
+    }
+
+    if (parser.isSet(CountOptStr)) {
+        config.m_loadMode = true;
+        config.m_load.m_count = parser.value(CountOptStr).toULongLong();
+    }
+
+    if (parser.isSet(DurationOptStr)) {
+        config.m_loadMode = true;
+        config.m_load.m_duration = parser.value(DurationOptStr).toULongLong();
+    }
+
+    if (parser.isSet(FilterOptStr)) {
+        config.m_filter = parser.value(FilterOptStr);
+    }
+
+    if (parser.isSet(SearchOptStr)) {
+        config.m_searchFile = parser.value(SearchOptStr);
+    }
+
+    if (parser.isSet(ThreadsOptStr)) {
+        config.m_threads = parser.value(ThreadsOptStr).toUInt();
+    }
+
+    if (parser.isSet(NativeSocketOptStr)) {
+        config.m_nativeSocket = parser.value(NativeSocketOptStr);
+    }
+
     comms_dump::AppMgr appMgr;
     if (!appMgr.start(config)) {
         std::cerr << "Failed to start!" << std::endl;
@@ -134,20 +134,22 @@ public:
     virtual void handle(field_wrapper::ArrayListWrapper& wrapper) override
     {
         auto createMembersWidgetsFunc =
-            [](field_wrapper::ArrayListWrapper& wrap) -> std::vector<FieldWidgetPtr>
+            [](field_wrapper::ArrayListWrapper& wrap, std::size_t fromIdx) -> std::vector<FieldWidgetPtr>
             {
                 std::vector<FieldWidgetPtr> allFieldsWidgets;
                 WidgetCreator otherCreator;
                 auto& memWrappers = wrap.getMembers();
-                allFieldsWidgets.reserve(memWrappers.size());
                 assert(memWrappers.size() == wrap.size());
+                if (memWrappers.size() <= fromIdx) {
+                    return allFieldsWidgets;
+                }
 
-                for (auto& memWrap : memWrappers) {
-                    memWrap->dispatch(otherCreator);
+                allFieldsWidgets.reserve(memWrappers.size() - fromIdx);
+                for (auto idx = fromIdx; idx < memWrappers.size(); ++idx) {
+                    memWrappers[idx]->dispatch(otherCreator);
                     allFieldsWidgets.push_back(otherCreator.getWidget());
                 }
 
-                assert(allFieldsWidgets.size() == wrap.size());
                 return allFieldsWidgets;
             };
 
@@ -224,14 +226,40 @@ DefaultMessageDisplayHandler::MsgWidgetPtr DefaultMessageDisplayHandler::getMsgW
     return std::move(m_widget);
 }
 
+bool DefaultMessageDisplayHandler::rebindMsgWidget(
+    Message& msg,
+    MessageWidget& widget)
+{
+    auto* defWidget = qobject_cast<DefaultMessageWidget*>(&widget);
+    if (defWidget == nullptr) {
+        return false;
+    }
+
+    m_rebindWidget = defWidget;
+    msg.dispatch(*this);
+    m_rebindWidget = nullptr;
+    widget.refresh();
+    return true;
+}
+
 void DefaultMessageDisplayHandler::beginMsgHandlingImpl(
     Message& msg)
 {
+    if (m_rebindWidget != nullptr) {
+        m_rebindWidget->rebindMessage(msg);
+        return;
+    }
+
     m_widget.reset(new DefaultMessageWidget(msg));
 }
 
 void DefaultMessageDisplayHandler::addExtraTransportFieldImpl(FieldWrapperPtr wrapper)
 {
+    if (m_rebindWidget != nullptr) {
+        m_rebindWidget->rebindExtraTransportField(*wrapper);
+        return;
+    }
+
     assert(m_widget);
     WidgetCreator creator;
     wrapper->dispatch(creator);
@@ -242,6 +270,11 @@ void DefaultMessageDisplayHandler::addExtraTransportFieldImpl(FieldWrapperPtr wr
 
 void DefaultMessageDisplayHandler::addFieldImpl(FieldWrapperPtr wrapper)
 {
+    if (m_rebindWidget != nullptr) {
+        m_rebindWidget->rebindField(*wrapper);
+        return;
+    }
+
     assert(m_widget);
     WidgetCreator creator;
     wrapper->dispatch(creator);
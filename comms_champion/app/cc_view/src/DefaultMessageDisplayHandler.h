@@ -44,6 +44,7 @@ public:
     ~DefaultMessageDisplayHandler() noexcept;
 
     MsgWidgetPtr getMsgWidget();
+    bool rebindMsgWidget(Message& msg, MessageWidget& widget);
 
 protected:
 
@@ -55,6 +56,7 @@ private:
 
     using DefaultMsgWidgetPtr = std::unique_ptr<DefaultMessageWidget>;
     DefaultMsgWidgetPtr m_widget;
+    DefaultMessageWidget* m_rebindWidget = nullptr;
 };
 
 }  // namespace comms_champion
@@ -20,6 +20,10 @@
 
 #include <cassert>
 #include <memory>
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <mutex>
 
 #include "comms/CompileControl.h"
 
@@ -70,6 +74,17 @@ QString getConfigPath(const QString& configName)
 
 }  // namespace
 
+struct GuiAppMgr::RecvQueryState
+{
+    MsgQuery m_query;
+    AllMessages m_msgs;
+    MsgQuery::TimestampsList m_timestamps;
+    std::mutex m_lock;
+    AllMessages m_found;
+    bool m_complete = false;
+    std::atomic<bool> m_cancelled{false};
+};
+
 GuiAppMgr* GuiAppMgr::instance()
 {
     return &(instanceRef());
@@ -81,7 +96,10 @@ GuiAppMgr& GuiAppMgr::instanceRef()
     return mgr;
 }
 
-GuiAppMgr::~GuiAppMgr() noexcept = default;
+GuiAppMgr::~GuiAppMgr() noexcept
+{
+    cancelRecvQuery();
+}
 
 bool GuiAppMgr::startClean()
 {
@@ -396,11 +414,42 @@ bool GuiAppMgr::recvListEmpty() const
 void GuiAppMgr::recvLoadMsgsFromFile(const QString& filename)
 {
     auto& msgMgr = MsgMgrG::instanceRef();
-    auto msgs = MsgFileMgrG::instanceRef().load(MsgFileMgr::Type::Recv, filename, *msgMgr.getProtocol());
-
     clearRecvList(false);
     msgMgr.deleteAllMsgs();
 
+    auto createProtocolFunc =
+        []() -> ProtocolPtr
+        {
+            auto& pluginMgr = PluginMgrG::instanceRef();
+            for (auto& info : pluginMgr.getAppliedPlugins()) {
+                auto* plugin = pluginMgr.loadPlugin(*info);
+                if (plugin == nullptr) {
+                    continue;
+                }
+
+                auto protocol = plugin->createProtocol();
+                if (protocol) {
+                    return protocol;
+                }
+            }
+            return ProtocolPtr();
+        };
+
+    m_recvLoadHandler =
+        MsgFileMgrG::instanceRef().startStreamLoad(
+            MsgFileMgr::Type::Recv,
+            filename,
+            createProtocolFunc,
+            [this]()
+            {
+                QMetaObject::invokeMethod(this, "recvLoadBatchReady", Qt::QueuedConnection);
+            });
+
+    if (m_recvLoadHandler) {
+        return;
+    }
+
+    auto msgs = MsgFileMgrG::instanceRef().load(MsgFileMgr::Type::Recv, filename, *msgMgr.getProtocol());
     msgMgr.addMsgs(msgs);
 }
 
@@ -429,6 +478,18 @@ unsigned GuiAppMgr::recvListModeMask() const
     return m_recvListMode;
 }
 
+bool GuiAppMgr::recvApplySearch(const QString& expr)
+{
+    MsgQuery query;
+    if (!query.parse(expr)) {
+        return false;
+    }
+
+    m_recvQuery = query;
+    refreshRecvList();
+    return true;
+}
+
 GuiAppMgr::SendState GuiAppMgr::sendState() const
 {
     return m_sendState;
@@ -728,6 +789,11 @@ void GuiAppMgr::msgAdded(MessagePtr msg)
     std::cout << prefix << msg->name() << std::endl;
 #endif
 
+    if (m_recvListRefreshInProgress) {
+        m_recvListPendingMsgs.push_back(std::move(msg));
+        return;
+    }
+
     if (!canAddToRecvList(*msg, type)) {
         return;
     }
@@ -768,6 +834,56 @@ void GuiAppMgr::pendingDisplayTimeout()
     }
 }
 
+void GuiAppMgr::recvLoadBatchReady()
+{
+    if (!m_recvLoadHandler) {
+        return;
+    }
+
+    bool complete = MsgFileMgr::isStreamLoadComplete(m_recvLoadHandler);
+    auto msgs = MsgFileMgr::takeStreamLoaded(m_recvLoadHandler);
+    if (complete) {
+        m_recvLoadHandler.reset();
+    }
+
+    if (!msgs.empty()) {
+        MsgMgrG::instanceRef().addMsgs(msgs);
+    }
+}
+
+void GuiAppMgr::recvQueryBatchReady()
+{
+    if (!m_recvQueryState) {
+        return;
+    }
+
+    AllMessages found;
+    bool complete = false;
+    {
+        std::lock_guard<std::mutex> guard(m_recvQueryState->m_lock);
+        found.swap(m_recvQueryState->m_found);
+        complete = m_recvQueryState->m_complete;
+    }
+
+    if (!found.empty()) {
+        auto firstIdx = m_recvListCount;
+        addMsgsToRecvList(found);
+
+        if (m_recvQueryClickedMsg && (!m_clickedMsg)) {
+            auto iter = std::find(found.begin(), found.end(), m_recvQueryClickedMsg);
+            if (iter != found.end()) {
+                auto idx = firstIdx + static_cast<unsigned>(std::distance(found.begin(), iter));
+                auto clickedMsg = std::move(m_recvQueryClickedMsg);
+                recvMsgClicked(std::move(clickedMsg), static_cast<int>(idx));
+            }
+        }
+    }
+
+    if (complete) {
+        completeRecvQuery();
+    }
+}
+
 void GuiAppMgr::msgClicked(MessagePtr msg, SelectionType selType)
 {
     assert(msg);
@@ -800,6 +916,11 @@ void GuiAppMgr::clearDisplayedMessage()
 void GuiAppMgr::refreshRecvList()
 {
     auto clickedMsg = m_clickedMsg;
+    if (!clickedMsg) {
+        // Selection may be not restored yet by the previous query
+        clickedMsg = m_recvQueryClickedMsg;
+    }
+
     if (m_selType == SelectionType::Recv) {
         assert(m_clickedMsg);
         assert(0 < m_recvListCount);
@@ -812,17 +933,32 @@ void GuiAppMgr::refreshRecvList()
 
     clearRecvList(false);
 
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
-    for (auto& msg : allMsgs) {
-        assert(msg);
-        auto type = property::message::Type().getFrom(*msg);
+    MsgMgr::MsgCategoriesList categories;
+    if (recvListShowsReceived()) {
+        categories.push_back(MsgMgr::MsgCategory::Received);
+    }
 
-        if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
-            if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, static_cast<int>(m_recvListCount) - 1);
-            }
+    if (recvListShowsSent()) {
+        categories.push_back(MsgMgr::MsgCategory::Sent);
+    }
+
+    if (recvListShowsGarbage()) {
+        categories.push_back(MsgMgr::MsgCategory::Garbage);
+    }
+
+    auto msgs = MsgMgrG::instanceRef().getMsgs(categories);
+    if (!m_recvQuery.empty()) {
+        m_recvQueryClickedMsg = std::move(clickedMsg);
+        startRecvQuery(std::move(msgs));
+        return;
+    }
+
+    addMsgsToRecvList(msgs);
+
+    if (clickedMsg) {
+        auto iter = std::find(msgs.begin(), msgs.end(), clickedMsg);
+        if (iter != msgs.end()) {
+            recvMsgClicked(clickedMsg, static_cast<int>(std::distance(msgs.begin(), iter)));
         }
     }
 
@@ -831,6 +967,94 @@ void GuiAppMgr::refreshRecvList()
     }
 }
 
+void GuiAppMgr::startRecvQuery(AllMessages&& msgs)
+{
+    assert(!m_recvQueryState);
+    auto state = std::make_shared<RecvQueryState>();
+    state->m_query = m_recvQuery;
+    state->m_msgs = std::move(msgs);
+    // The message properties may be updated on this thread (e.g. comment
+    // edit) while the query is running, retrieve the needed ones up front.
+    state->m_timestamps = m_recvQuery.snapshotTimestamps(state->m_msgs);
+    m_recvQueryState = state;
+    m_recvListRefreshInProgress = true;
+
+    // The query is evaluated on the snapshot of the messages list,
+    // the matching messages are reported back in batches.
+    m_recvQueryThread =
+        std::thread(
+            [this, state]()
+            {
+                auto notifyFunc =
+                    [this]()
+                    {
+                        QMetaObject::invokeMethod(this, "recvQueryBatchReady", Qt::QueuedConnection);
+                    };
+
+                state->m_query.run(
+                    state->m_msgs,
+                    state->m_timestamps,
+                    [&state, &notifyFunc](const AllMessages& found)
+                    {
+                        bool notify = false;
+                        {
+                            std::lock_guard<std::mutex> guard(state->m_lock);
+                            notify = state->m_found.empty();
+                            state->m_found.insert(state->m_found.end(), found.begin(), found.end());
+                        }
+
+                        if (notify) {
+                            notifyFunc();
+                        }
+                    },
+                    [&state]() -> bool
+                    {
+                        return state->m_cancelled;
+                    });
+
+                {
+                    std::lock_guard<std::mutex> guard(state->m_lock);
+                    state->m_complete = true;
+                }
+                notifyFunc();
+            });
+}
+
+void GuiAppMgr::cancelRecvQuery()
+{
+    if (!m_recvQueryState) {
+        return;
+    }
+
+    m_recvQueryState->m_cancelled = true;
+    m_recvQueryThread.join();
+    m_recvQueryState.reset();
+    m_recvQueryClickedMsg.reset();
+    m_recvListPendingMsgs.clear();
+    m_recvListRefreshInProgress = false;
+}
+
+void GuiAppMgr::completeRecvQuery()
+{
+    assert(m_recvQueryState);
+    m_recvQueryThread.join();
+    m_recvQueryState.reset();
+    m_recvQueryClickedMsg.reset();
+    m_recvListRefreshInProgress = false;
+
+    if (!m_clickedMsg) {
+        emit sigRecvMsgListClearSelection();
+    }
+
+    // Messages reported while the query was running are not part
+    // of the processed snapshot.
+    AllMessages pendingMsgs;
+    pendingMsgs.swap(m_recvListPendingMsgs);
+    for (auto& m : pendingMsgs) {
+        msgAdded(std::move(m));
+    }
+}
+
 void GuiAppMgr::addMsgToRecvList(MessagePtr msg)
 {
     assert(msg);
@@ -839,8 +1063,22 @@ void GuiAppMgr::addMsgToRecvList(MessagePtr msg)
     emit sigAddRecvMsg(msg);
 }
 
+void GuiAppMgr::addMsgsToRecvList(const AllMessages& msgs)
+{
+    if (msgs.empty()) {
+        return;
+    }
+
+    m_recvListCount += static_cast<decltype(m_recvListCount)>(msgs.size());
+    emit sigRecvListCountReport(m_recvListCount);
+    emit sigAddRecvMsgs(msgs);
+}
+
 void GuiAppMgr::clearRecvList(bool reportDeleted)
 {
+    m_recvLoadHandler.reset();
+    cancelRecvQuery();
+
     bool wasSelected = (m_selType == SelectionType::Recv);
     bool sendSelected = (m_selType == SelectionType::Send);
     assert((!wasSelected) || (m_clickedMsg));
@@ -862,20 +1100,23 @@ void GuiAppMgr::clearRecvList(bool reportDeleted)
 }
 
 bool GuiAppMgr::canAddToRecvList(
-    const Message& msg,
+    Message& msg,
     MsgType type) const
 {
     assert((type == MsgType::Received) || (type == MsgType::Sent));
 
+    bool shown = false;
     if (type == MsgType::Sent) {
-        return recvListShowsSent();
+        shown = recvListShowsSent();
     }
-
-    if (!msg.idAsString().isEmpty()) {
-        return recvListShowsReceived();
+    else if (!msg.idAsString().isEmpty()) {
+        shown = recvListShowsReceived();
+    }
+    else {
+        shown = recvListShowsGarbage();
     }
 
-    return recvListShowsGarbage();
+    return shown && m_recvQuery.matches(msg);
 }
 
 void GuiAppMgr::decRecvListCount()
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <thread>
 
 #include "comms/CompileControl.h"
 
@@ -33,6 +34,8 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/Message.h"
 #include "comms_champion/PluginMgr.h"
 #include "comms_champion/MsgSendMgr.h"
+#include "comms_champion/MsgQuery.h"
+#include "comms_champion/MsgFileMgr.h"
 
 #include "MsgMgrG.h"
 
@@ -65,6 +68,7 @@ public:
     };
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::AllMessages AllMessages;
     typedef std::shared_ptr<QAction> ActionPtr;
     typedef PluginMgr::ListOfPluginInfos ListOfPluginInfos;
     typedef Protocol::MessagesList MessagesList;
@@ -93,6 +97,7 @@ public:
     bool recvListShowsSent() const;
     bool recvListShowsGarbage() const;
     unsigned recvListModeMask() const;
+    bool recvApplySearch(const QString& expr);
 
     SendState sendState() const;
     void sendAddNewMessage(MessagePtr msg);
@@ -154,6 +159,7 @@ public slots:
 
 signals:
     void sigAddRecvMsg(MessagePtr msg);
+    void sigAddRecvMsgs(const AllMessages& msgs);
     void sigAddSendMsg(MessagePtr msg);
     void sigSendMsgUpdated(MessagePtr msg);
     void sigSetRecvState(int state);
@@ -205,6 +211,8 @@ private:
         Send
     };
 
+    struct RecvQueryState;
+
     GuiAppMgr(QObject* parentObj = nullptr);
     void emitRecvStateUpdate();
     void emitSendStateUpdate();
@@ -214,6 +222,8 @@ private slots:
     void errorReported(const QString& msg);
     void socketDisconnected();
     void pendingDisplayTimeout();
+    void recvLoadBatchReady();
+    void recvQueryBatchReady();
 
 private /*data*/:
 
@@ -221,9 +231,13 @@ private /*data*/:
     void displayMessage(MessagePtr msg);
     void clearDisplayedMessage();
     void refreshRecvList();
+    void startRecvQuery(AllMessages&& msgs);
+    void cancelRecvQuery();
+    void completeRecvQuery();
     void addMsgToRecvList(MessagePtr msg);
+    void addMsgsToRecvList(const AllMessages& msgs);
     void clearRecvList(bool reportDeleted);
-    bool canAddToRecvList(const Message& msg, MsgType type) const;
+    bool canAddToRecvList(Message& msg, MsgType type) const;
     void decRecvListCount();
     void decSendListCount();
     void emitRecvNotSelected();
@@ -238,6 +252,13 @@ private /*data*/:
         RecvListMode_ShowReceived |
         RecvListMode_ShowSent |
         RecvListMode_ShowGarbage;
+    MsgQuery m_recvQuery;
+    std::shared_ptr<RecvQueryState> m_recvQueryState;
+    std::thread m_recvQueryThread;
+    MessagePtr m_recvQueryClickedMsg;
+    AllMessages m_recvListPendingMsgs;
+    bool m_recvListRefreshInProgress = false;
+    MsgFileMgr::StreamLoadHandler m_recvLoadHandler;
 
     SendState m_sendState = SendState::Idle;
     unsigned m_sendListCount = 0;
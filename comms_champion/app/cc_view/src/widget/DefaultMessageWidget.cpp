@@ -35,7 +35,7 @@ DefaultMessageWidget::DefaultMessageWidget(
     Message& msg,
     QWidget* parentObj)
   : Base(parentObj),
-    m_msg(msg),
+    m_msg(&msg),
     m_layout(new LayoutType())
 {
     setLayout(m_layout);
@@ -53,7 +53,7 @@ void DefaultMessageWidget::addExtraTransportFieldWidget(FieldWidget* field)
         return;
     }
 
-    auto& props = m_msg.extraTransportFieldsProperties();
+    auto& props = m_msg->extraTransportFieldsProperties();
     if (static_cast<decltype(m_curExtraTransportFieldIdx)>(props.size()) <= m_curExtraTransportFieldIdx) {
         return;
     }
@@ -69,6 +69,7 @@ void DefaultMessageWidget::addExtraTransportFieldWidget(FieldWidget* field)
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
+    m_extraTransportFields.push_back(field);
 
     ++m_curExtraTransportFieldIdx;
 }
@@ -82,7 +83,7 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
         return;
     }
 
-    auto& props = m_msg.fieldsProperties();
+    auto& props = m_msg->fieldsProperties();
     if (m_curFieldIdx < static_cast<decltype(m_curFieldIdx)>(props.size())) {
         auto& propsMapVar = props.at(static_cast<int>(m_curFieldIdx));
         if (propsMapVar.isValid() && propsMapVar.canConvert<QVariantMap>()) {
@@ -96,10 +97,41 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
+    m_fields.push_back(field);
 
     ++m_curFieldIdx;
 }
 
+void DefaultMessageWidget::rebindMessage(Message& msg)
+{
+    m_msg = &msg;
+    m_rebindExtraTransportFieldIdx = 0U;
+    m_rebindFieldIdx = 0U;
+}
+
+void DefaultMessageWidget::rebindExtraTransportField(field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_extraTransportFields.size() <= m_rebindExtraTransportFieldIdx) {
+        return;
+    }
+
+    m_extraTransportFields[m_rebindExtraTransportFieldIdx]->rebind(wrapper);
+    ++m_rebindExtraTransportFieldIdx;
+}
+
+void DefaultMessageWidget::rebindField(field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_fields.size() <= m_rebindFieldIdx) {
+        static constexpr bool Field_widget_should_exist = false;
+        static_cast<void>(Field_widget_should_exist);
+        assert(Field_widget_should_exist);
+        return;
+    }
+
+    m_fields[m_rebindFieldIdx]->rebind(wrapper);
+    ++m_rebindFieldIdx;
+}
+
 void DefaultMessageWidget::refreshImpl()
 {
     emit sigRefreshFields();
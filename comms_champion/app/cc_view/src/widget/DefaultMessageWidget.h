@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -45,6 +46,10 @@ public:
     void addExtraTransportFieldWidget(FieldWidget* field);
     void addFieldWidget(FieldWidget* field);
 
+    void rebindMessage(Message& msg);
+    void rebindExtraTransportField(field_wrapper::FieldWrapper& wrapper);
+    void rebindField(field_wrapper::FieldWrapper& wrapper);
+
 protected:
     virtual void refreshImpl() override;
     virtual void setEditEnabledImpl(bool enabled) override;
@@ -58,10 +63,14 @@ private:
     void connectFieldSignals(FieldWidget* field);
 
     using LayoutType = QVBoxLayout;
-    Message& m_msg;
+    Message* m_msg = nullptr;
     LayoutType* m_layout;
     uint m_curExtraTransportFieldIdx = 0;
     uint m_curFieldIdx = 0;
+    std::vector<FieldWidget*> m_extraTransportFields;
+    std::vector<FieldWidget*> m_fields;
+    std::size_t m_rebindExtraTransportFieldIdx = 0U;
+    std::size_t m_rebindFieldIdx = 0U;
 };
 
 }  // namespace comms_champion
@@ -18,6 +18,8 @@
 #include "MsgDetailsWidget.h"
 
 #include <cassert>
+#include <algorithm>
+#include <typeinfo>
 
 CC_DISABLE_WARNINGS()
 #include <QtWidgets/QScrollBar>
@@ -38,6 +40,8 @@ const QString& getTitlePrefix()
     return Str;
 }
 
+const std::size_t MaxCachedWidgets = 16U;
+
 }  // namespace
 
 MsgDetailsWidget::MsgDetailsWidget(QWidget* parentObj)
@@ -62,15 +66,24 @@ void MsgDetailsWidget::setEditEnabled(bool enabled)
 void MsgDetailsWidget::displayMessage(MessagePtr msg)
 {
     assert(msg);
-    msg->dispatch(m_msgDisplayHandler);
-    auto msgWidget = m_msgDisplayHandler.getMsgWidget();
-    assert(msgWidget);
-    msgWidget->setEditEnabled(m_editEnabled);
+    cacheDisplayedWidget();
 
-    connect(
-        msgWidget.get(), SIGNAL(sigMsgUpdated()),
-        this, SIGNAL(sigMsgUpdated()));
+    auto msgWidget = takeCachedWidget(*msg);
+    if (msgWidget && (!m_msgDisplayHandler.rebindMsgWidget(*msg, *msgWidget))) {
+        msgWidget.reset();
+    }
 
+    if (!msgWidget) {
+        msg->dispatch(m_msgDisplayHandler);
+        msgWidget = m_msgDisplayHandler.getMsgWidget();
+        assert(msgWidget);
+
+        connect(
+            msgWidget.get(), SIGNAL(sigMsgUpdated()),
+            this, SIGNAL(sigMsgUpdated()));
+    }
+
+    msgWidget->setEditEnabled(m_editEnabled);
     m_displayedMsgWidget = msgWidget.get();
 
     auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
@@ -101,9 +114,7 @@ void MsgDetailsWidget::updateTitle(MessagePtr msg)
 
 void MsgDetailsWidget::clear()
 {
-    delete m_displayedMsgWidget;
-    m_displayedMsgWidget = nullptr;
-    m_displayedMsg.reset();
+    cacheDisplayedWidget();
     m_ui.m_scrollArea->setWidget(new QWidget());
     m_ui.m_groupBox->setTitle(getTitlePrefix());
 }
@@ -115,6 +126,49 @@ void MsgDetailsWidget::refresh()
     }
 }
 
+void MsgDetailsWidget::cacheDisplayedWidget()
+{
+    if ((m_displayedMsgWidget == nullptr) || (!m_displayedMsg)) {
+        return;
+    }
+
+    auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
+    assert(scrollBar != nullptr);
+    scrollBar->blockSignals(true);
+    MsgWidgetPtr msgWidget(qobject_cast<MessageWidget*>(m_ui.m_scrollArea->takeWidget()));
+    scrollBar->blockSignals(false);
+    assert(msgWidget.get() == m_displayedMsgWidget);
+
+    msgWidget->hide();
+    m_cachedWidgets.emplace_front(std::type_index(typeid(*m_displayedMsg)), std::move(msgWidget));
+    if (MaxCachedWidgets < m_cachedWidgets.size()) {
+        m_cachedWidgets.pop_back();
+    }
+
+    m_displayedMsgWidget = nullptr;
+    m_displayedMsg.reset();
+}
+
+MsgDetailsWidget::MsgWidgetPtr MsgDetailsWidget::takeCachedWidget(Message& msg)
+{
+    std::type_index msgType(typeid(msg));
+    auto iter =
+        std::find_if(
+            m_cachedWidgets.begin(), m_cachedWidgets.end(),
+            [&msgType](const CachedWidgetInfo& info)
+            {
+                return info.first == msgType;
+            });
+
+    if (iter == m_cachedWidgets.end()) {
+        return MsgWidgetPtr();
+    }
+
+    auto msgWidget = std::move(iter->second);
+    m_cachedWidgets.erase(iter);
+    return msgWidget;
+}
+
 void MsgDetailsWidget::widgetScrolled(int value)
 {
     if (m_displayedMsg == nullptr) {
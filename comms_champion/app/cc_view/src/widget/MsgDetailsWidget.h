@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <typeindex>
+#include <utility>
 
 #include "comms/CompileControl.h"
 
@@ -54,10 +57,18 @@ private slots:
     void widgetScrolled(int value);
 
 private:
+    using MsgWidgetPtr = DefaultMessageDisplayHandler::MsgWidgetPtr;
+    using CachedWidgetInfo = std::pair<std::type_index, MsgWidgetPtr>;
+    using CachedWidgetsList = std::list<CachedWidgetInfo>;
+
+    void cacheDisplayedWidget();
+    MsgWidgetPtr takeCachedWidget(Message& msg);
+
     Ui::MsgDetailsWidget m_ui;
     DefaultMessageDisplayHandler m_msgDisplayHandler;
     MessageWidget* m_displayedMsgWidget = nullptr;
     MessagePtr m_displayedMsg;
+    CachedWidgetsList m_cachedWidgets;
     bool m_editEnabled = true;
 };
 
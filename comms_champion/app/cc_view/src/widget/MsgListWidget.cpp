@@ -72,36 +72,24 @@ MsgListWidget::MsgListWidget(
 void MsgListWidget::addMessage(MessagePtr msg)
 {
     assert(msg);
-    m_ui.m_listWidget->addItem(getMsgNameText(msg));
-    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
-    item->setToolTip(msgTooltipImpl());
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::Type().getFrom(*msg);
-    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
-
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
+    auto* item = addMessageItem(std::move(msg));
+    finaliseAddedItems(item);
+}
 
-    if (m_selectOnAdd) {
-        m_ui.m_listWidget->blockSignals(true);
-        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
-        m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
+void MsgListWidget::addMessages(const AllMessages& msgs)
+{
+    if (msgs.empty()) {
+        return;
     }
 
-    if (m_ui.m_listWidget->currentRow() < 0) {
-        m_ui.m_listWidget->scrollToBottom();
+    m_ui.m_listWidget->setUpdatesEnabled(false);
+    QListWidgetItem* item = nullptr;
+    for (auto& msg : msgs) {
+        assert(msg);
+        item = addMessageItem(msg);
     }
-
-    updateTitle();
+    finaliseAddedItems(item);
+    m_ui.m_listWidget->setUpdatesEnabled(true);
 }
 
 void MsgListWidget::updateCurrentMessage(MessagePtr msg)
@@ -415,6 +403,48 @@ void MsgListWidget::msgCommentUpdated(MessagePtr msg)
     }
 }
 
+QListWidgetItem* MsgListWidget::addMessageItem(MessagePtr msg)
+{
+    assert(msg);
+    m_ui.m_listWidget->addItem(getMsgNameText(msg));
+    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
+    item->setToolTip(msgTooltipImpl());
+
+    bool valid = msg->isValid();
+
+    auto type = property::message::Type().getFrom(*msg);
+    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
+        item->setForeground(getItemColourImpl(type, valid));
+    }
+    else {
+        item->setForeground(defaultItemColour(valid));
+    }
+
+    item->setData(
+        Qt::UserRole,
+        QVariant::fromValue(msg));
+
+    return item;
+}
+
+void MsgListWidget::finaliseAddedItems(QListWidgetItem* lastItem)
+{
+    assert(lastItem != nullptr);
+    if (m_selectOnAdd) {
+        m_ui.m_listWidget->blockSignals(true);
+        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
+        m_ui.m_listWidget->blockSignals(false);
+        assert(m_ui.m_listWidget->currentItem() == lastItem);
+    }
+
+    static_cast<void>(lastItem);
+    if (m_ui.m_listWidget->currentRow() < 0) {
+        m_ui.m_listWidget->scrollToBottom();
+    }
+
+    updateTitle();
+}
+
 MessagePtr MsgListWidget::getMsgFromItem(QListWidgetItem* item) const
 {
     auto var = item->data(Qt::UserRole);
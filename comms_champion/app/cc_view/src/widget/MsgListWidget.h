@@ -45,6 +45,7 @@ class MsgListWidget : public QWidget
 public:
     typedef GuiAppMgr::MsgType MsgType;
     typedef GuiAppMgr::MessagesList MessagesList;
+    typedef GuiAppMgr::AllMessages AllMessages;
 
     MsgListWidget(
         const QString& title,
@@ -53,6 +54,7 @@ public:
 
 protected slots:
     void addMessage(MessagePtr msg);
+    void addMessages(const AllMessages& msgs);
     void updateCurrentMessage(MessagePtr msg);
     void deleteCurrentMessage();
     void selectOnAdd(bool enabled);
@@ -92,6 +94,8 @@ private slots:
     void msgCommentUpdated(MessagePtr msg);
 
 private:
+    QListWidgetItem* addMessageItem(MessagePtr msg);
+    void finaliseAddedItems(QListWidgetItem* lastItem);
     MessagePtr getMsgFromItem(QListWidgetItem* item) const;
     QString getMsgNameText(MessagePtr msg);
     Qt::GlobalColor defaultItemColour(bool valid) const;
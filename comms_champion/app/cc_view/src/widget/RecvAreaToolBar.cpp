@@ -24,6 +24,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
 #include <QtWidgets/QAction>
+#include <QtWidgets/QLineEdit>
 #include <QtGui/QIcon>
 CC_ENABLE_WARNINGS()
 
@@ -38,6 +39,13 @@ namespace
 
 const QString StartTooltip("Start Reception");
 const QString StopTooltip("Stop Reception");
+const QString SearchTooltip(
+    "Filter displayed messages, e.g.:\n"
+    "  id=1,2\n"
+    "  name~Status\n"
+    "  time>=1000 time<2000\n"
+    "  field.path>10");
+const int SearchDelay = 300;
 
 QAction* createStartButton(QToolBar& bar)
 {
@@ -127,6 +135,16 @@ QAction* createShowReceived(QToolBar& bar)
     return action;
 }
 
+QLineEdit* createSearchEdit()
+{
+    auto* edit = new QLineEdit();
+    edit->setPlaceholderText("Search");
+    edit->setToolTip(SearchTooltip);
+    edit->setClearButtonEnabled(true);
+    edit->setMaximumWidth(250);
+    return edit;
+}
+
 QAction* createShowSent(QToolBar& bar)
 {
     auto guiAppMgr = GuiAppMgr::instance();
@@ -155,6 +173,7 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_showGarbageButton(createShowGarbage(*this)),
     m_showRecvButton(createShowReceived(*this)),
     m_showSentButton(createShowSent(*this)),
+    m_searchEdit(createSearchEdit()),
     m_state(GuiAppMgr::instance()->recvState()),
     m_sendState(GuiAppMgr::instance()->sendState()),
     m_activeState(GuiAppMgr::instance()->getActivityState())
@@ -163,6 +182,20 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     auto empty = new QWidget();
     empty->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
     insertWidget(m_showGarbageButton, empty);
+    insertWidget(m_showGarbageButton, m_searchEdit);
+
+    m_searchTimer.setSingleShot(true);
+    connect(
+        &m_searchTimer, SIGNAL(timeout()),
+        this, SLOT(applySearch()));
+
+    connect(
+        m_searchEdit, SIGNAL(textChanged(const QString&)),
+        this, SLOT(searchTextEdited()));
+
+    connect(
+        m_searchEdit, SIGNAL(returnPressed()),
+        this, SLOT(applySearch()));
 
     connect(
         m_startStopButton, SIGNAL(triggered()),
@@ -209,6 +242,23 @@ void RecvAreaToolBar::recvListCountReport(unsigned count)
     refresh();
 }
 
+void RecvAreaToolBar::searchTextEdited()
+{
+    m_searchTimer.start(SearchDelay);
+}
+
+void RecvAreaToolBar::applySearch()
+{
+    m_searchTimer.stop();
+    bool valid = GuiAppMgr::instance()->recvApplySearch(m_searchEdit->text());
+    if (valid) {
+        m_searchEdit->setStyleSheet(QString());
+    }
+    else {
+        m_searchEdit->setStyleSheet("QLineEdit { color: red; }");
+    }
+}
+
 void RecvAreaToolBar::recvMsgSelectedReport(int idx)
 {
     m_selectedIdx = idx;
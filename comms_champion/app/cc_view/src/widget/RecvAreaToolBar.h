@@ -25,11 +25,13 @@
 
 CC_DISABLE_WARNINGS()
 #include <QtWidgets/QToolBar>
+#include <QtCore/QTimer>
 CC_ENABLE_WARNINGS()
 
 #include "GuiAppMgr.h"
 
 class QAction;
+class QLineEdit;
 
 namespace comms_champion
 {
@@ -52,6 +54,8 @@ private slots:
     void recvStateChanged(int state);
     void sendStateChanged(int state);
     void activeStateChanged(int state);
+    void searchTextEdited();
+    void applySearch();
 
 private:
     void refresh();
@@ -76,6 +80,8 @@ private:
     QAction* m_showGarbageButton = nullptr;
     QAction* m_showRecvButton = nullptr;
     QAction* m_showSentButton = nullptr;
+    QLineEdit* m_searchEdit = nullptr;
+    QTimer m_searchTimer;
     State m_state = State::Idle;
     SendState m_sendState = SendState::Idle;
     ActivityState m_activeState = ActivityState::Inactive;
@@ -45,6 +45,9 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     connect(
         guiMgr, SIGNAL(sigAddRecvMsg(MessagePtr)),
         this, SLOT(addMessage(MessagePtr)));
+    connect(
+        guiMgr, SIGNAL(sigAddRecvMsgs(const AllMessages&)),
+        this, SLOT(addMessages(const AllMessages&)));
     connect(
         guiMgr, SIGNAL(sigRecvMsgListSelectOnAddEnabled(bool)),
         this, SLOT(selectOnAdd(bool)));
@@ -75,6 +75,12 @@ void ArrayListElementWidget::setNameSuffix(const QString& value)
     m_fieldWidget->setNameSuffix(value);
 }
 
+void ArrayListElementWidget::rebind(field_wrapper::FieldWrapper& wrapper)
+{
+    assert(m_fieldWidget != nullptr);
+    m_fieldWidget->rebind(wrapper);
+}
+
 void ArrayListElementWidget::updateUi()
 {
     bool deleteButtonVisible = m_editEnabled && m_deletable;
@@ -111,24 +117,39 @@ ArrayListFieldWidget::~ArrayListFieldWidget() noexcept = default;
 
 void ArrayListFieldWidget::refreshImpl()
 {
-    while (!m_elements.empty()) {
+    if (m_wrapper->hasFixedSize()) {
+        m_wrapper->adjustFixedSize();
+    }
+
+    m_wrapper->refreshMembers();
+
+    auto& memWrappers = m_wrapper->getMembers();
+    while (memWrappers.size() < m_elements.size()) {
         assert(m_elements.back() != nullptr);
         delete m_elements.back();
         m_elements.pop_back();
     }
 
-    if (m_wrapper->hasFixedSize()) {
-        m_wrapper->adjustFixedSize();
+    // Reuse existing element widgets, only the newly
+    // grown elements will require widget creation.
+    for (auto idx = 0U; idx < m_elements.size(); ++idx) {
+        auto* elem = m_elements[idx];
+        assert(elem != nullptr);
+        elem->rebind(*memWrappers[idx]);
+        elem->refresh();
     }
 
-    m_wrapper->refreshMembers();
-
     refreshInternal();
     addMissingFields();
     updatePrefixField();
     assert(m_elements.size() == m_wrapper->size());
 }
 
+void ArrayListFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ArrayListFieldWidget::editEnabledUpdatedImpl()
 {
     for (auto* elem : m_elements) {
@@ -283,8 +304,7 @@ void ArrayListFieldWidget::addMissingFields()
         return;
     }
 
-    assert(m_elements.empty());
-    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_wrapper);
+    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_wrapper, m_elements.size());
     for (auto& fieldWidgetPtr : fieldWidgets) {
         addDataField(fieldWidgetPtr.release());
     }
@@ -51,6 +51,7 @@ public:
     void setDeletable(bool deletable);
     void updateProperties(const QVariantMap& props);
     void setNameSuffix(const QString& value);
+    void rebind(field_wrapper::FieldWrapper& wrapper);
 
 signals:
     void sigFieldUpdated();
@@ -72,7 +73,7 @@ class ArrayListFieldWidget : public FieldWidget
 public:
     using Wrapper = field_wrapper::ArrayListWrapper;
     using WrapperPtr = Wrapper::Ptr;
-    typedef std::function<std::vector<FieldWidgetPtr> (Wrapper&)> CreateMissingDataFieldsFunc;
+    typedef std::function<std::vector<FieldWidgetPtr> (Wrapper&, std::size_t)> CreateMissingDataFieldsFunc;
 
     explicit ArrayListFieldWidget(
         WrapperPtr wrapper,
@@ -90,6 +91,7 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void updatePropertiesImpl(const QVariantMap& props) override;
 
@@ -82,6 +82,17 @@ void BitfieldFieldWidget::refreshImpl()
     refreshMembers();
 }
 
+void BitfieldFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+    auto& memWrappers = m_wrapper->getMembers();
+    assert(memWrappers.size() == m_members.size());
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        assert(m_members[idx] != nullptr);
+        m_members[idx]->rebind(*memWrappers[idx]);
+    }
+}
+
 void BitfieldFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
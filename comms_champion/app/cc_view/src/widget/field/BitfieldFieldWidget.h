@@ -45,6 +45,7 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void updatePropertiesImpl(const QVariantMap& props) override;
 
@@ -85,6 +85,11 @@ void BitmaskValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void BitmaskValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void BitmaskValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
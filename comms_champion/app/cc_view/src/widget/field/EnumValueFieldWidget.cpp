@@ -106,6 +106,11 @@ void EnumValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void EnumValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void EnumValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
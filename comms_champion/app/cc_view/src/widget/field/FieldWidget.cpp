@@ -64,6 +64,11 @@ void FieldWidget::refresh()
     refreshImpl();
 }
 
+void FieldWidget::rebind(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindImpl(wrapper);
+}
+
 void FieldWidget::setEditEnabled(bool enabled)
 {
     m_editEnabled = enabled;
@@ -58,6 +58,8 @@ public:
         return m_nameSuffix;
     }
 
+    void rebind(field_wrapper::FieldWrapper& wrapper);
+
 public slots:
     void refresh();
     void setEditEnabled(bool enabled);
@@ -123,7 +125,16 @@ protected:
         m_serValueWidget = widget;
     }
 
+    template <typename TWrapperPtr>
+    static void rebindWrapper(TWrapperPtr& wrapperPtr, field_wrapper::FieldWrapper& wrapper)
+    {
+        using WrapperType = typename TWrapperPtr::element_type;
+        assert(dynamic_cast<WrapperType*>(&wrapper) != nullptr);
+        wrapperPtr = static_cast<WrapperType&>(wrapper).clone();
+    }
+
     virtual void refreshImpl() = 0;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) = 0;
     virtual void editEnabledUpdatedImpl();
     virtual void updatePropertiesImpl(const QVariantMap& props);
 
@@ -107,6 +107,11 @@ void FloatValueFieldWidget::refreshImpl()
 
 }
 
+void FloatValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void FloatValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
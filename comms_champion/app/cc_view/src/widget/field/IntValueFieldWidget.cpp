@@ -55,6 +55,16 @@ void IntValueFieldWidget::refreshImpl()
     }
 }
 
+void IntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_childWidget) {
+        m_childWidget->rebind(wrapper);
+        return;
+    }
+
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void IntValueFieldWidget::editEnabledUpdatedImpl()
 {
     if (m_childWidget) {
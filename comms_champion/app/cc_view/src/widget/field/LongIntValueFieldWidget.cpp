@@ -82,6 +82,11 @@ void LongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void LongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void LongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
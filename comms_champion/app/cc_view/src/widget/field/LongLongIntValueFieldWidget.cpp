@@ -78,6 +78,11 @@ void LongLongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void LongLongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void LongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -72,6 +72,17 @@ void OptionalFieldWidget::refreshImpl()
     refreshField();
 }
 
+void OptionalFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+    if (m_wrapper->getMode() == Mode::Tentative) {
+        m_wrapper->setMode(Mode::Missing);
+    }
+
+    assert(m_field != nullptr);
+    m_field->rebind(m_wrapper->getFieldWrapper());
+}
+
 void OptionalFieldWidget::editEnabledUpdatedImpl()
 {
     assert(m_field != nullptr);
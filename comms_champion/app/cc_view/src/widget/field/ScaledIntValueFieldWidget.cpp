@@ -89,6 +89,11 @@ void ScaledIntValueFieldWidget::refreshImpl()
     }
 }
 
+void ScaledIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ScaledIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
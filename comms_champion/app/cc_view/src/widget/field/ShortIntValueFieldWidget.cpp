@@ -80,6 +80,11 @@ void ShortIntValueFieldWidget::refreshImpl()
     }
 }
 
+void ShortIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ShortIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
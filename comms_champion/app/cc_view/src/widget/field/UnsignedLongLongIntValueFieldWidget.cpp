@@ -79,6 +79,11 @@ void UnsignedLongLongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void UnsignedLongLongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void UnsignedLongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
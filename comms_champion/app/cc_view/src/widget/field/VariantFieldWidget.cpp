@@ -68,6 +68,7 @@ void VariantFieldWidget::setMemberField(FieldWidget* memberFieldWidget)
         delete m_member;
     }
     m_member = memberFieldWidget;
+    m_memberIdx = m_wrapper->getCurrentIndex();
     m_ui.m_membersLayout->addWidget(m_member);
 
     assert(m_ui.m_membersLayout->count() == 1);
@@ -85,6 +86,29 @@ void VariantFieldWidget::refreshImpl()
     refreshMember();
 }
 
+void VariantFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+    auto& current = m_wrapper->getCurrent();
+    if ((m_member != nullptr) &&
+        (current) &&
+        (m_memberIdx == m_wrapper->getCurrentIndex())) {
+        m_member->rebind(*current);
+    }
+    else {
+        delete m_member;
+        m_member = nullptr;
+        m_memberIdx = -1;
+        if (current) {
+            createMemberWidget();
+            m_member->setEditEnabled(isEditEnabled());
+        }
+    }
+
+    updateIndexValue();
+    updateMemberCombo();
+}
+
 void VariantFieldWidget::editEnabledUpdatedImpl()
 {
     bool readOnly = !isEditEnabled();
@@ -285,6 +309,7 @@ void VariantFieldWidget::destroyMemberWidget()
 {
     delete m_member;
     m_member = nullptr;
+    m_memberIdx = -1;
     m_wrapper->setCurrent(field_wrapper::FieldWrapperPtr());
     m_wrapper->setCurrentIndex(-1);
 }
@@ -295,6 +320,7 @@ void VariantFieldWidget::createMemberWidget()
     assert(m_createFunc);
     auto fieldWidget = m_createFunc(*m_wrapper->getCurrent());
     m_member = fieldWidget.release();
+    m_memberIdx = m_wrapper->getCurrentIndex();
     m_ui.m_membersLayout->addWidget(m_member);
     updateMemberProps();
 
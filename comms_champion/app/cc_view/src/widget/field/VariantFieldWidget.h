@@ -48,6 +48,7 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void updatePropertiesImpl(const QVariantMap& props) override;
 
@@ -71,6 +72,7 @@ private:
     Ui::VariantFieldWidget m_ui;
     WrapperPtr m_wrapper;
     FieldWidget* m_member = nullptr;
+    int m_memberIdx = -1;
     QList<QVariantMap> m_membersProps;
     CreateMemberFieldWidgetFunc m_createFunc;
     bool m_indexHidden = false;
@@ -35,6 +35,18 @@ CC_ENABLE_WARNINGS()
 namespace comms_champion
 {
 
+/// @brief Interned properties describing connection endpoints,
+///     see @ref internDataEndpoints().
+/// @headerfile "comms_champion/DataInfo.h"
+struct DataEndpoints
+{
+    QVariantMap m_props; ///< Properties (such as "from" and "to" addresses)
+    std::string m_json; ///< Properties encoded as JSON
+};
+
+/// @brief Reference counted pointer to the interned @ref DataEndpoints
+using DataEndpointsPtr = std::shared_ptr<const DataEndpoints>;
+
 /// @brief Information about incomming or outdoing data
 /// @headerfile "comms_champion/DataInfo.h"
 struct DataInfo
@@ -51,18 +63,48 @@ struct DataInfo
     /// @brief Type of extra properties storage
     using PropertiesMap = QVariantMap;
 
+    /// @brief Type of connection identity
+    using ConnectionId = unsigned long long;
+
     Timestamp m_timestamp; ///< Timestam when data has been received / sent
     DataSeq m_data; ///< Actual raw data
     PropertiesMap m_extraProperties; ///< Extra properties that can be used by
                                      /// other componets
+    ConnectionId m_connectionId = 0U; ///< Identity of the connection (stream)
+                                      /// the data belongs to, 0 when the socket
+                                      /// doesn't distinguish between connections
+    DataEndpointsPtr m_endpoints; ///< Interned properties describing connection
+                                  /// endpoints, empty when not used.
 };
 
 /// @brief Pointer to @ref DataInfo
 using DataInfoPtr = std::shared_ptr<DataInfo>;
 
-/// @brief Dynamically allocate @ref DataInfo and return in in @ref DataInfoPtr;
+/// @brief Allocate @ref DataInfo and return in in @ref DataInfoPtr;
+/// @details The object and its reference counter are allocated together
+///     (using std::allocate_shared()) from the pool of memory blocks, which
+///     are recycled when the last reference is released. The storage of
+///     the @ref DataInfo::m_data is also recycled (up to 256KB of capacity
+///     per object), i.e. the returned object may have empty data with
+///     non-zero capacity. Thread safe.
 CC_API DataInfoPtr makeDataInfo();
 
+/// @brief Intern the properties describing connection endpoints (such as
+///     "from" and "to" addresses).
+/// @details Expected to be invoked by the socket once per connection.
+///     The returned pointer is assigned to @ref DataInfo::m_endpoints of
+///     every data chunk instead of populating @ref DataInfo::m_extraProperties.
+///     The same properties result in the same object while it is referenced,
+///     the properties are discarded when the last reference (held by the
+///     socket or by any @ref DataInfo object) is released. Thread safe.
+/// @return Interned properties, empty pointer in case of empty properties map.
+CC_API DataEndpointsPtr internDataEndpoints(const QVariantMap& props);
+
+/// @brief Materialise all the extra properties of the data.
+/// @details Merges properties referenced by @ref DataInfo::m_endpoints
+///     with @ref DataInfo::m_extraProperties, the latter take precedence.
+CC_API QVariantMap dataInfoProperties(const DataInfo& info);
+
 }  // namespace comms_champion
 
 Q_DECLARE_METATYPE(comms_champion::DataInfoPtr);
@@ -65,7 +65,7 @@ public:
 
     /// @brief Process received data
     /// @details Process the data, received by I/O socket or other filter
-    ///     down the chain.
+    ///     down the chain. Invokes virtual recvDataIntoImpl().
     /// @param[in] dataPtr Incoming data from I/O socket or other filter
     ///     down the chain
     /// @return Data to forward to the protocol or to other filter up the
@@ -74,13 +74,45 @@ public:
 
     /// @brief Process outgoing data
     /// @details Process the data, generated by the protocol or other filter
-    ///     up the chain.
+    ///     up the chain. Invokes virtual sendDataIntoImpl().
     /// @param[in] dataPtr Outgoing data generated by the protocol or
     ///     other filter up the chain.
     /// @return Data to forward to the I/O socket or other filter down the
     ///     chain
     QList<DataInfoPtr> sendData(DataInfoPtr dataPtr);
 
+    /// @brief List of data chunks used by the allocation-free processing
+    ///     interface.
+    using DataInfosList = std::vector<DataInfoPtr>;
+
+    /// @brief Process received data into caller-provided storage.
+    /// @details Allocation-free alternative to recvData(). The processed
+    ///     data is appended to the provided @b output list, which is expected
+    ///     to be reused by the caller between invocations. Invokes virtual
+    ///     recvDataIntoImpl().
+    /// @param[in] dataPtr Incoming data from I/O socket or other filter
+    ///     down the chain
+    /// @param[out] output List to append the data to be forwarded to the
+    ///     protocol or to other filter up the chain.
+    void recvDataInto(DataInfoPtr dataPtr, DataInfosList& output);
+
+    /// @brief Process outgoing data into caller-provided storage.
+    /// @details Allocation-free alternative to sendData(). The processed
+    ///     data is appended to the provided @b output list, which is expected
+    ///     to be reused by the caller between invocations. Invokes virtual
+    ///     sendDataIntoImpl().
+    /// @param[in] dataPtr Outgoing data generated by the protocol or
+    ///     other filter up the chain.
+    /// @param[out] output List to append the data to be forwarded to the
+    ///     I/O socket or other filter down the chain.
+    void sendDataInto(DataInfoPtr dataPtr, DataInfosList& output);
+
+    /// @brief Check whether the filter currently forwards all the data
+    ///     without any modification.
+    /// @details The driver of the filters chain skips such filter altogether.
+    ///     Invokes virtual isPassThroughImpl().
+    bool isPassThrough() const;
+
     /// @brief Type of callback to report outgoing data.
     using DataToSendCallback = std::function<void (DataInfoPtr)>;
 
@@ -117,15 +149,38 @@ protected:
     ///     It can be overridden by the derived class.
     virtual void stopImpl();
 
-    /// @brief Polymorphic processing of incoming data.
-    /// @details Invoked by recvData() and must be implemented in the derived
-    ///     class
-    virtual QList<DataInfoPtr> recvDataImpl(DataInfoPtr dataPtr) = 0;
-
-    /// @brief Polymorphic processing of outgoing data.
-    /// @details Invoked by sendData() and must be implemented in the derived
-    ///     class
-    virtual QList<DataInfoPtr> sendDataImpl(DataInfoPtr dataPtr) = 0;
+    /// @brief Legacy polymorphic processing of incoming data.
+    /// @details Invoked by the default implementation of recvDataIntoImpl().
+    ///     The default implementation forwards the data as is. The derived
+    ///     class is expected to override either this function or
+    ///     recvDataIntoImpl().
+    virtual QList<DataInfoPtr> recvDataImpl(DataInfoPtr dataPtr);
+
+    /// @brief Legacy polymorphic processing of outgoing data.
+    /// @details Invoked by the default implementation of sendDataIntoImpl().
+    ///     The default implementation forwards the data as is. The derived
+    ///     class is expected to override either this function or
+    ///     sendDataIntoImpl().
+    virtual QList<DataInfoPtr> sendDataImpl(DataInfoPtr dataPtr);
+
+    /// @brief Polymorphic allocation-free processing of incoming data.
+    /// @details Invoked by recvData() and recvDataInto(). The derived class
+    ///     is expected to modify the data in place (if needed) and append
+    ///     it to the @b output list. The default implementation invokes
+    ///     recvDataImpl() and appends its result.
+    virtual void recvDataIntoImpl(DataInfoPtr dataPtr, DataInfosList& output);
+
+    /// @brief Polymorphic allocation-free processing of outgoing data.
+    /// @details Invoked by sendData() and sendDataInto(). The derived class
+    ///     is expected to modify the data in place (if needed) and append
+    ///     it to the @b output list. The default implementation invokes
+    ///     sendDataImpl() and appends its result.
+    virtual void sendDataIntoImpl(DataInfoPtr dataPtr, DataInfosList& output);
+
+    /// @brief Polymorphic check of the pass-through mode.
+    /// @details Invoked by isPassThrough(), default implementation returns
+    ///     false. It can be overridden by the derived class.
+    virtual bool isPassThroughImpl() const;
 
     /// @brief Report new data to send generated by the filter itself.
     /// @details This function needs to be invoked by the derived class when
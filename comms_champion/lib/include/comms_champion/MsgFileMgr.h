@@ -21,6 +21,7 @@
 #include <utility>
 #include <list>
 #include <memory>
+#include <functional>
 
 #include "comms/CompileControl.h"
 
@@ -69,6 +70,19 @@ public:
     static void addToRecvSave(FileSaveHandler handler, const Message& msg, bool flush = false);
     static void flushRecvFile(FileSaveHandler handler);
 
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
+    typedef std::function<void ()> StreamLoadNotifyFunc;
+    class StreamLoader;
+    typedef std::shared_ptr<StreamLoader> StreamLoadHandler;
+    StreamLoadHandler startStreamLoad(
+        Type type,
+        const QString& filename,
+        const ProtocolCreateFunc& createFunc,
+        StreamLoadNotifyFunc&& notifyFunc,
+        unsigned threadsCount = 0U);
+    static MessagesList takeStreamLoaded(StreamLoadHandler handler);
+    static bool isStreamLoadComplete(StreamLoadHandler handler);
+
 private:
     QString m_lastFile;
 };
@@ -40,6 +40,15 @@ public:
 
     typedef Message::Type MsgType;
 
+    enum class MsgCategory {
+        Received,
+        Sent,
+        Garbage,
+        NumOfValues
+    };
+
+    typedef std::vector<MsgCategory> MsgCategoriesList;
+
     MsgMgr();
     ~MsgMgr() noexcept;
 
@@ -55,8 +64,13 @@ public:
     void deleteAllMsgs();
 
     void sendMsgs(MessagesList&& msgs);
+    void sendData(DataInfoPtr dataPtr);
 
     const AllMessages& getAllMsgs() const;
+    const AllMessages& getMsgs(MsgCategory category) const;
+    AllMessages getMsgs(const MsgCategoriesList& categories) const;
+    const AllMessages& getMsgsById(const QString& id) const;
+    static MsgCategory getMsgCategory(const Message& msg);
     void addMsgs(const MessagesList& msgs, bool reportAdded = true);
 
     void setSocket(SocketPtr socket);
@@ -0,0 +1,97 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+#include "Message.h"
+
+namespace comms_champion
+{
+
+class MsgQueryImpl;
+class CC_API MsgQuery
+{
+public:
+    typedef std::vector<MessagePtr> MsgsList;
+    typedef unsigned long long Timestamp;
+    typedef std::vector<Timestamp> TimestampsList;
+    typedef std::function<void (const MsgsList& msgs)> ResultsReportCallbackFunc;
+    typedef std::function<bool ()> CancelCheckFunc;
+
+    enum class CompareOp {
+        Equal,
+        NotEqual,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Contains,
+        NumOfValues
+    };
+
+    MsgQuery();
+    MsgQuery(const MsgQuery& other);
+    ~MsgQuery() noexcept;
+
+    MsgQuery& operator=(const MsgQuery& other);
+
+    void clear();
+    bool empty() const;
+
+    void addId(const QString& id);
+    void setName(const QString& name);
+    void setTimestampRange(Timestamp from, Timestamp to);
+    void addFieldCondition(const QString& fieldPath, CompareOp op, const QString& value);
+    bool parse(const QString& expr);
+
+    void setThreadsCount(unsigned count);
+
+    bool matches(Message& msg) const;
+    MsgsList run(
+        const MsgsList& msgs,
+        const ResultsReportCallbackFunc& func = ResultsReportCallbackFunc(),
+        const CancelCheckFunc& cancelFunc = CancelCheckFunc()) const;
+
+    // Retrieves the message properties used by the query, allows
+    // evaluation of the query on another thread using run() below
+    // while the properties of the messages can be updated.
+    TimestampsList snapshotTimestamps(const MsgsList& msgs) const;
+    MsgsList run(
+        const MsgsList& msgs,
+        const TimestampsList& timestamps,
+        const ResultsReportCallbackFunc& func = ResultsReportCallbackFunc(),
+        const CancelCheckFunc& cancelFunc = CancelCheckFunc()) const;
+
+private:
+    std::unique_ptr<MsgQueryImpl> m_impl;
+};
+
+}  // namespace comms_champion
+
+
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <functional>
+#include <cstdint>
 
 #include "Api.h"
 #include "Message.h"
@@ -34,6 +35,29 @@ public:
     typedef Protocol::MessagesList MessagesList;
     typedef std::function<void (MessagesList&&)> SendMsgsCallbackFunc;
     typedef std::function<void ()> SendCompleteCallbackFunc;
+    typedef std::function<void (DataInfoPtr)> SendDataCallbackFunc;
+
+    struct LoadConfig
+    {
+        unsigned long long m_rate = 0U; // messages per second, 0 - as fast as possible
+        unsigned m_burst = 1U; // messages sent back to back on every deadline
+        unsigned long long m_count = 0U; // total messages to send, 0 - unlimited
+        unsigned long long m_duration = 0U; // milliseconds, 0 - unlimited
+    };
+
+    struct LoadStats
+    {
+        unsigned long long m_sentCount = 0U;
+        unsigned long long m_sentBytes = 0U;
+        unsigned long long m_elapsedUs = 0U;
+        double m_achievedRate = 0.0; // messages per second
+        unsigned long long m_minLatenessUs = 0U;
+        unsigned long long m_maxLatenessUs = 0U;
+        double m_avgLatenessUs = 0.0;
+        double m_jitterUs = 0.0; // mean deviation of burst intervals from nominal one
+    };
+
+    typedef std::function<void (const LoadStats&)> LoadCompleteCallbackFunc;
 
     MsgSendMgr();
     ~MsgSendMgr() noexcept;
@@ -41,7 +65,11 @@ public:
     void setSendMsgsCallbackFunc(SendMsgsCallbackFunc&& func);
     void setSendCompeteCallbackFunc(SendCompleteCallbackFunc&& func);
 
+    void setSendDataCallbackFunc(SendDataCallbackFunc&& func);
+    void setLoadCompleteCallbackFunc(LoadCompleteCallbackFunc&& func);
+
     void start(ProtocolPtr protocol, const MessagesList& msgs);
+    void startLoad(ProtocolPtr protocol, const MessagesList& msgs, const LoadConfig& config);
 
     void stop();
 
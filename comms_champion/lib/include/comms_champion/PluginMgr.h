@@ -76,7 +76,8 @@ public:
     private:
         PluginInfo() = default;
 
-        PluginLoaderPtr m_loader;
+        mutable PluginLoaderPtr m_loader;
+        QString m_filename;
         QString m_iid;
         QString m_name;
         QString m_desc;
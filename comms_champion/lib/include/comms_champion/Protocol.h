@@ -76,6 +76,20 @@ public:
     /// @return List of created messages
     MessagesList read(const DataInfo& dataInfo, bool final = false);
 
+    /// @brief Check whether read() may be invoked concurrently.
+    /// @details Invokes virtual supportsConcurrentReadImpl(). When @b true
+    ///     is returned, the read() may be invoked from multiple threads
+    ///     at the same time as long as the processed data belongs to
+    ///     different connections (see @ref DataInfo::m_connectionId).
+    bool supportsConcurrentRead() const;
+
+    /// @brief Notify about closure of the connection.
+    /// @details Invokes virtual connectionClosedImpl(). Expected to be
+    ///     invoked after all the data of the connection (see @ref DataInfo::m_connectionId)
+    ///     has been passed to read(). Any incomplete input of the connection is discarded.
+    /// @param[in] id ID of the closed connection.
+    void connectionClosed(DataInfo::ConnectionId id);
+
     /// @brief Serialse message.
     /// @details Invokes writeImpl().
     /// @param[in] msg Reference to message object, passed by non-const reference
@@ -117,6 +131,16 @@ protected:
     /// @details Invoked by read().
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) = 0;
 
+    /// @brief Polymorphic inquiry whether read functionality may be invoked concurrently.
+    /// @details Invoked by supportsConcurrentRead(). The default implementation
+    ///     returns @b false.
+    virtual bool supportsConcurrentReadImpl() const;
+
+    /// @brief Polymorphic handling of the connection closure.
+    /// @details Invoked by connectionClosed(). The default implementation
+    ///     does nothing.
+    virtual void connectionClosedImpl(DataInfo::ConnectionId id);
+
     /// @brief Polymorphic write functionality.
     /// @details invoked by write().
     virtual DataInfoPtr writeImpl(Message& msg) = 0;
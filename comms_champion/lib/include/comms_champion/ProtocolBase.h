@@ -21,6 +21,10 @@
 #include <algorithm>
 #include <iterator>
 #include <cassert>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 
 #include "comms/CompileControl.h"
@@ -104,175 +108,54 @@ protected:
         "AllMessages is expected to be a tuple.");
 
     /// @brief Overriding implementation to Protocol::readImpl().
+    /// @details The data of every connection (see @ref DataInfo::m_connectionId)
+    ///     is accumulated and decoded independently using its own
+    ///     "protocol stack" object, copy-constructed from the one returned
+    ///     by protocolStack(). The data not bound to any connection is
+    ///     decoded using the object returned by protocolStack().
+    ///
+    ///     The concurrent read is not enabled by default. The derived class
+    ///     may opt in by overriding supportsConcurrentReadImpl() to return
+    ///     @b true, provided it doesn't introduce any extra state shared
+    ///     between the reads and the "protocol stack" copies don't share
+    ///     any state either.
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) override
     {
-        const std::uint8_t* iter = &dataInfo.m_data[0];
-        auto size = dataInfo.m_data.size();
-
-        MessagesList allMsgs;
-        m_data.reserve(m_data.size() + size);
-        std::copy_n(iter, size, std::back_inserter(m_data));
-
-        using ReadIterator = typename ProtocolMessage::ReadIterator;
-        ReadIterator readIterBeg = &m_data[0];
-
-        auto remainingSizeCalc =
-            [this](ReadIterator readIter) -> std::size_t
-            {
-                ReadIterator const dataBegin = &m_data[0];
-                auto consumed =
-                    static_cast<std::size_t>(
-                        std::distance(dataBegin, readIter));
-                assert(consumed <= m_data.size());
-                return m_data.size() - consumed;
-            };
-
-        auto eraseGuard =
-            comms::util::makeScopeGuard(
-                [this, &readIterBeg]()
-                {
-                    ReadIterator dataBegin = &m_data[0];
-                    auto dist = std::distance(dataBegin, readIterBeg);
-                    m_data.erase(m_data.begin(), m_data.begin() + dist);
-                });
-
-        auto setExtraInfoFunc =
-            [&dataInfo](Message& msg)
-            {
-                if (dataInfo.m_extraProperties.isEmpty()) {
-                    return;
-                }
-
-                auto jsonObj = QJsonObject::fromVariantMap(dataInfo.m_extraProperties);
-                QJsonDocument doc(jsonObj);
-
-                std::unique_ptr<ExtraInfoMsg> extraInfoMsgPtr(new ExtraInfoMsg());
-                auto& str = std::get<0>(extraInfoMsgPtr->fields());
-                str.value() = doc.toJson().constData();
-                setExtraInfoToMessageProperties(dataInfo.m_extraProperties, msg);
-                setExtraInfoMsgToMessageProperties(
-                    MessagePtr(extraInfoMsgPtr.release()),
-                    msg);
-            };
-
-        auto checkGarbageFunc =
-            [this, &allMsgs, &setExtraInfoFunc]()
-            {
-                if (!m_garbage.empty()) {
-                    MessagePtr invalidMsgPtr(new InvalidMsg());
-                    setNameToMessageProperties(*invalidMsgPtr);
-                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
-                    ReadIterator garbageReadIterator = &m_garbage[0];
-                    auto esTmp = rawDataMsgPtr->read(garbageReadIterator, m_garbage.size());
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *invalidMsgPtr);
-                    setExtraInfoFunc(*invalidMsgPtr);
-                    allMsgs.push_back(std::move(invalidMsgPtr));
-                    m_garbage.clear();
-                }
-            };
-
-        while (true) {
-            ProtocolMsgPtr msgPtr;
-
-            auto readIterCur = readIterBeg;
-            auto remainingSize = remainingSizeCalc(readIterCur);
-            if (remainingSize == 0U) {
-                break;
-            }
-
-            auto es =
-                m_protStack.read(
-                    msgPtr,
-                    readIterCur,
-                    remainingSize);
-
-            if (es == comms::ErrorStatus::NotEnoughData) {
-                break;
-            }
-
-            auto addMsgInfoGuard =
-                comms::util::makeScopeGuard(
-                    [this, &allMsgs, &msgPtr]()
-                    {
-                        assert(msgPtr);
-                        setNameToMessageProperties(*msgPtr);
-                        allMsgs.push_back(MessagePtr(std::move(msgPtr)));
-                    });
-
-            auto setExtrasFunc =
-                [readIterBeg, &readIterCur, &msgPtr, &setExtraInfoFunc]()
-                {
-                    // readIterBeg is captured by value on purpose
-                    auto dataSize = static_cast<std::size_t>(
-                                std::distance(readIterBeg, readIterCur));
-
-                    auto readTransportIterBegTmp = readIterBeg;
-                    std::unique_ptr<TransportMsg> transportMsgPtr(new TransportMsg());
-                    auto esTmp = transportMsgPtr->read(readTransportIterBegTmp, dataSize);
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setTransportToMessageProperties(MessagePtr(transportMsgPtr.release()), *msgPtr);
-
-                    auto readRawIterBegTmp = readIterBeg;
-                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
-                    esTmp = rawDataMsgPtr->read(readRawIterBegTmp, dataSize);
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *msgPtr);
-                    setExtraInfoFunc(*msgPtr);
-                };
-
-            if (es == comms::ErrorStatus::Success) {
-                checkGarbageFunc();
-                assert(msgPtr);
-                setExtrasFunc();
-                readIterBeg = readIterCur;
-                continue;
-            }
-
-            if (es == comms::ErrorStatus::InvalidMsgData) {
-                checkGarbageFunc();
-                msgPtr.reset(new InvalidMsg());
-                setExtrasFunc();
-                readIterBeg = readIterCur;
-                continue;
-            }
-
-            addMsgInfoGuard.release();
+        if (dataInfo.m_connectionId == 0U) {
+            return readInternal(m_protStack, m_data, m_garbage, dataInfo, final);
+        }
 
-            if (es == comms::ErrorStatus::MsgAllocFailure) {
-                static constexpr bool Must_not_be_happen = false;
-                static_cast<void>(Must_not_be_happen);
-                assert(Must_not_be_happen); 
-                break;
-            }
+        auto* state = acquireConnectionState(dataInfo.m_connectionId);
+        assert(state != nullptr);
+        assert(state->m_stack);
+        auto msgs = readInternal(*state->m_stack, state->m_data, state->m_garbage, dataInfo, final);
+        releaseConnectionState(dataInfo.m_connectionId);
+        return msgs;
+    }
 
-            // Protocol error
-            m_garbage.push_back(*readIterBeg);
-            static const std::size_t GarbageLimit = 512;
-            if (GarbageLimit <= m_garbage.size()) {
-                checkGarbageFunc();
-            }
-            ++readIterBeg;
+    /// @brief Overriding implementation to Protocol::connectionClosedImpl().
+    /// @details Discards incomplete input of the closed connection and
+    ///     releases its decoding state.
+    virtual void connectionClosedImpl(DataInfo::ConnectionId id) override
+    {
+        std::lock_guard<std::mutex> guard(m_connectionsLock);
+        auto iter = m_connections.find(id);
+        if (iter == m_connections.end()) {
+            return;
         }
 
-        if (final) {
-            ReadIterator dataBegin = &m_data[0];
-            auto consumed = std::distance(dataBegin, readIterBeg);
-            auto remDataCount = static_cast<decltype(consumed)>(m_data.size()) - consumed;
-            m_garbage.insert(m_garbage.end(), m_data.begin() + consumed, m_data.end());
-            std::advance(readIterBeg, remDataCount);
-            checkGarbageFunc();
-        }
-        return allMsgs;
+        auto& statePtr = iter->second;
+        assert(statePtr);
+        statePtr->m_data.clear();
+        statePtr->m_garbage.clear();
+        recycleConnectionState(iter);
     }
 
     /// @brief Overriding implementation to Protocol::writeImpl().
     virtual DataInfoPtr writeImpl(Message& msg) override
     {
         DataInfo::DataSeq data;
+        reserveWriteData(data, static_cast<const ProtocolMessage&>(msg), LengthTag());
         auto writeIter = std::back_inserter(data);
         auto es =
             m_protStack.write(
@@ -503,6 +386,15 @@ private:
     static_assert(std::is_same<MsgIdTypeTag, NumericIdTag>::value,
         "Non-numeric IDs are not supported properly yet.");
 
+    struct HasLengthTag {};
+    struct NoLengthTag {};
+
+    typedef typename std::conditional<
+        ProtocolMessage::InterfaceOptions::HasLength,
+        HasLengthTag,
+        NoLengthTag
+    >::type LengthTag;
+
     class AllMsgsCreateHelper
     {
     public:
@@ -586,9 +478,271 @@ private:
         return result;
     }
 
+    void reserveWriteData(DataInfo::DataSeq& data, const ProtocolMessage& msg, HasLengthTag) const
+    {
+        data.reserve(m_protStack.length(msg));
+    }
+
+    void reserveWriteData(DataInfo::DataSeq&, const ProtocolMessage&, NoLengthTag) const
+    {
+    }
+
+    using DataSeq = std::vector<std::uint8_t>;
+
+    MessagesList readInternal(
+        ProtocolStack& stack,
+        DataSeq& data,
+        DataSeq& garbage,
+        const DataInfo& dataInfo,
+        bool final)
+    {
+        const std::uint8_t* iter = &dataInfo.m_data[0];
+        auto size = dataInfo.m_data.size();
+
+        MessagesList allMsgs;
+        data.reserve(data.size() + size);
+        std::copy_n(iter, size, std::back_inserter(data));
+
+        using ReadIterator = typename ProtocolMessage::ReadIterator;
+        ReadIterator readIterBeg = &data[0];
+
+        auto remainingSizeCalc =
+            [&data](ReadIterator readIter) -> std::size_t
+            {
+                ReadIterator const dataBegin = &data[0];
+                auto consumed =
+                    static_cast<std::size_t>(
+                        std::distance(dataBegin, readIter));
+                assert(consumed <= data.size());
+                return data.size() - consumed;
+            };
+
+        auto eraseGuard =
+            comms::util::makeScopeGuard(
+                [&data, &readIterBeg]()
+                {
+                    ReadIterator dataBegin = &data[0];
+                    auto dist = std::distance(dataBegin, readIterBeg);
+                    data.erase(data.begin(), data.begin() + dist);
+                });
+
+        auto setExtraInfoFunc =
+            [&dataInfo](Message& msg)
+            {
+                if (dataInfo.m_extraProperties.isEmpty()) {
+                    if (!dataInfo.m_endpoints) {
+                        return;
+                    }
+
+                    // Interned properties are implicitly shared and
+                    // their JSON representation is encoded only once.
+                    std::unique_ptr<ExtraInfoMsg> extraInfoMsgPtr(new ExtraInfoMsg());
+                    auto& str = std::get<0>(extraInfoMsgPtr->fields());
+                    str.value() = dataInfo.m_endpoints->m_json;
+                    setExtraInfoToMessageProperties(dataInfo.m_endpoints->m_props, msg);
+                    setExtraInfoMsgToMessageProperties(
+                        MessagePtr(extraInfoMsgPtr.release()),
+                        msg);
+                    return;
+                }
+
+                auto props = dataInfoProperties(dataInfo);
+                auto jsonObj = QJsonObject::fromVariantMap(props);
+                QJsonDocument doc(jsonObj);
+
+                std::unique_ptr<ExtraInfoMsg> extraInfoMsgPtr(new ExtraInfoMsg());
+                auto& str = std::get<0>(extraInfoMsgPtr->fields());
+                str.value() = doc.toJson().constData();
+                setExtraInfoToMessageProperties(props, msg);
+                setExtraInfoMsgToMessageProperties(
+                    MessagePtr(extraInfoMsgPtr.release()),
+                    msg);
+            };
+
+        auto checkGarbageFunc =
+            [this, &garbage, &allMsgs, &setExtraInfoFunc]()
+            {
+                if (!garbage.empty()) {
+                    MessagePtr invalidMsgPtr(new InvalidMsg());
+                    setNameToMessageProperties(*invalidMsgPtr);
+                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
+                    ReadIterator garbageReadIterator = &garbage[0];
+                    auto esTmp = rawDataMsgPtr->read(garbageReadIterator, garbage.size());
+                    static_cast<void>(esTmp);
+                    assert(esTmp == comms::ErrorStatus::Success);
+                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *invalidMsgPtr);
+                    setExtraInfoFunc(*invalidMsgPtr);
+                    allMsgs.push_back(std::move(invalidMsgPtr));
+                    garbage.clear();
+                }
+            };
+
+        while (true) {
+            ProtocolMsgPtr msgPtr;
+
+            auto readIterCur = readIterBeg;
+            auto remainingSize = remainingSizeCalc(readIterCur);
+            if (remainingSize == 0U) {
+                break;
+            }
+
+            auto es =
+                stack.read(
+                    msgPtr,
+                    readIterCur,
+                    remainingSize);
+
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                break;
+            }
+
+            auto addMsgInfoGuard =
+                comms::util::makeScopeGuard(
+                    [this, &allMsgs, &msgPtr]()
+                    {
+                        assert(msgPtr);
+                        setNameToMessageProperties(*msgPtr);
+                        allMsgs.push_back(MessagePtr(std::move(msgPtr)));
+                    });
+
+            auto setExtrasFunc =
+                [readIterBeg, &readIterCur, &msgPtr, &setExtraInfoFunc]()
+                {
+                    // readIterBeg is captured by value on purpose
+                    auto dataSize = static_cast<std::size_t>(
+                                std::distance(readIterBeg, readIterCur));
+
+                    auto readTransportIterBegTmp = readIterBeg;
+                    std::unique_ptr<TransportMsg> transportMsgPtr(new TransportMsg());
+                    auto esTmp = transportMsgPtr->read(readTransportIterBegTmp, dataSize);
+                    static_cast<void>(esTmp);
+                    assert(esTmp == comms::ErrorStatus::Success);
+                    setTransportToMessageProperties(MessagePtr(transportMsgPtr.release()), *msgPtr);
+
+                    auto readRawIterBegTmp = readIterBeg;
+                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
+                    esTmp = rawDataMsgPtr->read(readRawIterBegTmp, dataSize);
+                    static_cast<void>(esTmp);
+                    assert(esTmp == comms::ErrorStatus::Success);
+                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *msgPtr);
+                    setExtraInfoFunc(*msgPtr);
+                };
+
+            if (es == comms::ErrorStatus::Success) {
+                checkGarbageFunc();
+                assert(msgPtr);
+                setExtrasFunc();
+                readIterBeg = readIterCur;
+                continue;
+            }
+
+            if (es == comms::ErrorStatus::InvalidMsgData) {
+                checkGarbageFunc();
+                msgPtr.reset(new InvalidMsg());
+                setExtrasFunc();
+                readIterBeg = readIterCur;
+                continue;
+            }
+
+            addMsgInfoGuard.release();
+
+            if (es == comms::ErrorStatus::MsgAllocFailure) {
+                static constexpr bool Must_not_be_happen = false;
+                static_cast<void>(Must_not_be_happen);
+                assert(Must_not_be_happen); 
+                break;
+            }
+
+            // Protocol error
+            garbage.push_back(*readIterBeg);
+            static const std::size_t GarbageLimit = 512;
+            if (GarbageLimit <= garbage.size()) {
+                checkGarbageFunc();
+            }
+            ++readIterBeg;
+        }
+
+        if (final) {
+            ReadIterator dataBegin = &data[0];
+            auto consumed = std::distance(dataBegin, readIterBeg);
+            auto remDataCount = static_cast<decltype(consumed)>(data.size()) - consumed;
+            garbage.insert(garbage.end(), data.begin() + consumed, data.end());
+            std::advance(readIterBeg, remDataCount);
+            checkGarbageFunc();
+        }
+        return allMsgs;
+    }
+
+    struct ConnectionState
+    {
+        std::unique_ptr<ProtocolStack> m_stack;
+        DataSeq m_data;
+        DataSeq m_garbage;
+    };
+
+    using ConnectionStatePtr = std::unique_ptr<ConnectionState>;
+    using ConnectionStatesMap = std::map<DataInfo::ConnectionId, ConnectionStatePtr>;
+    using ConnectionStatesPool = std::vector<ConnectionStatePtr>;
+
+    ConnectionState* acquireConnectionState(DataInfo::ConnectionId id)
+    {
+        std::lock_guard<std::mutex> guard(m_connectionsLock);
+        auto& statePtr = m_connections[id];
+        if (statePtr) {
+            return statePtr.get();
+        }
+
+        if (!m_connectionsPool.empty()) {
+            statePtr = std::move(m_connectionsPool.back());
+            m_connectionsPool.pop_back();
+            assert(statePtr->m_stack);
+            *statePtr->m_stack = m_protStack;
+            return statePtr.get();
+        }
+
+        statePtr.reset(new ConnectionState);
+        // Preserve the configuration applied to protocolStack()
+        statePtr->m_stack.reset(new ProtocolStack(m_protStack));
+        return statePtr.get();
+    }
+
+    void releaseConnectionState(DataInfo::ConnectionId id)
+    {
+        std::lock_guard<std::mutex> guard(m_connectionsLock);
+        auto iter = m_connections.find(id);
+        if (iter == m_connections.end()) {
+            static constexpr bool Must_have_found_connection = false;
+            static_cast<void>(Must_have_found_connection);
+            assert(Must_have_found_connection);
+            return;
+        }
+
+        auto& statePtr = iter->second;
+        assert(statePtr);
+        if ((!statePtr->m_data.empty()) || (!statePtr->m_garbage.empty())) {
+            // Keep the incomplete input until next read
+            return;
+        }
+
+        recycleConnectionState(iter);
+    }
+
+    void recycleConnectionState(typename ConnectionStatesMap::iterator iter)
+    {
+        static const std::size_t MaxPooledStates = 16U;
+        if (m_connectionsPool.size() < MaxPooledStates) {
+            m_connectionsPool.push_back(std::move(iter->second));
+        }
+
+        m_connections.erase(iter);
+    }
+
     ProtocolStack m_protStack;
-    std::vector<std::uint8_t> m_data;
-    std::vector<std::uint8_t> m_garbage;
+    DataSeq m_data;
+    DataSeq m_garbage;
+    std::mutex m_connectionsLock;
+    ConnectionStatesMap m_connections;
+    ConnectionStatesPool m_connectionsPool;
 };
 
 }  // namespace comms_champion
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <vector>
+#include <list>
 #include <functional>
 
 #include "comms/CompileControl.h"
@@ -108,6 +109,23 @@ public:
         m_dataReceivedCallback = std::forward<TFunc>(func);
     }
 
+    /// @brief List of data information objects
+    using DataInfosList = std::list<DataInfoPtr>;
+
+    /// @brief Callback to report multiple incoming data chunks at once.
+    using DataListReceivedCallback = std::function<void (DataInfosList&&)>;
+
+    /// @brief Set callback to report multiple incoming data chunks at once.
+    /// @details The callback must have the same signature as @ref DataListReceivedCallback.
+    ///     When not set, the data reported using reportDataListReceived()
+    ///     is forwarded to the callback set by setDataReceivedCallback()
+    ///     one chunk at a time.
+    template <typename TFunc>
+    void setDataListReceivedCallback(TFunc&& func)
+    {
+        m_dataListReceivedCallback = std::forward<TFunc>(func);
+    }
+
     /// @brief Callback to report errors
     using ErrorReportCallback = std::function<void (const QString& msg)>;
 
@@ -130,6 +148,17 @@ public:
         m_disconnectedReportCallback = std::forward<TFunc>(func);
     }
 
+    /// @brief Callback to report closure of a connection.
+    using ConnectionClosedReportCallback = std::function <void (DataInfo::ConnectionId)>;
+
+    /// @brief Set callback to report closure of a connection.
+    /// @details The callback must have the same signature as @ref ConnectionClosedReportCallback.
+    template <typename TFunc>
+    void setConnectionClosedReportCallback(TFunc&& func)
+    {
+        m_connectionClosedReportCallback = std::forward<TFunc>(func);
+    }
+
     /// @brief Get properties describing socket connection right after plugins
     ///     have been loaded and applied.
     /// @details The returned value is used by the driving application to
@@ -179,6 +208,16 @@ protected:
     /// @param[in] New data information.
     void reportDataReceived(DataInfoPtr dataPtr);
 
+    /// @brief Report multiple data chunks have been received.
+    /// @details Expected to be invoked by the derived class, which receives
+    ///     data from multiple connections at once, to allow processing
+    ///     of the reported data in bulk. This function will invoke callback set by
+    ///     setDataListReceivedCallback() if such exists, otherwise the
+    ///     callback set by setDataReceivedCallback() is invoked for every
+    ///     data chunk.
+    /// @param[in] dataList List of new data information objects.
+    void reportDataListReceived(DataInfosList&& dataList);
+
     /// @brief Report I/O operation error.
     /// @details This function is expected to be invoked by the derived class,
     ///     when I/O error is detected. This function will invoke
@@ -193,10 +232,21 @@ protected:
     ///     derived class and it will invoke callback set by setDisconnectedReportCallback().
     void reportDisconnected();
 
+    /// @brief Report closure of a single connection.
+    /// @details Expected to be invoked by the derived class, which assigns
+    ///     @ref DataInfo::m_connectionId to the reported data, after all the
+    ///     data of the closed connection has been reported. It allows
+    ///     release of the resources allocated for the connection. This function will
+    ///     invoke callback set by setConnectionClosedReportCallback().
+    /// @param[in] id ID of the closed connection.
+    void reportConnectionClosed(DataInfo::ConnectionId id);
+
 private:
     DataReceivedCallback m_dataReceivedCallback;
+    DataListReceivedCallback m_dataListReceivedCallback;
     ErrorReportCallback m_errorReportCallback;
     DisconnectedReportCallback m_disconnectedReportCallback;
+    ConnectionClosedReportCallback m_connectionClosedReportCallback;
 
     bool m_running = false;
     bool m_connected = false;
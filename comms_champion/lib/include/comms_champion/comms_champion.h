@@ -38,6 +38,7 @@
 #include "MsgMgr.h"
 #include "MsgFileMgr.h"
 #include "MsgSendMgr.h"
+#include "MsgQuery.h"
 #include "StaticSingleton.h"
 #include "property/message.h"
 #include "property/field.h"
@@ -14,12 +14,311 @@
 
 #include "comms_champion/DataInfo.h"
 
+#include <cassert>
+#include <atomic>
+#include <map>
+#include <new>
+#include <mutex>
+#include <vector>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+CC_ENABLE_WARNINGS()
+
 namespace comms_champion
 {
 
+namespace
+{
+
+const std::size_t MaxPooledDataInfos = 1024U;
+const std::size_t MaxRetainedDataCapacity = 256U * 1024U;
+const std::size_t MaxPooledDataBytes = 32U * 1024U * 1024U;
+
+std::atomic<bool> PoolAlive(false);
+std::atomic<bool> BuffersPoolAlive(false);
+std::atomic<bool> RegistryAlive(false);
+
+// Recycles memory blocks holding DataInfo object together with its
+// reference counter, allocated by std::allocate_shared().
+class DataInfoPool
+{
+public:
+    DataInfoPool()
+    {
+        m_pool.reserve(MaxPooledDataInfos);
+        PoolAlive = true;
+    }
+
+    ~DataInfoPool() noexcept
+    {
+        PoolAlive = false;
+        for (auto* block : m_pool) {
+            ::operator delete(block);
+        }
+    }
+
+    void* alloc(std::size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (m_blockSize == 0U) {
+                m_blockSize = size;
+            }
+
+            if ((size == m_blockSize) && (!m_pool.empty())) {
+                auto* block = m_pool.back();
+                m_pool.pop_back();
+                return block;
+            }
+        }
+
+        return ::operator new(size);
+    }
+
+    void release(void* block, std::size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if ((size == m_blockSize) && (m_pool.size() < MaxPooledDataInfos)) {
+                m_pool.push_back(block);
+                return;
+            }
+        }
+
+        ::operator delete(block);
+    }
+
+private:
+    std::mutex m_lock;
+    std::vector<void*> m_pool;
+    std::size_t m_blockSize = 0U;
+};
+
+DataInfoPool& dataInfoPool()
+{
+    static DataInfoPool Pool;
+    return Pool;
+}
+
+// Recycles storage of the raw data, so the sockets reading the
+// data in chunks don't allocate new buffer for every chunk.
+class DataBuffersPool
+{
+public:
+    DataBuffersPool()
+    {
+        m_pool.reserve(MaxPooledDataInfos);
+        BuffersPoolAlive = true;
+    }
+
+    ~DataBuffersPool() noexcept
+    {
+        BuffersPoolAlive = false;
+    }
+
+    void acquire(DataInfo::DataSeq& data)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (m_pool.empty()) {
+            return;
+        }
+
+        data.swap(m_pool.back());
+        m_pool.pop_back();
+        assert(data.capacity() <= m_pooledBytes);
+        m_pooledBytes -= data.capacity();
+    }
+
+    void release(DataInfo::DataSeq& data)
+    {
+        auto capacity = data.capacity();
+        if ((capacity == 0U) || (MaxRetainedDataCapacity < capacity)) {
+            return;
+        }
+
+        data.clear();
+        std::lock_guard<std::mutex> guard(m_lock);
+        if ((MaxPooledDataInfos <= m_pool.size()) ||
+            (MaxPooledDataBytes < (m_pooledBytes + capacity))) {
+            return;
+        }
+
+        m_pool.emplace_back();
+        m_pool.back().swap(data);
+        m_pooledBytes += capacity;
+    }
+
+private:
+    std::mutex m_lock;
+    std::vector<DataInfo::DataSeq> m_pool;
+    std::size_t m_pooledBytes = 0U;
+};
+
+DataBuffersPool& dataBuffersPool()
+{
+    static DataBuffersPool Pool;
+    return Pool;
+}
+
+// Object actually allocated by makeDataInfo(), returns the storage of
+// the raw data to the pool on destruction.
+struct PooledDataInfo : public DataInfo
+{
+    PooledDataInfo()
+    {
+        dataBuffersPool().acquire(m_data);
+    }
+
+    ~PooledDataInfo() noexcept
+    {
+        if (BuffersPoolAlive) {
+            dataBuffersPool().release(m_data);
+        }
+    }
+};
+
+template <typename T>
+class DataInfoAllocator
+{
+public:
+    typedef T value_type;
+
+    DataInfoAllocator() = default;
+
+    template <typename U>
+    DataInfoAllocator(const DataInfoAllocator<U>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(dataInfoPool().alloc(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n)
+    {
+        if (!PoolAlive) {
+            // Released during static destruction
+            ::operator delete(ptr);
+            return;
+        }
+
+        dataInfoPool().release(ptr, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const DataInfoAllocator<T>&, const DataInfoAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const DataInfoAllocator<T>&, const DataInfoAllocator<U>&)
+{
+    return false;
+}
+
+class EndpointsRegistry;
+EndpointsRegistry& endpointsRegistry();
+
+// Keeps track of the interned endpoints properties while they are
+// referenced by the sockets and/or DataInfo objects.
+class EndpointsRegistry
+{
+public:
+    EndpointsRegistry()
+    {
+        RegistryAlive = true;
+    }
+
+    ~EndpointsRegistry() noexcept
+    {
+        RegistryAlive = false;
+    }
+
+    DataEndpointsPtr intern(const QVariantMap& props)
+    {
+        if (props.isEmpty()) {
+            return DataEndpointsPtr();
+        }
+
+        auto json = QJsonDocument(QJsonObject::fromVariantMap(props)).toJson();
+        std::string jsonStr(json.constData(), static_cast<std::size_t>(json.size()));
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        auto iter = m_entries.find(jsonStr);
+        if (iter != m_entries.end()) {
+            auto existing = iter->second.lock();
+            if (existing) {
+                return existing;
+            }
+
+            // Last reference is being released concurrently, the
+            // deleter won't erase the replaced entry.
+            m_entries.erase(iter);
+        }
+
+        std::unique_ptr<DataEndpoints> endpoints(new DataEndpoints);
+        endpoints->m_props = props;
+        endpoints->m_json = jsonStr;
+        DataEndpointsPtr result(endpoints.release(), &EndpointsRegistry::destroy);
+        m_entries.insert(std::make_pair(std::move(jsonStr), std::weak_ptr<const DataEndpoints>(result)));
+        return result;
+    }
+
+private:
+    static void destroy(const DataEndpoints* endpoints)
+    {
+        if (RegistryAlive) {
+            endpointsRegistry().erase(endpoints);
+        }
+
+        delete endpoints;
+    }
+
+    void erase(const DataEndpoints* endpoints)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        auto iter = m_entries.find(endpoints->m_json);
+        if ((iter != m_entries.end()) && (iter->second.expired())) {
+            m_entries.erase(iter);
+        }
+    }
+
+    std::mutex m_lock;
+    std::map<std::string, std::weak_ptr<const DataEndpoints> > m_entries;
+};
+
+EndpointsRegistry& endpointsRegistry()
+{
+    static EndpointsRegistry Registry;
+    return Registry;
+}
+
+}  // namespace
+
 CC_API DataInfoPtr makeDataInfo()
 {
-    return DataInfoPtr(new DataInfo());
+    return std::allocate_shared<PooledDataInfo>(DataInfoAllocator<PooledDataInfo>());
+}
+
+CC_API DataEndpointsPtr internDataEndpoints(const QVariantMap& props)
+{
+    return endpointsRegistry().intern(props);
+}
+
+CC_API QVariantMap dataInfoProperties(const DataInfo& info)
+{
+    if (!info.m_endpoints) {
+        return info.m_extraProperties;
+    }
+
+    auto props = info.m_endpoints->m_props;
+    for (auto iter = info.m_extraProperties.begin(); iter != info.m_extraProperties.end(); ++iter) {
+        props.insert(iter.key(), iter.value());
+    }
+    return props;
 }
 
 } // namespace comms_champion
@@ -17,9 +17,25 @@
 
 #include "comms_champion/Filter.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace comms_champion
 {
 
+namespace
+{
+
+QList<DataInfoPtr> toDataList(Filter::DataInfosList& data)
+{
+    QList<DataInfoPtr> result;
+    result.reserve(static_cast<int>(data.size()));
+    std::move(data.begin(), data.end(), std::back_inserter(result));
+    return result;
+}
+
+}  // namespace
+
 Filter::Filter() = default;
 Filter::~Filter() noexcept = default;
 
@@ -35,12 +51,31 @@ void Filter::stop()
 
 QList<DataInfoPtr> Filter::recvData(DataInfoPtr dataPtr)
 {
-    return recvDataImpl(std::move(dataPtr));
+    DataInfosList output;
+    recvDataIntoImpl(std::move(dataPtr), output);
+    return toDataList(output);
 }
 
 QList<DataInfoPtr> Filter::sendData(DataInfoPtr dataPtr)
 {
-    return sendDataImpl(std::move(dataPtr));
+    DataInfosList output;
+    sendDataIntoImpl(std::move(dataPtr), output);
+    return toDataList(output);
+}
+
+void Filter::recvDataInto(DataInfoPtr dataPtr, DataInfosList& output)
+{
+    recvDataIntoImpl(std::move(dataPtr), output);
+}
+
+void Filter::sendDataInto(DataInfoPtr dataPtr, DataInfosList& output)
+{
+    sendDataIntoImpl(std::move(dataPtr), output);
+}
+
+bool Filter::isPassThrough() const
+{
+    return isPassThroughImpl();
 }
 
 bool Filter::startImpl()
@@ -52,6 +87,33 @@ void Filter::stopImpl()
 {
 }
 
+QList<DataInfoPtr> Filter::recvDataImpl(DataInfoPtr dataPtr)
+{
+    return QList<DataInfoPtr>() << std::move(dataPtr);
+}
+
+QList<DataInfoPtr> Filter::sendDataImpl(DataInfoPtr dataPtr)
+{
+    return QList<DataInfoPtr>() << std::move(dataPtr);
+}
+
+void Filter::recvDataIntoImpl(DataInfoPtr dataPtr, DataInfosList& output)
+{
+    auto data = recvDataImpl(std::move(dataPtr));
+    output.insert(output.end(), data.begin(), data.end());
+}
+
+void Filter::sendDataIntoImpl(DataInfoPtr dataPtr, DataInfosList& output)
+{
+    auto data = sendDataImpl(std::move(dataPtr));
+    output.insert(output.end(), data.begin(), data.end());
+}
+
+bool Filter::isPassThroughImpl() const
+{
+    return false;
+}
+
 void Filter::reportDataToSend(DataInfoPtr dataPtr)
 {
     if (m_dataToSendCallback) {
@@ -0,0 +1,227 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "comms_champion/DataInfo.h"
+#include "comms_champion/MsgSendMgr.h"
+
+namespace comms_champion
+{
+
+// Schedule of the load generation, kept independent of the event loop.
+// The frames are sent in round-robin in bursts, every burst has its
+// deadline derived from the start time and the configured rate
+// (there are no deadlines when the rate is 0).
+class LoadSchedule
+{
+public:
+    typedef MsgSendMgr::LoadConfig Config;
+    typedef MsgSendMgr::LoadStats Stats;
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point Timestamp;
+    typedef std::vector<DataInfoPtr> FramesList;
+    typedef std::function<void (DataInfoPtr)> SendFunc;
+
+    void start(FramesList&& frames, const Config& config, Timestamp now)
+    {
+        m_frames = std::move(frames);
+        m_config = config;
+        m_config.m_burst = std::max(m_config.m_burst, 1U);
+        m_stats = Stats();
+        m_start = now;
+        m_prevBurst = now;
+        m_nextFrameIdx = 0U;
+        m_nextBurstIdx = 0U;
+        m_latenessSumUs = 0.0;
+        m_jitterSumUs = 0.0;
+    }
+
+    void clear()
+    {
+        m_frames.clear();
+    }
+
+    bool active() const
+    {
+        return !m_frames.empty();
+    }
+
+    bool hasDeadlines() const
+    {
+        return m_config.m_rate != 0U;
+    }
+
+    Timestamp burstDeadline(unsigned long long burstIdx) const
+    {
+        assert(hasDeadlines());
+        auto offsetNs =
+            (static_cast<long double>(burstIdx) * m_config.m_burst * 1000000000.0L) /
+                m_config.m_rate;
+
+        return
+            m_start +
+            std::chrono::duration_cast<Clock::duration>(
+                std::chrono::nanoseconds(static_cast<long long>(offsetNs)));
+    }
+
+    // Deadline of the next burst, the start time when there are no deadlines
+    Timestamp nextDeadline() const
+    {
+        if (!hasDeadlines()) {
+            return m_start;
+        }
+
+        return burstDeadline(m_nextBurstIdx);
+    }
+
+    bool complete(Timestamp now) const
+    {
+        if (m_frames.empty()) {
+            return true;
+        }
+
+        if ((m_config.m_count != 0U) &&
+            (m_config.m_count <= m_stats.m_sentCount)) {
+            return true;
+        }
+
+        if (m_config.m_duration != 0U) {
+            auto elapsedMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start).count();
+            if (static_cast<long long>(m_config.m_duration) <= elapsedMs) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Every sent frame is a fresh copy of the cached one, because the send
+    // filters are allowed to modify the data in place.
+    void sendBurst(Timestamp now, const SendFunc& func)
+    {
+        assert(!m_frames.empty());
+        if (hasDeadlines()) {
+            updateTimingStats(now);
+        }
+
+        for (auto idx = 0U; idx < m_config.m_burst; ++idx) {
+            if ((m_config.m_count != 0U) &&
+                (m_config.m_count <= m_stats.m_sentCount)) {
+                break;
+            }
+
+            auto& frame = m_frames[m_nextFrameIdx];
+            ++m_nextFrameIdx;
+            if (m_frames.size() <= m_nextFrameIdx) {
+                m_nextFrameIdx = 0U;
+            }
+
+            ++m_stats.m_sentCount;
+            m_stats.m_sentBytes += frame->m_data.size();
+            if (!func) {
+                continue;
+            }
+
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_data.assign(frame->m_data.begin(), frame->m_data.end());
+            dataPtr->m_extraProperties = frame->m_extraProperties;
+            dataPtr->m_connectionId = frame->m_connectionId;
+            dataPtr->m_endpoints = frame->m_endpoints;
+            func(std::move(dataPtr));
+        }
+
+        m_prevBurst = now;
+        ++m_nextBurstIdx;
+    }
+
+    const Stats& finish(Timestamp now)
+    {
+        auto elapsed = now - m_start;
+        m_stats.m_elapsedUs =
+            static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+        if (0U < m_stats.m_elapsedUs) {
+            m_stats.m_achievedRate =
+                (static_cast<double>(m_stats.m_sentCount) * 1000000.0) / static_cast<double>(m_stats.m_elapsedUs);
+        }
+
+        if (hasDeadlines() && (0U < m_nextBurstIdx)) {
+            m_stats.m_avgLatenessUs = m_latenessSumUs / static_cast<double>(m_nextBurstIdx);
+        }
+
+        if (hasDeadlines() && (1U < m_nextBurstIdx)) {
+            m_stats.m_jitterUs = m_jitterSumUs / static_cast<double>(m_nextBurstIdx - 1U);
+        }
+
+        m_frames.clear();
+        return m_stats;
+    }
+
+    const Stats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    void updateTimingStats(Timestamp now)
+    {
+        auto deadline = burstDeadline(m_nextBurstIdx);
+        long long latenessUs = 0;
+        if (deadline < now) {
+            latenessUs = std::chrono::duration_cast<std::chrono::microseconds>(now - deadline).count();
+        }
+
+        auto lateness = static_cast<unsigned long long>(latenessUs);
+        if ((m_nextBurstIdx == 0U) || (lateness < m_stats.m_minLatenessUs)) {
+            m_stats.m_minLatenessUs = lateness;
+        }
+
+        m_stats.m_maxLatenessUs = std::max(m_stats.m_maxLatenessUs, lateness);
+        m_latenessSumUs += static_cast<double>(lateness);
+
+        if (0U < m_nextBurstIdx) {
+            auto nominalUs =
+                std::chrono::duration<double, std::micro>(deadline - burstDeadline(m_nextBurstIdx - 1U)).count();
+            auto actualUs =
+                std::chrono::duration<double, std::micro>(now - m_prevBurst).count();
+            m_jitterSumUs += std::abs(actualUs - nominalUs);
+        }
+    }
+
+    FramesList m_frames;
+    Config m_config;
+    Stats m_stats;
+    Timestamp m_start;
+    Timestamp m_prevBurst;
+    std::size_t m_nextFrameIdx = 0U;
+    unsigned long long m_nextBurstIdx = 0U;
+    double m_latenessSumUs = 0.0;
+    double m_jitterSumUs = 0.0;
+};
+
+}  // namespace comms_champion
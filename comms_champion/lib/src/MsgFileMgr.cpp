@@ -21,6 +21,11 @@
 #include <algorithm>
 #include <iterator>
 #include <iostream>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -32,6 +37,7 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/message.h"
+#include "MsgThread.h"
 
 namespace comms_champion
 {
@@ -357,6 +363,23 @@ QVariantList convertRecvMsgList(
     return convertedList;
 }
 
+bool updateRecvMsgProps(const QVariantMap& msgMap, Message& msg)
+{
+    auto timestamp = TimestampProp().getFrom(msgMap);
+    if (timestamp == 0) {
+        // Not a receive list, skip message
+        return false;
+    }
+
+    auto type = static_cast<Message::Type>(TypeProp().getFrom(msgMap));
+    auto comment = CommentProp().getFrom(msgMap);
+
+    property::message::Timestamp().setTo(timestamp, msg);
+    property::message::Type().setTo(type, msg);
+    property::message::Comment().setTo(comment, msg);
+    return true;
+}
+
 MsgFileMgr::MessagesList convertRecvMsgList(
     const QVariantList& msgs,
     Protocol& protocol)
@@ -372,19 +395,10 @@ MsgFileMgr::MessagesList convertRecvMsgList(
         assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
 
         auto msgMap = msgMapVar.value<QVariantMap>();
-        auto timestamp = TimestampProp().getFrom(msgMap);
-        if (timestamp == 0) {
-            // Not a receive list, skip message
+        if (!updateRecvMsgProps(msgMap, *msg)) {
             continue;
         }
 
-        auto type = static_cast<Message::Type>(TypeProp().getFrom(msgMap));
-        auto comment = CommentProp().getFrom(msgMap);
-
-        property::message::Timestamp().setTo(timestamp, *msg);
-        property::message::Type().setTo(type, *msg);
-        property::message::Comment().setTo(comment, *msg);
-
         convertedList.push_back(std::move(msg));
     }
     return convertedList;
@@ -427,22 +441,11 @@ QVariantList convertSendMsgList(
     return convertedList;
 }
 
-MsgFileMgr::MessagesList convertSendMsgList(
-    const QVariantList& msgs,
-    Protocol& protocol)
+class SendMsgPropsUpdater
 {
-    MsgFileMgr::MessagesList convertedList;
-    unsigned long long prevTimestamp = 0;
-
-    for (auto& msgMapVar : msgs) {
-        auto msg = createMsgObjectFrom(msgMapVar, protocol);
-        if (!msg) {
-            continue;
-        }
-
-        assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
-
-        auto msgMap = msgMapVar.value<QVariantMap>();
+public:
+    void update(const QVariantMap& msgMap, Message& msg)
+    {
         auto delay = DelayProp().getFrom(msgMap);
         auto delayUnits = DelayUnitsProp().getFrom(msgMap);
         auto repeatDuration = RepeatProp().getFrom(msgMap);
@@ -464,32 +467,172 @@ MsgFileMgr::MessagesList convertSendMsgList(
                     break;
                 }
 
-                if (prevTimestamp == 0) {
-                    prevTimestamp = timestamp;
+                if (m_prevTimestamp == 0) {
+                    m_prevTimestamp = timestamp;
                 }
 
-                auto delayTmp = timestamp - prevTimestamp;
+                auto delayTmp = timestamp - m_prevTimestamp;
                 if (delayTmp <= 0) {
                     break;
                 }
 
-                prevTimestamp = timestamp;
+                m_prevTimestamp = timestamp;
                 delay = delayTmp;
             } while (false);
         }
 
-        property::message::Delay().setTo(delay, *msg);
-        property::message::DelayUnits().setTo(std::move(delayUnits), *msg);
-        property::message::RepeatDuration().setTo(repeatDuration, *msg);
-        property::message::RepeatDurationUnits().setTo(std::move(repeatDurationUnits), *msg);
-        property::message::RepeatCount().setTo(repeatCount, *msg);
-        property::message::Comment().setTo(comment, *msg);
+        property::message::Delay().setTo(delay, msg);
+        property::message::DelayUnits().setTo(std::move(delayUnits), msg);
+        property::message::RepeatDuration().setTo(repeatDuration, msg);
+        property::message::RepeatDurationUnits().setTo(std::move(repeatDurationUnits), msg);
+        property::message::RepeatCount().setTo(repeatCount, msg);
+        property::message::Comment().setTo(comment, msg);
+    }
+
+private:
+    unsigned long long m_prevTimestamp = 0;
+};
+
+MsgFileMgr::MessagesList convertSendMsgList(
+    const QVariantList& msgs,
+    Protocol& protocol)
+{
+    MsgFileMgr::MessagesList convertedList;
+    SendMsgPropsUpdater updater;
+
+    for (auto& msgMapVar : msgs) {
+        auto msg = createMsgObjectFrom(msgMapVar, protocol);
+        if (!msg) {
+            continue;
+        }
+
+        assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
 
+        auto msgMap = msgMapVar.value<QVariantMap>();
+        updater.update(msgMap, *msg);
         convertedList.push_back(std::move(msg));
     }
     return convertedList;
 }
 
+class JsonArrayScanner
+{
+public:
+    JsonArrayScanner(const char* begin, const char* end)
+      : m_pos(begin),
+        m_end(end)
+    {
+    }
+
+    bool done() const
+    {
+        return m_done;
+    }
+
+    bool next(
+        std::size_t maxCount,
+        const char*& chunkBegin,
+        const char*& chunkEnd)
+    {
+        assert(!m_done);
+        chunkBegin = nullptr;
+        chunkEnd = nullptr;
+        if (!m_started) {
+            skipWhitespaces();
+            if ((m_pos == m_end) || (*m_pos != '[')) {
+                return false;
+            }
+
+            ++m_pos;
+            m_started = true;
+            skipWhitespaces();
+            if ((m_pos != m_end) && (*m_pos == ']')) {
+                m_done = true;
+                return true;
+            }
+        }
+
+        std::size_t count = 0U;
+        while ((count < maxCount) && (!m_done)) {
+            skipWhitespaces();
+            auto* elemBegin = m_pos;
+            if ((!skipElement()) || (elemBegin == m_pos)) {
+                return false;
+            }
+
+            if (chunkBegin == nullptr) {
+                chunkBegin = elemBegin;
+            }
+
+            chunkEnd = m_pos;
+            ++count;
+            m_done = (*m_pos == ']');
+            ++m_pos;
+        }
+        return true;
+    }
+
+private:
+    void skipWhitespaces()
+    {
+        while ((m_pos != m_end) &&
+               ((*m_pos == ' ') || (*m_pos == '\n') || (*m_pos == '\r') || (*m_pos == '\t'))) {
+            ++m_pos;
+        }
+    }
+
+    // Stops on top level ',' or ']'
+    bool skipElement()
+    {
+        unsigned depth = 0U;
+        bool inString = false;
+        for (; m_pos != m_end; ++m_pos) {
+            auto ch = *m_pos;
+            if (inString) {
+                if (ch == '\\') {
+                    ++m_pos;
+                    if (m_pos == m_end) {
+                        break;
+                    }
+                    continue;
+                }
+
+                inString = (ch != '"');
+                continue;
+            }
+
+            if (ch == '"') {
+                inString = true;
+                continue;
+            }
+
+            if ((ch == '{') || (ch == '[')) {
+                ++depth;
+                continue;
+            }
+
+            if ((ch == '}') || (ch == ']')) {
+                if (depth == 0U) {
+                    return (ch == ']');
+                }
+
+                --depth;
+                continue;
+            }
+
+            if ((ch == ',') && (depth == 0U)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const char* m_pos = nullptr;
+    const char* m_end = nullptr;
+    bool m_started = false;
+    bool m_done = false;
+};
+
 QVariantList convertMsgList(
     MsgFileMgr::Type type,
     const MsgFileMgr::MessagesList& allMsgs)
@@ -515,6 +658,269 @@ MsgFileMgr::MessagesList convertMsgList(
 
 }  // namespace
 
+class MsgFileMgr::StreamLoader
+{
+public:
+    typedef std::vector<ProtocolPtr> ProtocolsList;
+
+    StreamLoader(Type type, StreamLoadNotifyFunc&& notifyFunc)
+      : m_type(type),
+        m_notifyFunc(std::move(notifyFunc)),
+        m_targetThread(QThread::currentThread())
+    {
+    }
+
+    ~StreamLoader() noexcept
+    {
+        m_cancelled = true;
+        m_stopRequested = true;
+        for (auto& t : m_threads) {
+            t.join();
+        }
+    }
+
+    bool start(const QString& filename, ProtocolsList&& protocols)
+    {
+        assert(!protocols.empty());
+        m_file.setFileName(filename);
+        if (!m_file.open(QIODevice::ReadOnly)) {
+            std::cerr << "ERROR: Failed to load the file " <<
+                filename.toStdString() << std::endl;
+            return false;
+        }
+
+        auto size = m_file.size();
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        auto* mapped = m_file.map(0, size);
+        if (mapped != nullptr) {
+            begin = reinterpret_cast<const char*>(mapped);
+            end = begin + size;
+        }
+        else {
+            m_contents = m_file.readAll();
+            begin = m_contents.constData();
+            end = begin + m_contents.size();
+        }
+
+        m_scanner.reset(new JsonArrayScanner(begin, end));
+        m_protocols = std::move(protocols);
+        m_activeWorkers = static_cast<unsigned>(m_protocols.size());
+        m_threads.reserve(m_protocols.size());
+        for (auto& protocol : m_protocols) {
+            auto* protocolPtr = protocol.get();
+            m_threads.emplace_back(
+                [this, protocolPtr]()
+                {
+                    workerLoop(*protocolPtr);
+                });
+        }
+        return true;
+    }
+
+    MessagesList takeLoaded()
+    {
+        MessagesList result;
+        std::lock_guard<std::mutex> guard(m_lock);
+        result.swap(m_loaded);
+        return result;
+    }
+
+    bool isComplete() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_complete;
+    }
+
+private:
+    typedef std::pair<QVariantMap, MessagePtr> DecodedMsg;
+    typedef std::vector<DecodedMsg> DecodedMsgsList;
+
+    struct ChunkResult
+    {
+        DecodedMsgsList m_msgs;
+        bool m_valid = false;
+    };
+
+    typedef std::map<std::size_t, ChunkResult> ChunkResultsMap;
+
+    static const std::size_t FirstChunkElemsCount = 16U;
+    static const std::size_t MaxChunkElemsCount = 1024U;
+
+    bool nextChunk(std::size_t& idx, QByteArray& text)
+    {
+        std::lock_guard<std::mutex> guard(m_scanLock);
+        if (m_scanner->done() || m_scanFailed) {
+            return false;
+        }
+
+        idx = m_nextChunkIdx;
+        ++m_nextChunkIdx;
+
+        const char* chunkBegin = nullptr;
+        const char* chunkEnd = nullptr;
+        if (!m_scanner->next(m_chunkElemsCount, chunkBegin, chunkEnd)) {
+            m_scanFailed = true;
+            text.clear();
+            return true;
+        }
+
+        // Start with small chunks to report first messages as soon as possible
+        if (m_chunkElemsCount < MaxChunkElemsCount) {
+            m_chunkElemsCount *= 2U;
+        }
+
+        text.clear();
+        text.append('[');
+        if (chunkBegin != nullptr) {
+            text.append(chunkBegin, static_cast<int>(chunkEnd - chunkBegin));
+        }
+        text.append(']');
+        return true;
+    }
+
+    bool decodeChunk(
+        const QByteArray& text,
+        Protocol& protocol,
+        DecodedMsgsList& msgs)
+    {
+        if (text.isEmpty()) {
+            return false;
+        }
+
+        auto jsonError = QJsonParseError();
+        auto jsonDoc = QJsonDocument::fromJson(text, &jsonError);
+        if ((jsonError.error != QJsonParseError::NoError) ||
+            (!jsonDoc.isArray())) {
+            return false;
+        }
+
+        auto varList = jsonDoc.array().toVariantList();
+        msgs.reserve(static_cast<std::size_t>(varList.size()));
+        for (auto& msgMapVar : varList) {
+            auto msg = createMsgObjectFrom(msgMapVar, protocol);
+            if (!msg) {
+                continue;
+            }
+
+            // The worker thread exits after the load, the message objects
+            // must belong to the thread that started it.
+            moveMsgToThread(*msg, m_targetThread);
+
+            assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
+            msgs.emplace_back(msgMapVar.value<QVariantMap>(), std::move(msg));
+        }
+        return true;
+    }
+
+    void workerLoop(Protocol& protocol)
+    {
+        QByteArray text;
+        while (!m_stopRequested) {
+            std::size_t idx = 0U;
+            if (!nextChunk(idx, text)) {
+                break;
+            }
+
+            ChunkResult result;
+            result.m_valid = decodeChunk(text, protocol, result.m_msgs);
+            deliver(idx, std::move(result));
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            assert(0U < m_activeWorkers);
+            --m_activeWorkers;
+            if (0U < m_activeWorkers) {
+                return;
+            }
+
+            m_pending.clear();
+            m_complete = true;
+        }
+
+        if ((!m_cancelled) && m_notifyFunc) {
+            m_notifyFunc();
+        }
+    }
+
+    void deliver(std::size_t idx, ChunkResult&& result)
+    {
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (m_failed) {
+                return;
+            }
+
+            m_pending.insert(std::make_pair(idx, std::move(result)));
+            bool wasEmpty = m_loaded.empty();
+            while (true) {
+                auto iter = m_pending.find(m_nextDeliverIdx);
+                if (iter == m_pending.end()) {
+                    break;
+                }
+
+                auto& chunk = iter->second;
+                if (!chunk.m_valid) {
+                    std::cerr << "ERROR: Invalid contents of messages file!" << std::endl;
+                    m_failed = true;
+                    m_stopRequested = true;
+                    m_pending.clear();
+                    break;
+                }
+
+                for (auto& decoded : chunk.m_msgs) {
+                    if (m_type == Type::Recv) {
+                        if (!updateRecvMsgProps(decoded.first, *decoded.second)) {
+                            continue;
+                        }
+                    }
+                    else {
+                        m_sendUpdater.update(decoded.first, *decoded.second);
+                    }
+
+                    m_loaded.push_back(std::move(decoded.second));
+                }
+
+                m_pending.erase(iter);
+                ++m_nextDeliverIdx;
+            }
+
+            notify = wasEmpty && (!m_loaded.empty());
+        }
+
+        if (notify && (!m_cancelled) && m_notifyFunc) {
+            m_notifyFunc();
+        }
+    }
+
+    Type m_type = Type::Recv;
+    StreamLoadNotifyFunc m_notifyFunc;
+    QThread* m_targetThread = nullptr;
+    QFile m_file;
+    QByteArray m_contents;
+    ProtocolsList m_protocols;
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_stopRequested{false};
+    std::atomic<bool> m_cancelled{false};
+
+    std::mutex m_scanLock;
+    std::unique_ptr<JsonArrayScanner> m_scanner;
+    std::size_t m_nextChunkIdx = 0U;
+    std::size_t m_chunkElemsCount = FirstChunkElemsCount;
+    bool m_scanFailed = false;
+
+    mutable std::mutex m_lock;
+    ChunkResultsMap m_pending;
+    std::size_t m_nextDeliverIdx = 0U;
+    SendMsgPropsUpdater m_sendUpdater;
+    MessagesList m_loaded;
+    unsigned m_activeWorkers = 0U;
+    bool m_failed = false;
+    bool m_complete = false;
+};
+
 MsgFileMgr::MsgFileMgr() = default;
 MsgFileMgr::~MsgFileMgr() noexcept = default;
 MsgFileMgr::MsgFileMgr(const MsgFileMgr&) = default;
@@ -667,6 +1073,53 @@ void MsgFileMgr::flushRecvFile(FileSaveHandler handler)
     assert(handler);
     handler->flush();
 }
+
+MsgFileMgr::StreamLoadHandler MsgFileMgr::startStreamLoad(
+    Type type,
+    const QString& filename,
+    const ProtocolCreateFunc& createFunc,
+    StreamLoadNotifyFunc&& notifyFunc,
+    unsigned threadsCount)
+{
+    if (threadsCount == 0U) {
+        threadsCount = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    StreamLoader::ProtocolsList protocols;
+    protocols.reserve(threadsCount);
+    for (auto idx = 0U; idx < threadsCount; ++idx) {
+        auto protocol = createFunc();
+        if (!protocol) {
+            break;
+        }
+
+        protocols.push_back(std::move(protocol));
+    }
+
+    if (protocols.empty()) {
+        return StreamLoadHandler();
+    }
+
+    auto handler = std::make_shared<StreamLoader>(type, std::move(notifyFunc));
+    if (!handler->start(filename, std::move(protocols))) {
+        return StreamLoadHandler();
+    }
+
+    m_lastFile = filename;
+    return handler;
+}
+
+MsgFileMgr::MessagesList MsgFileMgr::takeStreamLoaded(StreamLoadHandler handler)
+{
+    assert(handler);
+    return handler->takeLoaded();
+}
+
+bool MsgFileMgr::isStreamLoadComplete(StreamLoadHandler handler)
+{
+    assert(handler);
+    return handler->isComplete();
+}
 }  // namespace comms_champion
 
 
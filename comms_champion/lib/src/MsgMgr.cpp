@@ -75,11 +75,36 @@ void MsgMgr::sendMsgs(MessagesList&& msgs)
     m_impl->sendMsgs(std::move(msgs));
 }
 
+void MsgMgr::sendData(DataInfoPtr dataPtr)
+{
+    m_impl->sendData(std::move(dataPtr));
+}
+
 const MsgMgr::AllMessages& MsgMgr::getAllMsgs() const
 {
     return m_impl->getAllMsgs();
 }
 
+const MsgMgr::AllMessages& MsgMgr::getMsgs(MsgCategory category) const
+{
+    return m_impl->getMsgs(category);
+}
+
+MsgMgr::AllMessages MsgMgr::getMsgs(const MsgCategoriesList& categories) const
+{
+    return m_impl->getMsgs(categories);
+}
+
+const MsgMgr::AllMessages& MsgMgr::getMsgsById(const QString& id) const
+{
+    return m_impl->getMsgsById(id);
+}
+
+MsgMgr::MsgCategory MsgMgr::getMsgCategory(const Message& msg)
+{
+    return MsgMgrImpl::getMsgCategory(msg);
+}
+
 void MsgMgr::addMsgs(const MessagesList& msgs, bool reportAdded)
 {
     m_impl->addMsgs(msgs, reportAdded);
@@ -30,6 +30,7 @@ CC_ENABLE_WARNINGS()
 
 #include "comms/util/ScopeGuard.h"
 #include "comms_champion/property/message.h"
+#include "MsgThread.h"
 
 namespace comms_champion
 {
@@ -51,6 +52,45 @@ private:
 const QString SeqNumber::Name("cc.msg_num");
 const QByteArray SeqNumber::PropName = SeqNumber::Name.toUtf8();
 
+typedef MsgMgr::AllMessages MsgsList;
+typedef unsigned long long MsgNum;
+
+bool msgNumLess(const MessagePtr& msg1, const MessagePtr& msg2)
+{
+    return SeqNumber().getFrom(*msg1) < SeqNumber().getFrom(*msg2);
+}
+
+MsgsList::iterator findMsg(MsgsList& msgs, MsgNum msgNum)
+{
+    auto iter = std::lower_bound(
+        msgs.begin(),
+        msgs.end(),
+        msgNum,
+        [](const MessagePtr& msgTmp, MsgNum val) -> bool
+        {
+            return SeqNumber().getFrom(*msgTmp) < val;
+        });
+
+    if ((iter == msgs.end()) || (SeqNumber().getFrom(**iter) != msgNum)) {
+        return msgs.end();
+    }
+
+    return iter;
+}
+
+bool eraseMsg(MsgsList& msgs, MsgNum msgNum)
+{
+    auto iter = findMsg(msgs, msgNum);
+    if (iter == msgs.end()) {
+        return false;
+    }
+
+    msgs.erase(iter);
+    return true;
+}
+
+const MsgsList EmptyMsgsList;
+
 void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
 {
     auto sinceEpoch = timestamp.time_since_epoch();
@@ -59,6 +99,46 @@ void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
     property::message::Timestamp().setTo(milliseconds.count(), msg);
 }
 
+template <typename TIter, typename TFunc>
+void applyFilters(
+    TIter begin,
+    TIter end,
+    Filter::DataInfosList& data,
+    Filter::DataInfosList& dataTmp,
+    TFunc&& func)
+{
+    for (auto iter = begin; iter != end; ++iter) {
+        if (data.empty()) {
+            break;
+        }
+
+        auto& filter = *iter;
+        assert(filter);
+        if (filter->isPassThrough()) {
+            continue;
+        }
+
+        dataTmp.clear();
+        for (auto& d : data) {
+            func(*filter, std::move(d), dataTmp);
+        }
+
+        data.swap(dataTmp);
+    }
+
+    dataTmp.clear();
+}
+
+void recvThroughFilter(Filter& filter, DataInfoPtr dataPtr, Filter::DataInfosList& output)
+{
+    filter.recvDataInto(std::move(dataPtr), output);
+}
+
+void sendThroughFilter(Filter& filter, DataInfoPtr dataPtr, Filter::DataInfosList& output)
+{
+    filter.sendDataInto(std::move(dataPtr), output);
+}
+
 }  // namespace
 
 MsgMgrImpl::MsgMgrImpl()
@@ -143,16 +223,7 @@ void MsgMgrImpl::deleteMsg(MessagePtr msg)
     assert(msg);
 
     auto msgNum = SeqNumber().getFrom(*msg);
-
-    auto iter = std::lower_bound(
-        m_allMsgs.begin(),
-        m_allMsgs.end(),
-        msgNum,
-        [](const MessagePtr& msgTmp, MsgNumberType val) -> bool
-        {
-            return SeqNumber().getFrom(*msgTmp) < val;
-        });
-
+    auto iter = findMsg(m_allMsgs, msgNum);
     if (iter == m_allMsgs.end()) {
         static constexpr bool Deleting_non_existing_message = false;
         static_cast<void>(Deleting_non_existing_message);
@@ -162,6 +233,38 @@ void MsgMgrImpl::deleteMsg(MessagePtr msg)
 
     assert(msg.get() == iter->get()); // Make sure that the right message is found
     m_allMsgs.erase(iter);
+
+    auto& categoryMsgs = m_categoryMsgs[static_cast<std::size_t>(getMsgCategory(*msg))];
+    bool categoryErased = eraseMsg(categoryMsgs, msgNum);
+    static_cast<void>(categoryErased);
+    assert(categoryErased);
+
+    auto id = msg->idAsString();
+    if (id.isEmpty()) {
+        return;
+    }
+
+    auto idIter = m_msgsById.find(id);
+    if (idIter == m_msgsById.end()) {
+        static constexpr bool Message_is_not_indexed_by_id = false;
+        static_cast<void>(Message_is_not_indexed_by_id);
+        assert(Message_is_not_indexed_by_id);
+        return;
+    }
+
+    eraseMsg(idIter->second, msgNum);
+    if (idIter->second.empty()) {
+        m_msgsById.erase(idIter);
+    }
+}
+
+void MsgMgrImpl::deleteAllMsgs()
+{
+    m_allMsgs.clear();
+    for (auto& msgs : m_categoryMsgs) {
+        msgs.clear();
+    }
+    m_msgsById.clear();
 }
 
 void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
@@ -170,6 +273,18 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
         return;
     }
 
+    // The storage is taken out of the member for the re-entrant invocation
+    // to be safe, its capacity is reused by the next invocation.
+    DataInfosList data;
+    data.swap(m_sendData);
+    auto dataGuard =
+        comms::util::makeScopeGuard(
+            [this, &data]()
+            {
+                data.clear();
+                m_sendData.swap(data);
+            });
+
     for (auto& msgPtr : msgs) {
         if (!msgPtr) {
             continue;
@@ -183,7 +298,7 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
                     property::message::Type().setTo(MsgType::Sent, *msgPtr);
                     auto now = DataInfo::TimestampClock::now();
                     updateMsgTimestamp(*msgPtr, now);
-                    m_allMsgs.push_back(msgPtr);
+                    storeMsg(msgPtr);
                     reportMsgAdded(msgPtr);
                 });
 
@@ -192,32 +307,19 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
             continue;
         }
 
-        QList <DataInfoPtr> data;
-        data.append(std::move(dataInfoPtr));
-        for (auto& filter : m_filters) {
-            if (data.isEmpty()) {
-                break;
-            }
-
-            QList <DataInfoPtr> dataTmp;
-            for (auto& d : data) {
-                dataTmp.append(filter->sendData(d));
-            }
-
-            data.swap(dataTmp);
-        }
-
-        if (data.isEmpty()) {
+        applySendFilters(std::move(dataInfoPtr), data);
+        if (data.empty()) {
             continue;
         }
 
         for (auto& d : data) {
             m_socket->sendData(d);
 
-            if (!d->m_extraProperties.isEmpty()) {
+            if ((!d->m_extraProperties.isEmpty()) || d->m_endpoints) {
+                auto props = dataInfoProperties(*d);
                 auto map = property::message::ExtraInfo().getFrom(*msgPtr);
-                for (auto& key : d->m_extraProperties.keys()) {
-                    map.insert(key, d->m_extraProperties.value(key));
+                for (auto iter = props.begin(); iter != props.end(); ++iter) {
+                    map.insert(iter.key(), iter.value());
                 }
                 property::message::ExtraInfo().setTo(std::move(map), *msgPtr);
                 m_protocol->updateMessage(*msgPtr);
@@ -226,6 +328,103 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
     }
 }
 
+void MsgMgrImpl::sendData(DataInfoPtr dataPtr)
+{
+    if ((!m_socket) || (!dataPtr)) {
+        return;
+    }
+
+    DataInfosList data;
+    data.swap(m_sendData);
+    applySendFilters(std::move(dataPtr), data);
+    for (auto& d : data) {
+        m_socket->sendData(d);
+    }
+
+    data.clear();
+    m_sendData.swap(data);
+}
+
+const MsgMgrImpl::AllMessages& MsgMgrImpl::getMsgs(MsgCategory category) const
+{
+    auto idx = static_cast<std::size_t>(category);
+    if (m_categoryMsgs.size() <= idx) {
+        static constexpr bool Invalid_category = false;
+        static_cast<void>(Invalid_category);
+        assert(Invalid_category);
+        return EmptyMsgsList;
+    }
+
+    return m_categoryMsgs[idx];
+}
+
+MsgMgrImpl::AllMessages MsgMgrImpl::getMsgs(const MsgCategoriesList& categories) const
+{
+    std::array<bool, std::tuple_size<CategoryMsgs>::value> selected = {{false}};
+    std::size_t selectedCount = 0U;
+    for (auto c : categories) {
+        auto idx = static_cast<std::size_t>(c);
+        if ((selected.size() <= idx) || (selected[idx])) {
+            continue;
+        }
+
+        selected[idx] = true;
+        ++selectedCount;
+    }
+
+    if (selectedCount == selected.size()) {
+        return m_allMsgs;
+    }
+
+    AllMessages result;
+    AllMessages merged;
+    for (std::size_t idx = 0U; idx < selected.size(); ++idx) {
+        if (!selected[idx]) {
+            continue;
+        }
+
+        auto& msgs = m_categoryMsgs[idx];
+        if (result.empty()) {
+            result = msgs;
+            continue;
+        }
+
+        merged.clear();
+        merged.reserve(result.size() + msgs.size());
+        std::merge(
+            result.begin(), result.end(),
+            msgs.begin(), msgs.end(),
+            std::back_inserter(merged),
+            &msgNumLess);
+        result.swap(merged);
+    }
+
+    return result;
+}
+
+const MsgMgrImpl::AllMessages& MsgMgrImpl::getMsgsById(const QString& id) const
+{
+    auto iter = m_msgsById.find(id);
+    if (iter == m_msgsById.end()) {
+        return EmptyMsgsList;
+    }
+
+    return iter->second;
+}
+
+MsgMgrImpl::MsgCategory MsgMgrImpl::getMsgCategory(const Message& msg)
+{
+    if (property::message::Type().getFrom(msg) == MsgType::Sent) {
+        return MsgCategory::Sent;
+    }
+
+    if (msg.idAsString().isEmpty()) {
+        return MsgCategory::Garbage;
+    }
+
+    return MsgCategory::Received;
+}
+
 void MsgMgrImpl::addMsgs(const MessagesList& msgs, bool reportAdded)
 {
     m_allMsgs.reserve(m_allMsgs.size() + msgs.size());
@@ -254,7 +453,7 @@ void MsgMgrImpl::addMsgs(const MessagesList& msgs, bool reportAdded)
         if (reportAdded) {
             reportMsgAdded(m);
         }
-        m_allMsgs.push_back(m);
+        storeMsg(m);
     }
 }
 
@@ -271,6 +470,12 @@ void MsgMgrImpl::setSocket(SocketPtr socket)
             socketDataReceived(std::move(dataPtr));
         });
 
+    socket->setDataListReceivedCallback(
+        [this](Socket::DataInfosList&& dataList)
+        {
+            socketDataListReceived(std::move(dataList));
+        });
+
     socket->setErrorReportCallback(
         [this](const QString& msg)
         {
@@ -283,6 +488,12 @@ void MsgMgrImpl::setSocket(SocketPtr socket)
             reportSocketDisconnected();
         });
 
+    socket->setConnectionClosedReportCallback(
+        [this](DataInfo::ConnectionId id)
+        {
+            socketConnectionClosed(id);
+        });
+
     m_socket = std::move(socket);
 }
 
@@ -308,23 +519,17 @@ void MsgMgrImpl::addFilter(FilterPtr filter)
             assert(filterIdx < m_filters.size());
             auto revIdx = m_filters.size() - filterIdx;
 
-            QList<DataInfoPtr> data;
-            data.append(std::move(dataPtr));
-            for (auto iter = m_filters.rbegin() + static_cast<std::intmax_t>(revIdx); iter != m_filters.rend(); ++iter) {
-
-                if (!data.isEmpty()) {
-                    break;
-                }
-
-                auto nextFilter = *iter;
-
-                QList<DataInfoPtr> dataTmp;
-                for (auto& d : data) {
-                    dataTmp.append(nextFilter->sendData(d));
-                }
-
-                data.swap(dataTmp);
-            }
+            // Data reported by the filter is rare, use local storage to
+            // avoid interfering with the data currently being processed.
+            DataInfosList data;
+            DataInfosList dataTmp;
+            data.push_back(std::move(dataPtr));
+            applyFilters(
+                m_filters.rbegin() + static_cast<std::intmax_t>(revIdx),
+                m_filters.rend(),
+                data,
+                dataTmp,
+                &sendThroughFilter);
 
             if (!m_socket) {
                 return;
@@ -350,59 +555,176 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         return;
     }
 
-    QList<DataInfoPtr> data;
-    data.append(std::move(dataInfoPtr));
-    for (auto filt : m_filters) {
-        assert(filt);
+    auto timestamp = dataInfoPtr->m_timestamp;
+    m_recvData.clear();
+    m_recvData.push_back(std::move(dataInfoPtr));
+    processRecvData(timestamp);
+}
 
-        if (data.isEmpty()) {
-            return;
-        }
+void MsgMgrImpl::socketDataListReceived(Socket::DataInfosList&& dataList)
+{
+    if ((!m_recvEnabled) || !(m_protocol)) {
+        return;
+    }
 
-        QList<DataInfoPtr> dataTmp;
-        for (auto& d : data) {
-            dataTmp.append(filt->recvData(d));
+    m_recvData.clear();
+    for (auto& dataPtr : dataList) {
+        if (dataPtr) {
+            m_recvData.push_back(std::move(dataPtr));
         }
+    }
 
-        data.swap(dataTmp);
+    processRecvData(DataInfo::Timestamp());
+}
+
+void MsgMgrImpl::socketConnectionClosed(DataInfo::ConnectionId id)
+{
+    if (!m_protocol) {
+        return;
     }
 
-    if (data.isEmpty()) {
+    m_protocol->connectionClosed(id);
+}
+
+void MsgMgrImpl::processRecvData(const DataInfo::Timestamp& defaultTimestamp)
+{
+    applyFilters(m_filters.begin(), m_filters.end(), m_recvData, m_recvDataTmp, &recvThroughFilter);
+
+    if (m_recvData.empty()) {
         return;
     }
 
-    MessagesList msgsList;
-    while (!data.isEmpty()) {
-        auto nextDataPtr = data.front();
-        data.pop_front();
+    ReadResultsList results;
+    readRecvData(results);
+    assert(results.size() == m_recvData.size());
+
+    static const DataInfo::Timestamp DefaultTimestamp;
+    std::size_t totalCount = 0U;
+    auto dataIter = m_recvData.begin();
+    for (auto& msgs : results) {
+        assert(dataIter != m_recvData.end());
+        auto timestamp = (*dataIter)->m_timestamp;
+        ++dataIter;
+
+        if (timestamp == DefaultTimestamp) {
+            timestamp = defaultTimestamp;
+        }
+
+        for (auto& m : msgs) {
+            assert(m);
+            updateInternalId(*m);
+            property::message::Type().setTo(MsgType::Received, *m);
+
+            if (timestamp != DefaultTimestamp) {
+                updateMsgTimestamp(*m, timestamp);
+            }
+            else {
+                auto now = DataInfo::TimestampClock::now();
+                updateMsgTimestamp(*m, now);
+            }
+
+            reportMsgAdded(m);
+        }
 
-        auto msgs = m_protocol->read(*nextDataPtr);
-        msgsList.insert(msgsList.end(), msgs.begin(), msgs.end());
+        totalCount += msgs.size();
     }
+    m_recvData.clear();
 
-    if (msgsList.empty()) {
+    if (totalCount == 0U) {
         return;
     }
 
-    for (auto& m : msgsList) {
-        assert(m);
-        updateInternalId(*m);
-        property::message::Type().setTo(MsgType::Received, *m);
+    m_allMsgs.reserve(m_allMsgs.size() + totalCount);
+    for (auto& msgs : results) {
+        for (auto& m : msgs) {
+            storeMsg(std::move(m));
+        }
+    }
+}
 
-        static const DataInfo::Timestamp DefaultTimestamp;
-        if (dataInfoPtr->m_timestamp != DefaultTimestamp) {
-            updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
+void MsgMgrImpl::readRecvData(ReadResultsList& results)
+{
+    results.resize(m_recvData.size());
+
+    // Group the data by connections preserving the order within the group
+    typedef std::vector<std::pair<DataInfo*, MessagesList*> > ConnectionGroup;
+    std::vector<ConnectionGroup> groups;
+    std::map<DataInfo::ConnectionId, std::size_t> groupsMap;
+    std::size_t idx = 0U;
+    for (auto& d : m_recvData) {
+        assert(d);
+        auto iter = groupsMap.find(d->m_connectionId);
+        if (iter == groupsMap.end()) {
+            iter = groupsMap.insert(std::make_pair(d->m_connectionId, groups.size())).first;
+            groups.emplace_back();
         }
-        else {
-            auto now = DataInfo::TimestampClock::now();
-            updateMsgTimestamp(*m, now);
+
+        groups[iter->second].push_back(std::make_pair(d.get(), &results[idx]));
+        ++idx;
+    }
+
+    auto* protocol = m_protocol.get();
+    auto* thread = QThread::currentThread();
+    auto readGroupFunc =
+        [protocol, thread](ConnectionGroup& group)
+        {
+            for (auto& elem : group) {
+                *elem.second = protocol->read(*elem.first);
+
+                // The messages may be created on the worker thread
+                for (auto& m : *elem.second) {
+                    moveMsgToThread(*m, thread);
+                }
+            }
+        };
+
+    if ((groups.size() <= 1U) || (!m_protocol->supportsConcurrentRead())) {
+        for (auto& g : groups) {
+            readGroupFunc(g);
+        }
+        return;
+    }
+
+    if (!m_readPool) {
+        m_readPool.reset(new ReadWorkerPool());
+    }
+
+    // The connection-less data is decoded using the main protocol stack
+    // object, which is also used to initialise the decoding state of
+    // the new connections, so it cannot be processed concurrently.
+    auto noConnectionIter = groupsMap.find(0U);
+    if (noConnectionIter != groupsMap.end()) {
+        readGroupFunc(groups[noConnectionIter->second]);
+    }
+
+    ReadWorkerPool::TasksList tasks;
+    tasks.reserve(groups.size());
+    for (auto& g : groups) {
+        assert(!g.empty());
+        if (g.front().first->m_connectionId == 0U) {
+            continue;
         }
 
-        reportMsgAdded(m);
+        auto* groupPtr = &g;
+        tasks.push_back(
+            [groupPtr, &readGroupFunc]()
+            {
+                readGroupFunc(*groupPtr);
+            });
     }
 
-    m_allMsgs.reserve(m_allMsgs.size() + msgsList.size());
-    std::move(msgsList.begin(), msgsList.end(), std::back_inserter(m_allMsgs));
+    m_readPool->run(tasks);
+}
+
+void MsgMgrImpl::applySendFilters(DataInfoPtr dataInfoPtr, DataInfosList& output)
+{
+    output.clear();
+    output.push_back(std::move(dataInfoPtr));
+
+    DataInfosList dataTmp;
+    dataTmp.swap(m_sendDataTmp);
+    applyFilters(m_filters.begin(), m_filters.end(), output, dataTmp, &sendThroughFilter);
+    m_sendDataTmp.swap(dataTmp);
 }
 
 void MsgMgrImpl::updateInternalId(Message& msg)
@@ -412,6 +734,19 @@ void MsgMgrImpl::updateInternalId(Message& msg)
     assert(0 < m_nextMsgNum); // wrap around is not supported
 }
 
+void MsgMgrImpl::storeMsg(MessagePtr msg)
+{
+    assert(msg);
+    m_categoryMsgs[static_cast<std::size_t>(getMsgCategory(*msg))].push_back(msg);
+
+    auto id = msg->idAsString();
+    if (!id.isEmpty()) {
+        m_msgsById[id].push_back(msg);
+    }
+
+    m_allMsgs.push_back(std::move(msg));
+}
+
 void MsgMgrImpl::reportMsgAdded(MessagePtr msg)
 {
     if (m_msgAddedCallback) {
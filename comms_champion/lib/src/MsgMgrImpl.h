@@ -18,9 +18,13 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "comms_champion/MsgMgr.h"
+#include "ReadWorkerPool.h"
 
 namespace comms_champion
 {
@@ -32,6 +36,8 @@ public:
     typedef MsgMgr::MessagesList MessagesList;
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::MsgCategory MsgCategory;
+    typedef MsgMgr::MsgCategoriesList MsgCategoriesList;
 
     MsgMgrImpl();
     ~MsgMgrImpl() noexcept;
@@ -45,18 +51,21 @@ public:
     void setRecvEnabled(bool enabled);
 
     void deleteMsg(MessagePtr msg);
-    void deleteAllMsgs()
-    {
-        m_allMsgs.clear();
-    }
+    void deleteAllMsgs();
 
     void sendMsgs(MessagesList&& msgs);
+    void sendData(DataInfoPtr dataPtr);
 
     const AllMessages& getAllMsgs() const
     {
         return m_allMsgs;
     }
 
+    const AllMessages& getMsgs(MsgCategory category) const;
+    AllMessages getMsgs(const MsgCategoriesList& categories) const;
+    const AllMessages& getMsgsById(const QString& id) const;
+    static MsgCategory getMsgCategory(const Message& msg);
+
     void addMsgs(const MessagesList& msgs, bool reportAdded);
 
     void setSocket(SocketPtr socket);
@@ -88,19 +97,37 @@ public:
 private:
     typedef unsigned long long MsgNumberType;
     typedef std::vector<FilterPtr> FiltersList;
+    typedef Filter::DataInfosList DataInfosList;
+    typedef std::array<AllMessages, static_cast<std::size_t>(MsgCategory::NumOfValues)> CategoryMsgs;
+    typedef std::map<QString, AllMessages> MsgsByIdMap;
+
+    typedef std::vector<MessagesList> ReadResultsList;
 
     void socketDataReceived(DataInfoPtr dataInfoPtr);
+    void socketDataListReceived(Socket::DataInfosList&& dataList);
+    void socketConnectionClosed(DataInfo::ConnectionId id);
+    void processRecvData(const DataInfo::Timestamp& defaultTimestamp);
+    void readRecvData(ReadResultsList& results);
+    void applySendFilters(DataInfoPtr dataInfoPtr, DataInfosList& output);
     void updateInternalId(Message& msg);
+    void storeMsg(MessagePtr msg);
     void reportMsgAdded(MessagePtr msg);
     void reportError(const QString& error);
     void reportSocketDisconnected();
 
     AllMessages m_allMsgs;
+    CategoryMsgs m_categoryMsgs;
+    MsgsByIdMap m_msgsById;
     bool m_recvEnabled = false;
 
     SocketPtr m_socket;
     ProtocolPtr m_protocol;
     FiltersList m_filters;
+    DataInfosList m_recvData;
+    DataInfosList m_recvDataTmp;
+    DataInfosList m_sendData;
+    DataInfosList m_sendDataTmp;
+    std::unique_ptr<ReadWorkerPool> m_readPool;
     MsgNumberType m_nextMsgNum = 1;
     bool m_running = false;
 
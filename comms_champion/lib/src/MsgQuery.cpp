@@ -0,0 +1,111 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/MsgQuery.h"
+
+#include "MsgQueryImpl.h"
+
+namespace comms_champion
+{
+
+MsgQuery::MsgQuery()
+  : m_impl(new MsgQueryImpl())
+{
+}
+
+MsgQuery::MsgQuery(const MsgQuery& other)
+  : m_impl(new MsgQueryImpl(*other.m_impl))
+{
+}
+
+MsgQuery::~MsgQuery() noexcept = default;
+
+MsgQuery& MsgQuery::operator=(const MsgQuery& other)
+{
+    *m_impl = *other.m_impl;
+    return *this;
+}
+
+void MsgQuery::clear()
+{
+    m_impl->clear();
+}
+
+bool MsgQuery::empty() const
+{
+    return m_impl->empty();
+}
+
+void MsgQuery::addId(const QString& id)
+{
+    m_impl->addId(id);
+}
+
+void MsgQuery::setName(const QString& name)
+{
+    m_impl->setName(name);
+}
+
+void MsgQuery::setTimestampRange(Timestamp from, Timestamp to)
+{
+    m_impl->setTimestampRange(from, to);
+}
+
+void MsgQuery::addFieldCondition(const QString& fieldPath, CompareOp op, const QString& value)
+{
+    m_impl->addFieldCondition(fieldPath, op, value);
+}
+
+bool MsgQuery::parse(const QString& expr)
+{
+    return m_impl->parse(expr);
+}
+
+void MsgQuery::setThreadsCount(unsigned count)
+{
+    m_impl->setThreadsCount(count);
+}
+
+bool MsgQuery::matches(Message& msg) const
+{
+    return m_impl->matches(msg);
+}
+
+MsgQuery::MsgsList MsgQuery::run(
+    const MsgsList& msgs,
+    const ResultsReportCallbackFunc& func,
+    const CancelCheckFunc& cancelFunc) const
+{
+    return m_impl->run(msgs, TimestampsList(), func, cancelFunc);
+}
+
+MsgQuery::TimestampsList MsgQuery::snapshotTimestamps(const MsgsList& msgs) const
+{
+    return m_impl->snapshotTimestamps(msgs);
+}
+
+MsgQuery::MsgsList MsgQuery::run(
+    const MsgsList& msgs,
+    const TimestampsList& timestamps,
+    const ResultsReportCallbackFunc& func,
+    const CancelCheckFunc& cancelFunc) const
+{
+    return m_impl->run(msgs, timestamps, func, cancelFunc);
+}
+
+}  // namespace comms_champion
+
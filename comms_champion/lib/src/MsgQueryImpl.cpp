@@ -0,0 +1,818 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgQueryImpl.h"
+
+#include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+#include "comms/util/ScopeGuard.h"
+#include "comms_champion/MessageHandler.h"
+#include "comms_champion/field_wrapper/FieldWrapperHandler.h"
+#include "comms_champion/property/field.h"
+#include "comms_champion/property/message.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+typedef field_wrapper::FieldWrapper FieldWrapper;
+typedef field_wrapper::FieldWrapperPtr FieldWrapperPtr;
+typedef std::vector<FieldWrapperPtr> FieldWrappersList;
+typedef QList<QVariantMap> FieldsPropsList;
+
+const std::size_t ChunkSize = 512U;
+
+struct FieldValue
+{
+    QString m_str;
+    long double m_num = 0;
+    bool m_numeric = false;
+    bool m_valid = false;
+};
+
+class FieldsCollector : public MessageHandler
+{
+public:
+    FieldWrappersList& fields()
+    {
+        return m_fields;
+    }
+
+protected:
+    virtual void addFieldImpl(FieldWrapperPtr wrapper) override
+    {
+        m_fields.push_back(std::move(wrapper));
+    }
+
+private:
+    FieldWrappersList m_fields;
+};
+
+class FieldValueRetriever : public field_wrapper::FieldWrapperHandler
+{
+public:
+    const FieldValue& value() const
+    {
+        return m_value;
+    }
+
+    virtual void handle(field_wrapper::IntValueWrapper& wrapper) override
+    {
+        setNumeric(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::UnsignedLongValueWrapper& wrapper) override
+    {
+        setNumeric(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::BitmaskValueWrapper& wrapper) override
+    {
+        setNumeric(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::EnumValueWrapper& wrapper) override
+    {
+        setNumeric(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::FloatValueWrapper& wrapper) override
+    {
+        setNumeric(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::StringWrapper& wrapper) override
+    {
+        setString(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::ArrayListRawDataWrapper& wrapper) override
+    {
+        setString(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::ArrayListWrapper& wrapper) override
+    {
+        setNumeric(static_cast<unsigned long long>(wrapper.getMembers().size()));
+    }
+
+    virtual void handle(field_wrapper::UnknownValueWrapper& wrapper) override
+    {
+        setString(wrapper.getSerialisedString());
+    }
+
+    using field_wrapper::FieldWrapperHandler::handle;
+
+private:
+    template <typename T>
+    void setNumeric(T value)
+    {
+        m_value.m_num = static_cast<long double>(value);
+        m_value.m_str = QString::number(value);
+        m_value.m_numeric = true;
+        m_value.m_valid = true;
+    }
+
+    void setString(const QString& value)
+    {
+        m_value.m_str = value;
+        m_value.m_valid = true;
+    }
+
+    FieldValue m_value;
+};
+
+class FieldLookupHandler : public field_wrapper::FieldWrapperHandler
+{
+public:
+    explicit FieldLookupHandler(const QVariantMap& props)
+      : m_props(props)
+    {
+    }
+
+    FieldWrappersList* members() const
+    {
+        return m_members;
+    }
+
+    const FieldsPropsList& membersProps() const
+    {
+        return m_membersProps;
+    }
+
+    field_wrapper::OptionalWrapper* optional() const
+    {
+        return m_optional;
+    }
+
+    virtual void handle(field_wrapper::BundleWrapper& wrapper) override
+    {
+        m_members = &wrapper.getMembers();
+        m_membersProps = property::field::Bundle(m_props).members();
+    }
+
+    virtual void handle(field_wrapper::BitfieldWrapper& wrapper) override
+    {
+        m_members = &wrapper.getMembers();
+        m_membersProps = property::field::Bitfield(m_props).members();
+    }
+
+    virtual void handle(field_wrapper::OptionalWrapper& wrapper) override
+    {
+        m_optional = &wrapper;
+    }
+
+    using field_wrapper::FieldWrapperHandler::handle;
+
+private:
+    const QVariantMap& m_props;
+    FieldWrappersList* m_members = nullptr;
+    FieldsPropsList m_membersProps;
+    field_wrapper::OptionalWrapper* m_optional = nullptr;
+};
+
+FieldWrapper* unwrapOptional(FieldWrapper* wrapper, QVariantMap& props)
+{
+    while (wrapper != nullptr) {
+        FieldLookupHandler handler(props);
+        wrapper->dispatch(handler);
+        auto* optional = handler.optional();
+        if (optional == nullptr) {
+            break;
+        }
+
+        if (optional->getMode() != comms::field::OptionalMode::Exists) {
+            return nullptr;
+        }
+
+        props = property::field::Optional(props).field();
+        wrapper = &optional->getFieldWrapper();
+    }
+
+    return wrapper;
+}
+
+FieldWrapper* findField(
+    FieldWrappersList& members,
+    const FieldsPropsList& membersProps,
+    const QStringList& path,
+    int pathIdx)
+{
+    assert(pathIdx < path.size());
+    auto& name = path[pathIdx];
+    bool isIdx = false;
+    auto idx = name.toInt(&isIdx);
+    if (!isIdx) {
+        idx = -1;
+        for (auto propsIdx = 0; propsIdx < membersProps.size(); ++propsIdx) {
+            property::field::Common commonProps(membersProps[propsIdx]);
+            if (commonProps.name().compare(name, Qt::CaseInsensitive) == 0) {
+                idx = propsIdx;
+                break;
+            }
+        }
+    }
+
+    if ((idx < 0) || (members.size() <= static_cast<std::size_t>(idx))) {
+        return nullptr;
+    }
+
+    QVariantMap props;
+    if (idx < membersProps.size()) {
+        props = membersProps[idx];
+    }
+
+    auto* wrapper = unwrapOptional(members[static_cast<std::size_t>(idx)].get(), props);
+    if ((wrapper == nullptr) || ((pathIdx + 1) == path.size())) {
+        return wrapper;
+    }
+
+    FieldLookupHandler handler(props);
+    wrapper->dispatch(handler);
+    if (handler.members() == nullptr) {
+        return nullptr;
+    }
+
+    return findField(*handler.members(), handler.membersProps(), path, pathIdx + 1);
+}
+
+bool parseNumeric(const QString& str, long double& value)
+{
+    bool ok = false;
+    auto signedVal = str.toLongLong(&ok, 0);
+    if (ok) {
+        value = static_cast<long double>(signedVal);
+        return true;
+    }
+
+    auto unsignedVal = str.toULongLong(&ok, 0);
+    if (ok) {
+        value = static_cast<long double>(unsignedVal);
+        return true;
+    }
+
+    auto floatVal = str.toDouble(&ok);
+    if (ok) {
+        value = static_cast<long double>(floatVal);
+        return true;
+    }
+
+    return false;
+}
+
+bool idMatches(const QString& msgId, const QString& id)
+{
+    if (msgId.compare(id, Qt::CaseInsensitive) == 0) {
+        return true;
+    }
+
+    bool msgIdOk = false;
+    auto msgIdVal = msgId.toLongLong(&msgIdOk, 0);
+    bool idOk = false;
+    auto idVal = id.toLongLong(&idOk, 0);
+    return msgIdOk && idOk && (msgIdVal == idVal);
+}
+
+QStringList tokenize(const QString& expr)
+{
+    QStringList tokens;
+    QString token;
+    bool quoted = false;
+    bool hasToken = false;
+    for (auto ch : expr) {
+        if (ch == QChar('\"')) {
+            quoted = !quoted;
+            hasToken = true;
+            continue;
+        }
+
+        if ((!quoted) && ch.isSpace()) {
+            if (hasToken) {
+                tokens.append(token);
+                token.clear();
+                hasToken = false;
+            }
+            continue;
+        }
+
+        token.append(ch);
+        hasToken = true;
+    }
+
+    if (quoted) {
+        return QStringList();
+    }
+
+    if (hasToken) {
+        tokens.append(token);
+    }
+
+    return tokens;
+}
+
+bool parseCondition(
+    const QString& token,
+    QString& lhs,
+    MsgQuery::CompareOp& op,
+    QString& rhs)
+{
+    static const QString OpChars("=!<>~");
+    auto pos = 0;
+    while ((pos < token.size()) && (!OpChars.contains(token[pos]))) {
+        ++pos;
+    }
+
+    if (token.size() <= pos) {
+        return false;
+    }
+
+    struct OpInfo
+    {
+        const char* m_str;
+        MsgQuery::CompareOp m_op;
+    };
+
+    static const OpInfo Ops[] = {
+        {"==", MsgQuery::CompareOp::Equal},
+        {"!=", MsgQuery::CompareOp::NotEqual},
+        {"<=", MsgQuery::CompareOp::LessEqual},
+        {">=", MsgQuery::CompareOp::GreaterEqual},
+        {"=", MsgQuery::CompareOp::Equal},
+        {"<", MsgQuery::CompareOp::Less},
+        {">", MsgQuery::CompareOp::Greater},
+        {"~", MsgQuery::CompareOp::Contains},
+    };
+
+    auto rest = token.mid(pos);
+    for (auto& info : Ops) {
+        if (!rest.startsWith(QLatin1String(info.m_str))) {
+            continue;
+        }
+
+        lhs = token.left(pos).trimmed();
+        op = info.m_op;
+        rhs = rest.mid(static_cast<int>(std::strlen(info.m_str)));
+        return true;
+    }
+
+    return false;
+}
+
+}  // namespace
+
+void MsgQueryImpl::clear()
+{
+    m_ids.clear();
+    m_name.clear();
+    m_fromTimestamp = 0U;
+    m_toTimestamp = 0U;
+    m_fieldConditions.clear();
+}
+
+bool MsgQueryImpl::empty() const
+{
+    return
+        m_ids.isEmpty() &&
+        m_name.isEmpty() &&
+        (m_fromTimestamp == 0U) &&
+        (m_toTimestamp == 0U) &&
+        m_fieldConditions.empty();
+}
+
+void MsgQueryImpl::addId(const QString& id)
+{
+    m_ids.append(id);
+}
+
+void MsgQueryImpl::setName(const QString& name)
+{
+    m_name = name;
+}
+
+void MsgQueryImpl::setTimestampRange(Timestamp from, Timestamp to)
+{
+    m_fromTimestamp = from;
+    m_toTimestamp = to;
+}
+
+void MsgQueryImpl::addFieldCondition(
+    const QString& fieldPath,
+    CompareOp op,
+    const QString& value)
+{
+    FieldCondition cond;
+    cond.m_path = fieldPath.split(QChar('.'));
+    cond.m_op = op;
+    cond.m_value = value;
+    cond.m_numeric = parseNumeric(value, cond.m_numValue);
+    m_fieldConditions.push_back(std::move(cond));
+}
+
+bool MsgQueryImpl::parse(const QString& expr)
+{
+    auto tokens = tokenize(expr);
+    if (tokens.isEmpty() && (!expr.trimmed().isEmpty())) {
+        return false;
+    }
+
+    MsgQueryImpl query;
+    query.m_threadsCount = m_threadsCount;
+    for (auto& t : tokens) {
+        QString lhs;
+        QString rhs;
+        auto op = CompareOp::NumOfValues;
+        if (!parseCondition(t, lhs, op, rhs)) {
+            query.setName(t);
+            continue;
+        }
+
+        if (lhs.isEmpty() || rhs.isEmpty()) {
+            return false;
+        }
+
+        auto key = lhs.toLower();
+        if (key == QLatin1String("id")) {
+            if (op != CompareOp::Equal) {
+                return false;
+            }
+
+            for (auto& id : rhs.split(QChar(','))) {
+                auto idStr = id.trimmed();
+                if (!idStr.isEmpty()) {
+                    query.addId(idStr);
+                }
+            }
+            continue;
+        }
+
+        if (key == QLatin1String("name")) {
+            if ((op != CompareOp::Equal) && (op != CompareOp::Contains)) {
+                return false;
+            }
+
+            query.setName(rhs);
+            continue;
+        }
+
+        if ((key == QLatin1String("time")) || (key == QLatin1String("timestamp"))) {
+            bool ok = false;
+            Timestamp value = rhs.toULongLong(&ok, 0);
+            if (!ok) {
+                return false;
+            }
+
+            switch (op) {
+                case CompareOp::Equal:
+                    query.m_fromTimestamp = value;
+                    query.m_toTimestamp = value;
+                    break;
+                case CompareOp::GreaterEqual:
+                    query.m_fromTimestamp = value;
+                    break;
+                case CompareOp::Greater:
+                    query.m_fromTimestamp = value + 1;
+                    break;
+                case CompareOp::LessEqual:
+                    query.m_toTimestamp = value;
+                    break;
+                case CompareOp::Less:
+                    if (value == 0U) {
+                        return false;
+                    }
+                    query.m_toTimestamp = value - 1;
+                    break;
+                default:
+                    return false;
+            }
+            continue;
+        }
+
+        query.addFieldCondition(lhs, op, rhs);
+    }
+
+    *this = std::move(query);
+    return true;
+}
+
+bool MsgQueryImpl::matches(Message& msg) const
+{
+    return matchesInternal(msg, nullptr);
+}
+
+MsgQueryImpl::TimestampsList MsgQueryImpl::snapshotTimestamps(const MsgsList& msgs) const
+{
+    TimestampsList timestamps;
+    if (!usesTimestamp()) {
+        return timestamps;
+    }
+
+    timestamps.reserve(msgs.size());
+    for (auto& msgPtr : msgs) {
+        assert(msgPtr);
+        timestamps.push_back(property::message::Timestamp().getFrom(*msgPtr));
+    }
+    return timestamps;
+}
+
+bool MsgQueryImpl::usesTimestamp() const
+{
+    return (m_fromTimestamp != 0U) || (m_toTimestamp != 0U);
+}
+
+bool MsgQueryImpl::matchesInternal(Message& msg, const Timestamp* timestampPtr) const
+{
+    if (usesTimestamp()) {
+        auto timestamp =
+            (timestampPtr != nullptr) ? *timestampPtr : property::message::Timestamp().getFrom(msg);
+        if ((m_fromTimestamp != 0U) && (timestamp < m_fromTimestamp)) {
+            return false;
+        }
+
+        if ((m_toTimestamp != 0U) && (m_toTimestamp < timestamp)) {
+            return false;
+        }
+    }
+
+    if (!m_ids.isEmpty()) {
+        auto msgId = msg.idAsString();
+        auto iter =
+            std::find_if(
+                m_ids.begin(), m_ids.end(),
+                [&msgId](const QString& id) -> bool
+                {
+                    return idMatches(msgId, id);
+                });
+
+        if (iter == m_ids.end()) {
+            return false;
+        }
+    }
+
+    if ((!m_name.isEmpty()) &&
+        (!QString(msg.name()).contains(m_name, Qt::CaseInsensitive))) {
+        return false;
+    }
+
+    if (m_fieldConditions.empty()) {
+        return true;
+    }
+
+    return matchesFields(msg);
+}
+
+MsgQueryImpl::MsgsList MsgQueryImpl::run(
+    const MsgsList& msgs,
+    const TimestampsList& timestamps,
+    const ResultsReportCallbackFunc& func,
+    const CancelCheckFunc& cancelFunc) const
+{
+    if (empty()) {
+        if (func && (!msgs.empty())) {
+            func(msgs);
+        }
+        return msgs;
+    }
+
+    auto chunksCount = (msgs.size() + ChunkSize - 1) / ChunkSize;
+    std::size_t threadsCount = m_threadsCount;
+    if (threadsCount == 0U) {
+        threadsCount = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    threadsCount = std::min(threadsCount, chunksCount);
+
+    assert(timestamps.empty() || (timestamps.size() == msgs.size()));
+    auto chunkBegin =
+        [&msgs](std::size_t idx) -> std::size_t
+        {
+            return std::min(idx * ChunkSize, msgs.size());
+        };
+
+    auto isCancelled =
+        [&cancelFunc]() -> bool
+        {
+            return cancelFunc && cancelFunc();
+        };
+
+    MsgsList result;
+    auto reportFunc =
+        [&func, &result](MsgsList& found)
+        {
+            if (found.empty()) {
+                return;
+            }
+
+            if (func) {
+                func(found);
+            }
+
+            result.insert(result.end(), found.begin(), found.end());
+        };
+
+    if (threadsCount <= 1U) {
+        for (std::size_t idx = 0U; idx < chunksCount; ++idx) {
+            if (isCancelled()) {
+                break;
+            }
+
+            MsgsList found;
+            evalChunk(msgs, timestamps, chunkBegin(idx), chunkBegin(idx + 1), found);
+            reportFunc(found);
+        }
+        return result;
+    }
+
+    std::vector<MsgsList> chunkResults(chunksCount);
+    std::vector<char> chunkDone(chunksCount, 0);
+    std::atomic<std::size_t> nextChunk(0U);
+    std::mutex lock;
+    std::condition_variable cond;
+    bool cancelled = false;
+
+    auto workerFunc =
+        [&]()
+        {
+            while (true) {
+                auto idx = nextChunk.fetch_add(1U);
+                if (chunksCount <= idx) {
+                    break;
+                }
+
+                if (isCancelled()) {
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        cancelled = true;
+                    }
+                    cond.notify_all();
+                    break;
+                }
+
+                MsgsList found;
+                evalChunk(msgs, timestamps, chunkBegin(idx), chunkBegin(idx + 1), found);
+
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    chunkResults[idx] = std::move(found);
+                    chunkDone[idx] = 1;
+                }
+                cond.notify_all();
+            }
+        };
+
+    std::vector<std::thread> threads;
+    auto joinGuard =
+        comms::util::makeScopeGuard(
+            [&threads, &nextChunk, chunksCount]()
+            {
+                nextChunk = chunksCount;
+                for (auto& t : threads) {
+                    t.join();
+                }
+            });
+
+    threads.reserve(threadsCount);
+    for (std::size_t idx = 0U; idx < threadsCount; ++idx) {
+        threads.emplace_back(workerFunc);
+    }
+
+    for (std::size_t idx = 0U; idx < chunksCount; ++idx) {
+        if (isCancelled()) {
+            break;
+        }
+
+        MsgsList found;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            cond.wait(
+                guard,
+                [&chunkDone, &cancelled, idx]() -> bool
+                {
+                    return (chunkDone[idx] != 0) || cancelled;
+                });
+
+            if (chunkDone[idx] == 0) {
+                break;
+            }
+
+            found.swap(chunkResults[idx]);
+        }
+
+        reportFunc(found);
+    }
+
+    return result;
+}
+
+bool MsgQueryImpl::matchesFields(Message& msg) const
+{
+    FieldsCollector collector;
+    msg.dispatch(collector);
+
+    FieldsPropsList props;
+    for (auto& p : msg.fieldsProperties()) {
+        props.append(p.toMap());
+    }
+
+    for (auto& c : m_fieldConditions) {
+        auto* wrapper = findField(collector.fields(), props, c.m_path, 0);
+        if (wrapper == nullptr) {
+            return false;
+        }
+
+        FieldValueRetriever retriever;
+        wrapper->dispatch(retriever);
+        auto& value = retriever.value();
+        if (!value.m_valid) {
+            return false;
+        }
+
+        if (c.m_op == CompareOp::Contains) {
+            if (!value.m_str.contains(c.m_value, Qt::CaseInsensitive)) {
+                return false;
+            }
+            continue;
+        }
+
+        int cmp = 0;
+        if (value.m_numeric && c.m_numeric) {
+            if (value.m_num < c.m_numValue) {
+                cmp = -1;
+            }
+            else if (c.m_numValue < value.m_num) {
+                cmp = 1;
+            }
+        }
+        else {
+            cmp = value.m_str.compare(c.m_value, Qt::CaseInsensitive);
+        }
+
+        bool condMatch = false;
+        switch (c.m_op) {
+            case CompareOp::Equal: condMatch = (cmp == 0); break;
+            case CompareOp::NotEqual: condMatch = (cmp != 0); break;
+            case CompareOp::Less: condMatch = (cmp < 0); break;
+            case CompareOp::LessEqual: condMatch = (cmp <= 0); break;
+            case CompareOp::Greater: condMatch = (0 < cmp); break;
+            case CompareOp::GreaterEqual: condMatch = (0 <= cmp); break;
+            default: {
+                static constexpr bool Unexpected_compare_operation = false;
+                static_cast<void>(Unexpected_compare_operation);
+                assert(Unexpected_compare_operation);
+                break;
+            }
+        }
+
+        if (!condMatch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void MsgQueryImpl::evalChunk(
+    const MsgsList& msgs,
+    const TimestampsList& timestamps,
+    std::size_t from,
+    std::size_t to,
+    MsgsList& result) const
+{
+    for (auto idx = from; idx < to; ++idx) {
+        auto& msgPtr = msgs[idx];
+        assert(msgPtr);
+        const Timestamp* timestamp = nullptr;
+        if (!timestamps.empty()) {
+            timestamp = &timestamps[idx];
+        }
+
+        if (matchesInternal(*msgPtr, timestamp)) {
+            result.push_back(msgPtr);
+        }
+    }
+}
+
+}  // namespace comms_champion
+
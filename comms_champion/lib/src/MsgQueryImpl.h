@@ -0,0 +1,99 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MsgQuery.h"
+
+namespace comms_champion
+{
+
+class MsgQueryImpl
+{
+public:
+    typedef MsgQuery::MsgsList MsgsList;
+    typedef MsgQuery::Timestamp Timestamp;
+    typedef MsgQuery::TimestampsList TimestampsList;
+    typedef MsgQuery::ResultsReportCallbackFunc ResultsReportCallbackFunc;
+    typedef MsgQuery::CancelCheckFunc CancelCheckFunc;
+    typedef MsgQuery::CompareOp CompareOp;
+
+    void clear();
+    bool empty() const;
+
+    void addId(const QString& id);
+    void setName(const QString& name);
+    void setTimestampRange(Timestamp from, Timestamp to);
+    void addFieldCondition(const QString& fieldPath, CompareOp op, const QString& value);
+    bool parse(const QString& expr);
+
+    void setThreadsCount(unsigned count)
+    {
+        m_threadsCount = count;
+    }
+
+    bool matches(Message& msg) const;
+    TimestampsList snapshotTimestamps(const MsgsList& msgs) const;
+    MsgsList run(
+        const MsgsList& msgs,
+        const TimestampsList& timestamps,
+        const ResultsReportCallbackFunc& func,
+        const CancelCheckFunc& cancelFunc) const;
+
+private:
+    struct FieldCondition
+    {
+        QStringList m_path;
+        CompareOp m_op = CompareOp::Equal;
+        QString m_value;
+        long double m_numValue = 0;
+        bool m_numeric = false;
+    };
+
+    typedef std::vector<FieldCondition> FieldConditionsList;
+
+    bool usesTimestamp() const;
+    bool matchesInternal(Message& msg, const Timestamp* timestamp) const;
+    bool matchesFields(Message& msg) const;
+    void evalChunk(
+        const MsgsList& msgs,
+        const TimestampsList& timestamps,
+        std::size_t from,
+        std::size_t to,
+        MsgsList& result) const;
+
+    QStringList m_ids;
+    QString m_name;
+    Timestamp m_fromTimestamp = 0U;
+    Timestamp m_toTimestamp = 0U;
+    FieldConditionsList m_fieldConditions;
+    unsigned m_threadsCount = 0U;
+};
+
+}  // namespace comms_champion
+
+
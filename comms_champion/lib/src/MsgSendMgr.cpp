@@ -39,11 +39,26 @@ void MsgSendMgr::setSendCompeteCallbackFunc(SendCompleteCallbackFunc&& func)
     m_impl->setSendCompleteCallbackFunc(std::move(func));
 }
 
+void MsgSendMgr::setSendDataCallbackFunc(SendDataCallbackFunc&& func)
+{
+    m_impl->setSendDataCallbackFunc(std::move(func));
+}
+
+void MsgSendMgr::setLoadCompleteCallbackFunc(LoadCompleteCallbackFunc&& func)
+{
+    m_impl->setLoadCompleteCallbackFunc(std::move(func));
+}
+
 void MsgSendMgr::start(ProtocolPtr protocol, const MessagesList& msgs)
 {
     m_impl->start(std::move(protocol), msgs);
 }
 
+void MsgSendMgr::startLoad(ProtocolPtr protocol, const MessagesList& msgs, const LoadConfig& config)
+{
+    m_impl->startLoad(std::move(protocol), msgs, config);
+}
+
 void MsgSendMgr::stop()
 {
     m_impl->stop();
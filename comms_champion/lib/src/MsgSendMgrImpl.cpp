@@ -18,18 +18,39 @@
 #include "MsgSendMgrImpl.h"
 
 #include <cassert>
+#include <algorithm>
 
 #include "comms_champion/property/message.h"
 
 namespace comms_champion
 {
 
+namespace
+{
+
+// Limit amount of bursts sent in one go to keep event loop responsive
+// when the sender falls behind the schedule.
+const unsigned MaxLoadBurstsPerIteration = 1024U;
+
+// Wake up a bit earlier than the deadline and finish with zero timeouts,
+// see scheduleLoad().
+const long long LoadTimerSlackUs = 1000;
+
+}  // namespace
+
 MsgSendMgrImpl::MsgSendMgrImpl()
-  : m_timer(this)
+  : m_timer(this),
+    m_loadTimer(this)
 {
     connect(
         &m_timer, SIGNAL(timeout()),
         this, SLOT(sendPendingAndWait()));
+
+    m_loadTimer.setSingleShot(true);
+    m_loadTimer.setTimerType(Qt::PreciseTimer);
+    connect(
+        &m_loadTimer, SIGNAL(timeout()),
+        this, SLOT(sendLoadAndWait()));
 }
 
 MsgSendMgrImpl::~MsgSendMgrImpl() noexcept = default;
@@ -60,11 +81,41 @@ void MsgSendMgrImpl::start(ProtocolPtr protocol, const MessagesList& msgs)
     sendPendingAndWait();
 }
 
+void MsgSendMgrImpl::startLoad(
+    ProtocolPtr protocol,
+    const MessagesList& msgs,
+    const LoadConfig& config)
+{
+    static constexpr bool The_previous_sending_must_be_stopped_first = false;
+    static_cast<void>(The_previous_sending_must_be_stopped_first);
+    assert((m_msgsToSend.empty() && (!m_load.active())) || The_previous_sending_must_be_stopped_first);
+    m_protocol = std::move(protocol);
+
+    // Serialise every message only once, copies of the same frames
+    // are sent over and over
+    LoadSchedule::FramesList frames;
+    frames.reserve(msgs.size());
+    for (auto& m : msgs) {
+        assert(m);
+        auto dataInfoPtr = m_protocol->write(*m);
+        if ((!dataInfoPtr) || dataInfoPtr->m_data.empty()) {
+            continue;
+        }
+
+        frames.push_back(std::move(dataInfoPtr));
+    }
+
+    m_load.start(std::move(frames), config, LoadClock::now());
+    sendLoadAndWait();
+}
+
 void MsgSendMgrImpl::stop()
 {
     m_timer.stop();
+    m_loadTimer.stop();
     m_protocol.reset();
     m_msgsToSend.clear();
+    m_load.clear();
 }
 
 void MsgSendMgrImpl::sendPendingAndWait()
@@ -158,4 +209,68 @@ void MsgSendMgrImpl::sendPendingAndWait()
         m_sendCompleteCallback();
     }
 }
+
+void MsgSendMgrImpl::sendLoadAndWait()
+{
+    auto now = LoadClock::now();
+    unsigned burstsCount = 0U;
+    while (true) {
+        if (m_load.complete(now)) {
+            completeLoad();
+            return;
+        }
+
+        if (MaxLoadBurstsPerIteration <= burstsCount) {
+            break;
+        }
+
+        if (m_load.hasDeadlines() && (now < m_load.nextDeadline())) {
+            break;
+        }
+
+        m_load.sendBurst(now, m_sendDataCallback);
+        ++burstsCount;
+        now = LoadClock::now();
+    }
+
+    scheduleLoad();
+}
+
+void MsgSendMgrImpl::scheduleLoad()
+{
+    if (!m_load.hasDeadlines()) {
+        m_loadTimer.start(0);
+        return;
+    }
+
+    // QTimer has millisecond resolution, the timer is set to expire
+    // up to LoadTimerSlackUs before the deadline and the rest of the wait
+    // is polled with zero timeouts, i.e. the event loop spins during the
+    // last millisecond. The achieved precision is limited by the latency
+    // of the event loop iteration, see lateness and jitter in the stats.
+    auto waitUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(m_load.nextDeadline() - LoadClock::now()).count();
+
+    int waitMs = 0;
+    if (LoadTimerSlackUs < waitUs) {
+        waitMs = static_cast<int>((waitUs - LoadTimerSlackUs) / 1000);
+    }
+
+    m_loadTimer.start(waitMs);
+}
+
+void MsgSendMgrImpl::completeLoad()
+{
+    m_loadTimer.stop();
+    auto stats = m_load.finish(LoadClock::now());
+
+    if (m_loadCompleteCallback) {
+        m_loadCompleteCallback(stats);
+    }
+
+    if (m_sendCompleteCallback) {
+        m_sendCompleteCallback();
+    }
+}
+
 }  // namespace comms_champion
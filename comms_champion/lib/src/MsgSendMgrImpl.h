@@ -18,6 +18,8 @@
 #pragma once
 
 #include <memory>
+#include <chrono>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -28,6 +30,7 @@ CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MsgSendMgr.h"
 #include "comms_champion/Protocol.h"
+#include "LoadSchedule.h"
 
 namespace comms_champion
 {
@@ -39,6 +42,10 @@ public:
     typedef MsgSendMgr::MessagesList MessagesList;
     typedef MsgSendMgr::SendMsgsCallbackFunc SendMsgsCallbackFunc;
     typedef MsgSendMgr::SendCompleteCallbackFunc SendCompleteCallbackFunc;
+    typedef MsgSendMgr::SendDataCallbackFunc SendDataCallbackFunc;
+    typedef MsgSendMgr::LoadConfig LoadConfig;
+    typedef MsgSendMgr::LoadStats LoadStats;
+    typedef MsgSendMgr::LoadCompleteCallbackFunc LoadCompleteCallbackFunc;
 
     MsgSendMgrImpl();
     ~MsgSendMgrImpl() noexcept;
@@ -55,19 +62,43 @@ public:
         m_sendCompleteCallback = std::forward<TFunc>(func);
     }
 
+    template <typename TFunc>
+    void setSendDataCallbackFunc(TFunc&& func)
+    {
+        m_sendDataCallback = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setLoadCompleteCallbackFunc(TFunc&& func)
+    {
+        m_loadCompleteCallback = std::forward<TFunc>(func);
+    }
+
     void start(ProtocolPtr protocol, const MessagesList& msgs);
+    void startLoad(ProtocolPtr protocol, const MessagesList& msgs, const LoadConfig& config);
 
     void stop();
 
 private slots:
     void sendPendingAndWait();
+    void sendLoadAndWait();
 
 private:
+    typedef LoadSchedule::Clock LoadClock;
+
+    void scheduleLoad();
+    void completeLoad();
+
     SendMsgsCallbackFunc m_sendCallback;
     SendCompleteCallbackFunc m_sendCompleteCallback;
+    SendDataCallbackFunc m_sendDataCallback;
+    LoadCompleteCallbackFunc m_loadCompleteCallback;
     ProtocolPtr m_protocol;
     MessagesList m_msgsToSend;
     QTimer m_timer;
+
+    LoadSchedule m_load;
+    QTimer m_loadTimer;
 };
 
 }  // namespace comms_champion
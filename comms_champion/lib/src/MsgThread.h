@@ -0,0 +1,38 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+
+namespace comms_champion
+{
+
+/// @brief Change thread affinity of the message created on a worker thread.
+/// @details Moves the messages attached to its properties (transport,
+///     raw data and extra info) as well. Must be invoked on the thread
+///     that owns the message.
+void moveMsgToThread(Message& msg, QThread* thread);
+
+}  // namespace comms_champion
@@ -29,7 +29,14 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QVariantList>
 #include <QtCore/QDir>
 #include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QVariantList>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QDateTime>
+#include <QtCore/QSet>
+#include <QtCore/QStandardPaths>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Plugin.h"
@@ -47,6 +54,13 @@ const QString NameMetaKey("name");
 const QString DescMetaKey("desc");
 const QString TypeMetaKey("type");
 
+const QString IndexVersionKey("version");
+const QString IndexPluginsKey("plugins");
+const QString IndexSizeKey("size");
+const QString IndexMtimeKey("mtime");
+const QString IndexMetaKey("meta");
+const int IndexVersion = 1;
+
 struct PluginLoaderDeleter
 {
     void operator()(QPluginLoader* loader)
@@ -82,6 +96,83 @@ Plugin* getPlugin(QPluginLoader& loader)
     return plugin;
 }
 
+QString getIndexFilePath()
+{
+    auto cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (cacheDir.isEmpty()) {
+        return QString();
+    }
+
+    return QDir(cacheDir).filePath("comms_champion/plugins_index.json");
+}
+
+QJsonObject loadIndex(const QString& indexFile)
+{
+    QJsonObject index;
+    do {
+        if (indexFile.isEmpty()) {
+            break;
+        }
+
+        QFile file(indexFile);
+        if (!file.open(QIODevice::ReadOnly)) {
+            break;
+        }
+
+        auto jsonError = QJsonParseError();
+        auto jsonDoc = QJsonDocument::fromJson(file.readAll(), &jsonError);
+        if ((jsonError.error != QJsonParseError::NoError) ||
+            (!jsonDoc.isObject())) {
+            break;
+        }
+
+        auto topObject = jsonDoc.object();
+        if (topObject.value(IndexVersionKey).toInt() != IndexVersion) {
+            break;
+        }
+
+        index = topObject.value(IndexPluginsKey).toObject();
+    } while (false);
+    return index;
+}
+
+void saveIndex(const QString& indexFile, const QJsonObject& index)
+{
+    if (indexFile.isEmpty()) {
+        return;
+    }
+
+    QFileInfo info(indexFile);
+    if (!QDir().mkpath(info.absolutePath())) {
+        return;
+    }
+
+    QSaveFile file(indexFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    QJsonObject topObject;
+    topObject.insert(IndexVersionKey, IndexVersion);
+    topObject.insert(IndexPluginsKey, index);
+    auto data = QJsonDocument(topObject).toJson(QJsonDocument::Compact);
+    if (file.write(data) != data.size()) {
+        file.cancelWriting();
+        return;
+    }
+
+    // Replaces the previous index only when the whole contents have been written
+    file.commit();
+}
+
+bool isIndexEntryValid(const QJsonObject& entry, const QFileInfo& info)
+{
+    return
+        (!entry.isEmpty()) &&
+        (static_cast<qint64>(entry.value(IndexSizeKey).toDouble(-1)) == info.size()) &&
+        (static_cast<qint64>(entry.value(IndexMtimeKey).toDouble(-1)) == info.lastModified().toMSecsSinceEpoch());
+}
+
 PluginMgrImpl::PluginInfo::Type parseType(const QString& val)
 {
     static const QString Values[] = {
@@ -111,8 +202,8 @@ PluginMgrImpl::~PluginMgrImpl() noexcept
 {
     for (auto& pluginInfoPtr : m_plugins) {
         assert(pluginInfoPtr);
-        assert(pluginInfoPtr->m_loader);
-        if (pluginInfoPtr->m_loader->isLoaded()) {
+        if ((pluginInfoPtr->m_loader) &&
+            (pluginInfoPtr->m_loader->isLoaded())) {
             pluginInfoPtr->m_loader->unload();
         }
     }
@@ -132,22 +223,59 @@ const PluginMgrImpl::ListOfPluginInfos& PluginMgrImpl::getAvailablePlugins()
     do {
         QDir pluginDir(m_pluginDir);
         auto files =
-            pluginDir.entryList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+            pluginDir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+
+        auto indexFile = getIndexFilePath();
+        auto index = loadIndex(indexFile);
+        bool indexUpdated = false;
+        QSet<QString> scanned;
 
         for (auto& f : files) {
-            auto infoPtr = readPluginInfo(f);
+            auto path = f.absoluteFilePath();
+            scanned.insert(path);
+
+            auto entry = index.value(path).toObject();
+            if (!isIndexEntryValid(entry, f)) {
+                QPluginLoader loader(path);
+                assert(!loader.isLoaded());
+                entry = QJsonObject();
+                entry.insert(IndexSizeKey, static_cast<double>(f.size()));
+                entry.insert(IndexMtimeKey, static_cast<double>(f.lastModified().toMSecsSinceEpoch()));
+                entry.insert(IndexMetaKey, loader.metaData());
+                assert(!loader.isLoaded());
+                index.insert(path, entry);
+                indexUpdated = true;
+            }
+
+            auto infoPtr = readPluginInfo(path, entry.value(IndexMetaKey).toObject());
             if (!infoPtr) {
                 continue;
             }
 
             if (infoPtr->getType() == PluginInfo::Type::Invalid) {
-                std::cerr << "WARNING: plugin " << f.toStdString() << " doesn't specify its type, use either "
+                std::cerr << "WARNING: plugin " << f.fileName().toStdString() << " doesn't specify its type, use either "
                     "\"socket\", or \"filter\", or \"protocol\"."<< std::endl;
                 continue;
             }
 
             m_plugins.push_back(std::move(infoPtr));
         }
+
+        auto dirPath = pluginDir.absolutePath();
+        for (auto iter = index.begin(); iter != index.end();) {
+            if ((QFileInfo(iter.key()).absolutePath() != dirPath) ||
+                (scanned.contains(iter.key()))) {
+                ++iter;
+                continue;
+            }
+
+            iter = index.erase(iter);
+            indexUpdated = true;
+        }
+
+        if (indexUpdated) {
+            saveIndex(indexFile, index);
+        }
     } while (false);
 
     return m_plugins;
@@ -195,8 +323,7 @@ PluginMgrImpl::ListOfPluginInfos PluginMgrImpl::loadPluginsFromConfig(
 
             auto pluginInfoPtr = *iter;
             assert(pluginInfoPtr);
-            assert(pluginInfoPtr->m_loader);
-            auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+            auto* pluginPtr = getPlugin(getLoader(*pluginInfoPtr));
             assert(pluginPtr != nullptr);
             pluginPtr->reconfigure(config);
 
@@ -229,7 +356,7 @@ bool PluginMgrImpl::savePluginsToConfigFile(
 
 Plugin* PluginMgrImpl::loadPlugin(const PluginInfo& info)
 {
-    return getPlugin(*info.m_loader);
+    return getPlugin(getLoader(info));
 }
 
 bool PluginMgrImpl::hasAppliedPlugins() const
@@ -313,8 +440,7 @@ QVariantMap PluginMgrImpl::getConfigForPlugins(
         assert(!pluginInfoPtr->m_iid.isEmpty());
         pluginsList.append(QVariant::fromValue(pluginInfoPtr->m_iid));
 
-        assert(pluginInfoPtr->m_loader);
-        auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+        auto* pluginPtr = getPlugin(getLoader(*pluginInfoPtr));
         assert(pluginPtr != nullptr);
         pluginPtr->getCurrentConfig(config);
     }
@@ -333,16 +459,13 @@ const QString& PluginMgrImpl::getFilesFilter()
     return ConfigMgr::getFilesFilter();
 }
 
-PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filename)
+PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(
+    const QString& filename,
+    const QJsonObject& metaData)
 {
     PluginInfoPtr ptr;
 
     do {
-        PluginLoaderPtr loader(new QPluginLoader(filename));
-        assert(!loader->isLoaded());
-        auto metaData = loader->metaData();
-        assert(!loader->isLoaded());
-
         if (metaData.isEmpty()) {
             break;
         }
@@ -354,7 +477,7 @@ PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filena
 
         ptr.reset(new PluginInfo());
         ptr->m_iid = iidJsonVal.toString();
-        ptr->m_loader = std::move(loader);
+        ptr->m_filename = filename;
 
         auto extraMeta = metaData.value(MetaDataMetaKey);
         if (!extraMeta.isObject()) {
@@ -397,6 +520,15 @@ PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filena
     return ptr;
 }
 
+QPluginLoader& PluginMgrImpl::getLoader(const PluginInfo& info)
+{
+    if (!info.m_loader) {
+        info.m_loader.reset(new QPluginLoader(info.m_filename));
+    }
+
+    return *info.m_loader;
+}
+
 }  // namespace comms_champion
 
 
@@ -29,6 +29,7 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
 #include <QtCore/QVariantMap>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QJsonObject>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Plugin.h"
@@ -72,7 +73,8 @@ public:
 private:
     typedef std::list<PluginLoaderPtr> PluginLoadersList;
 
-    PluginInfoPtr readPluginInfo(const QString& filename);
+    PluginInfoPtr readPluginInfo(const QString& filename, const QJsonObject& metaData);
+    static QPluginLoader& getLoader(const PluginInfo& info);
 
     QString m_pluginDir;
     ListOfPluginInfos m_plugins;
@@ -44,6 +44,16 @@ Protocol::MessagesList Protocol::read(
     return readImpl(dataInfo, final);
 }
 
+bool Protocol::supportsConcurrentRead() const
+{
+    return supportsConcurrentReadImpl();
+}
+
+void Protocol::connectionClosed(DataInfo::ConnectionId id)
+{
+    connectionClosedImpl(id);
+}
+
 DataInfoPtr Protocol::write(Message& msg)
 {
 
@@ -171,6 +181,16 @@ MessagePtr Protocol::createInvalidMessage(const MsgDataSeq& data)
     return invalidMsg;
 }
 
+bool Protocol::supportsConcurrentReadImpl() const
+{
+    return false;
+}
+
+void Protocol::connectionClosedImpl(DataInfo::ConnectionId id)
+{
+    static_cast<void>(id);
+}
+
 void Protocol::setNameToMessageProperties(Message& msg)
 {
     property::message::ProtocolName().setTo(name(), msg);
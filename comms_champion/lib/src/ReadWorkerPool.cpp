@@ -0,0 +1,137 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ReadWorkerPool.h"
+
+#include <cassert>
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const unsigned MaxThreadsCount = 8U;
+
+}  // namespace
+
+ReadWorkerPool::ReadWorkerPool(unsigned threadsCount)
+{
+    if (threadsCount == 0U) {
+        threadsCount = std::thread::hardware_concurrency();
+        if (0U < threadsCount) {
+            --threadsCount; // The calling thread participates as well
+        }
+
+        if (MaxThreadsCount < threadsCount) {
+            threadsCount = MaxThreadsCount;
+        }
+    }
+
+    m_threads.reserve(threadsCount);
+    for (auto idx = 0U; idx < threadsCount; ++idx) {
+        m_threads.emplace_back(
+            [this]()
+            {
+                workerLoop();
+            });
+    }
+}
+
+ReadWorkerPool::~ReadWorkerPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stopRequested = true;
+    }
+
+    m_tasksCond.notify_all();
+    for (auto& t : m_threads) {
+        t.join();
+    }
+}
+
+void ReadWorkerPool::run(TasksList& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    assert(m_tasks == nullptr);
+    m_tasks = &tasks;
+    m_nextTask = 0U;
+    m_pendingTasks = tasks.size();
+    m_tasksCond.notify_all();
+
+    while (executeNext(lock)) {}
+
+    m_doneCond.wait(
+        lock,
+        [this]()
+        {
+            return m_pendingTasks == 0U;
+        });
+
+    m_tasks = nullptr;
+}
+
+void ReadWorkerPool::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (true) {
+        m_tasksCond.wait(
+            lock,
+            [this]()
+            {
+                return
+                    m_stopRequested ||
+                    ((m_tasks != nullptr) && (m_nextTask < m_tasks->size()));
+            });
+
+        if (m_stopRequested) {
+            break;
+        }
+
+        while (executeNext(lock)) {}
+    }
+}
+
+bool ReadWorkerPool::executeNext(std::unique_lock<std::mutex>& lock)
+{
+    if ((m_tasks == nullptr) || (m_tasks->size() <= m_nextTask)) {
+        return false;
+    }
+
+    auto& task = (*m_tasks)[m_nextTask];
+    ++m_nextTask;
+
+    lock.unlock();
+    task();
+    lock.lock();
+
+    assert(0U < m_pendingTasks);
+    --m_pendingTasks;
+    if (m_pendingTasks == 0U) {
+        m_doneCond.notify_all();
+    }
+
+    return true;
+}
+
+}  // namespace comms_champion
@@ -0,0 +1,61 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace comms_champion
+{
+
+class ReadWorkerPool
+{
+public:
+    typedef std::function<void ()> Task;
+    typedef std::vector<Task> TasksList;
+
+    explicit ReadWorkerPool(unsigned threadsCount = 0U);
+    ~ReadWorkerPool() noexcept;
+
+    ReadWorkerPool(const ReadWorkerPool&) = delete;
+    ReadWorkerPool& operator=(const ReadWorkerPool&) = delete;
+
+    // Executes all the tasks, the calling thread participates,
+    // returns when all the tasks are complete.
+    void run(TasksList& tasks);
+
+private:
+    void workerLoop();
+    bool executeNext(std::unique_lock<std::mutex>& lock);
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_lock;
+    std::condition_variable m_tasksCond;
+    std::condition_variable m_doneCond;
+    TasksList* m_tasks = nullptr;
+    std::size_t m_nextTask = 0U;
+    std::size_t m_pendingTasks = 0U;
+    bool m_stopRequested = false;
+};
+
+}  // namespace comms_champion
@@ -115,6 +115,32 @@ void Socket::reportDataReceived(DataInfoPtr dataPtr)
     m_dataReceivedCallback(std::move(dataPtr));
 }
 
+void Socket::reportDataListReceived(DataInfosList&& dataList)
+{
+    if (!m_running) {
+        return;
+    }
+
+    for (auto& dataPtr : dataList) {
+        if (dataPtr->m_timestamp == DataInfo::Timestamp()) {
+            dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+        }
+    }
+
+    if (m_dataListReceivedCallback) {
+        m_dataListReceivedCallback(std::move(dataList));
+        return;
+    }
+
+    if (!m_dataReceivedCallback) {
+        return;
+    }
+
+    for (auto& dataPtr : dataList) {
+        m_dataReceivedCallback(std::move(dataPtr));
+    }
+}
+
 void Socket::reportError(const QString& msg)
 {
     if (m_running && m_errorReportCallback) {
@@ -130,4 +156,11 @@ void Socket::reportDisconnected()
     }
 }
 
+void Socket::reportConnectionClosed(DataInfo::ConnectionId id)
+{
+    if (m_running && m_connectionClosedReportCallback) {
+        m_connectionClosedReportCallback(id);
+    }
+}
+
 }  // namespace comms_champion
@@ -59,6 +59,7 @@ void EchoSocket::sendDataPostponed()
         auto inDataPtr = makeDataInfo();
         inDataPtr->m_data = dataPtr->m_data;
         inDataPtr->m_extraProperties = dataPtr->m_extraProperties;
+        inDataPtr->m_endpoints = dataPtr->m_endpoints;
         inDataPtr->m_timestamp = DataInfo::TimestampClock::now();
         reportDataReceived(std::move(inDataPtr));
     }
@@ -0,0 +1,797 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "CaptureReader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <tuple>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace replay_socket
+{
+
+namespace
+{
+
+const std::uint32_t PcapMagicUs = 0xa1b2c3d4;
+const std::uint32_t PcapMagicNs = 0xa1b23c4d;
+const std::uint32_t PcapNgShbType = 0x0a0d0d0a;
+const std::uint32_t PcapNgByteOrderMagic = 0x1a2b3c4d;
+const std::size_t PcapHeaderLen = 24U;
+const std::size_t PcapRecordHeaderLen = 16U;
+
+const std::uint32_t PcapNgIdbType = 1U;
+const std::uint32_t PcapNgOpbType = 2U;
+const std::uint32_t PcapNgSpbType = 3U;
+const std::uint32_t PcapNgEpbType = 6U;
+const std::uint16_t PcapNgOptTsResol = 9U;
+const unsigned MaxTsResolExpBase2 = 63U;
+const unsigned MaxTsResolExpBase10 = 19U;
+
+const unsigned LinkTypeNull = 0U;
+const unsigned LinkTypeEthernet = 1U;
+const unsigned LinkTypeRawOld1 = 12U;
+const unsigned LinkTypeRawOld2 = 14U;
+const unsigned LinkTypeRaw = 101U;
+const unsigned LinkTypeLoop = 108U;
+const unsigned LinkTypeLinuxSll = 113U;
+const unsigned LinkTypeIpv4 = 228U;
+const unsigned LinkTypeIpv6 = 229U;
+const unsigned LinkTypeLinuxSll2 = 276U;
+
+const std::uint16_t EtherTypeIpv4 = 0x0800;
+const std::uint16_t EtherTypeIpv6 = 0x86dd;
+const std::uint16_t EtherTypeVlan = 0x8100;
+const std::uint16_t EtherTypeQinQ = 0x88a8;
+
+const std::uint8_t IpProtoTcp = 6U;
+const std::uint8_t IpProtoUdp = 17U;
+
+const unsigned TcpFlagSyn = 0x02;
+
+const std::size_t RawChunkSize = 64U * 1024U;
+const std::size_t MaxTcpPendingSegments = 64U;
+const std::uint64_t NsInSec = 1000000000ULL;
+
+std::uint16_t be16(const std::uint8_t* data)
+{
+    return static_cast<std::uint16_t>((static_cast<unsigned>(data[0]) << 8) | data[1]);
+}
+
+std::uint32_t be32(const std::uint8_t* data)
+{
+    return
+        (static_cast<std::uint32_t>(data[0]) << 24) |
+        (static_cast<std::uint32_t>(data[1]) << 16) |
+        (static_cast<std::uint32_t>(data[2]) << 8) |
+        static_cast<std::uint32_t>(data[3]);
+}
+
+std::uint32_t le32(const std::uint8_t* data)
+{
+    return
+        (static_cast<std::uint32_t>(data[3]) << 24) |
+        (static_cast<std::uint32_t>(data[2]) << 16) |
+        (static_cast<std::uint32_t>(data[1]) << 8) |
+        static_cast<std::uint32_t>(data[0]);
+}
+
+std::int32_t seqDiff(std::uint32_t first, std::uint32_t second)
+{
+    return static_cast<std::int32_t>(first - second);
+}
+
+std::string addrToString(const std::uint8_t* addr, unsigned ipVersion, std::uint16_t port)
+{
+    static const char HexChars[] = "0123456789abcdef";
+    std::string result;
+    if (ipVersion == 4U) {
+        for (auto idx = 0U; idx < 4U; ++idx) {
+            if (idx != 0U) {
+                result += '.';
+            }
+            result += std::to_string(static_cast<unsigned>(addr[idx]));
+        }
+    }
+    else {
+        for (auto idx = 0U; idx < 16U; idx += 2U) {
+            if (idx != 0U) {
+                result += ':';
+            }
+
+            auto group = be16(addr + idx);
+            bool started = false;
+            for (auto shift = 12; 0 <= shift; shift -= 4) {
+                auto nibble = (group >> shift) & 0xf;
+                if ((nibble == 0) && (!started) && (shift != 0)) {
+                    continue;
+                }
+                started = true;
+                result += HexChars[nibble];
+            }
+        }
+    }
+
+    result += ':';
+    result += std::to_string(static_cast<unsigned>(port));
+    return result;
+}
+
+}  // namespace
+
+bool CaptureReader::FlowKey::operator<(const FlowKey& other) const
+{
+    return
+        std::tie(m_proto, m_srcPort, m_dstPort, m_src, m_dst) <
+        std::tie(other.m_proto, other.m_srcPort, other.m_dstPort, other.m_src, other.m_dst);
+}
+
+CaptureReader::CaptureReader(const std::uint8_t* data, std::size_t size)
+  : m_data(data),
+    m_size(size)
+{
+    if (m_size < 4U) {
+        return;
+    }
+
+    auto leMagic = le32(m_data);
+    auto beMagic = be32(m_data);
+    if ((PcapHeaderLen <= m_size) &&
+        ((leMagic == PcapMagicUs) || (leMagic == PcapMagicNs) ||
+         (beMagic == PcapMagicUs) || (beMagic == PcapMagicNs))) {
+        m_format = Format::Pcap;
+        m_bigEndian = ((beMagic == PcapMagicUs) || (beMagic == PcapMagicNs));
+
+        Interface iface;
+        iface.m_linkType = read32(20U) & 0xffff;
+        if (read32(0U) == PcapMagicNs) {
+            iface.m_unitsPerSec = NsInSec;
+        }
+        m_interfaces.push_back(iface);
+        m_pos = PcapHeaderLen;
+        return;
+    }
+
+    if (leMagic == PcapNgShbType) {
+        m_format = Format::PcapNg;
+    }
+}
+
+bool CaptureReader::next(Chunk& chunk)
+{
+    while (m_ready.empty()) {
+        if (readPacket()) {
+            continue;
+        }
+
+        if (m_flushed) {
+            return false;
+        }
+
+        m_flushed = true;
+        flushTcpPending();
+    }
+
+    chunk = std::move(m_ready.front());
+    m_ready.pop_front();
+    return true;
+}
+
+const CaptureReader::FlowInfo* CaptureReader::flowInfo(FlowId id) const
+{
+    if ((id == 0U) || (m_flows.size() < id)) {
+        return nullptr;
+    }
+
+    return &m_flows[static_cast<std::size_t>(id - 1U)].m_info;
+}
+
+std::uint16_t CaptureReader::read16(std::size_t pos) const
+{
+    auto* data = m_data + pos;
+    if (m_bigEndian) {
+        return be16(data);
+    }
+
+    return static_cast<std::uint16_t>((static_cast<unsigned>(data[1]) << 8) | data[0]);
+}
+
+std::uint32_t CaptureReader::read32(std::size_t pos) const
+{
+    if (m_bigEndian) {
+        return be32(m_data + pos);
+    }
+
+    return le32(m_data + pos);
+}
+
+bool CaptureReader::readPacket()
+{
+    if (m_size <= m_pos) {
+        return false;
+    }
+
+    switch (m_format) {
+        case Format::Raw: return readRaw();
+        case Format::Pcap: return readPcap();
+        case Format::PcapNg: return readPcapNg();
+        default: break;
+    }
+
+    static constexpr bool Should_not_happen = false;
+    static_cast<void>(Should_not_happen);
+    assert(Should_not_happen);
+    return false;
+}
+
+bool CaptureReader::readRaw()
+{
+    auto len = std::min(RawChunkSize, m_size - m_pos);
+    Chunk chunk;
+    chunk.m_data.assign(m_data + m_pos, m_data + m_pos + len);
+    m_ready.push_back(std::move(chunk));
+    m_pos += len;
+    return true;
+}
+
+bool CaptureReader::readPcap()
+{
+    if ((m_size - m_pos) < PcapRecordHeaderLen) {
+        return false;
+    }
+
+    auto sec = read32(m_pos);
+    auto frac = read32(m_pos + 4U);
+    auto inclLen = static_cast<std::size_t>(read32(m_pos + 8U));
+    auto origLen = static_cast<std::size_t>(read32(m_pos + 12U));
+    auto dataPos = m_pos + PcapRecordHeaderLen;
+    if ((m_size - dataPos) < inclLen) {
+        // Truncated capture
+        return false;
+    }
+
+    m_pos = dataPos + inclLen;
+    assert(!m_interfaces.empty());
+    auto& iface = m_interfaces.front();
+    auto timestamp =
+        (static_cast<TimestampNs>(sec) * NsInSec) +
+        ((static_cast<TimestampNs>(frac) * NsInSec) / iface.m_unitsPerSec);
+
+    if (inclLen < origLen) {
+        // Partially captured packet
+        ++m_skippedPackets;
+        return true;
+    }
+
+    processLinkFrame(iface.m_linkType, timestamp, m_data + dataPos, inclLen);
+    return true;
+}
+
+bool CaptureReader::readPcapNg()
+{
+    static const std::size_t MinBlockLen = 12U;
+    if ((m_size - m_pos) < MinBlockLen) {
+        return false;
+    }
+
+    auto type = le32(m_data + m_pos);
+    if (type == PcapNgShbType) {
+        auto bom = le32(m_data + m_pos + 8U);
+        m_bigEndian = (bom != PcapNgByteOrderMagic);
+        m_interfaces.clear();
+    }
+    else {
+        type = read32(m_pos);
+    }
+
+    auto blockLen = static_cast<std::size_t>(read32(m_pos + 4U));
+    if ((blockLen < MinBlockLen) || ((m_size - m_pos) < blockLen)) {
+        return false;
+    }
+
+    auto body = m_pos + 8U;
+    auto bodyLen = blockLen - MinBlockLen;
+    m_pos += blockLen;
+
+    std::size_t ifaceIdx = 0U;
+    std::size_t capLen = 0U;
+    std::size_t origLen = 0U;
+    std::size_t dataPos = 0U;
+    auto timestamp = m_lastTimestamp;
+    bool hasTimestamp = true;
+
+    if (type == PcapNgIdbType) {
+        parseInterface(body, bodyLen);
+        return true;
+    }
+
+    if ((type == PcapNgEpbType) || (type == PcapNgOpbType)) {
+        static const std::size_t HeaderLen = 20U;
+        if (bodyLen < HeaderLen) {
+            return true;
+        }
+
+        if (type == PcapNgEpbType) {
+            ifaceIdx = static_cast<std::size_t>(read32(body));
+        }
+        else {
+            ifaceIdx = static_cast<std::size_t>(read16(body));
+        }
+
+        auto tsValue =
+            (static_cast<std::uint64_t>(read32(body + 4U)) << 32) |
+            static_cast<std::uint64_t>(read32(body + 8U));
+        capLen = static_cast<std::size_t>(read32(body + 12U));
+        origLen = static_cast<std::size_t>(read32(body + 16U));
+        dataPos = body + HeaderLen;
+        if ((bodyLen - HeaderLen) < capLen) {
+            return true;
+        }
+
+        if (ifaceIdx < m_interfaces.size()) {
+            auto units = m_interfaces[ifaceIdx].m_unitsPerSec;
+            auto secs = tsValue / units;
+            auto frac = tsValue % units;
+            timestamp =
+                (secs * NsInSec) +
+                static_cast<TimestampNs>(static_cast<double>(frac) * (static_cast<double>(NsInSec) / static_cast<double>(units)));
+        }
+    }
+    else if (type == PcapNgSpbType) {
+        static const std::size_t HeaderLen = 4U;
+        if (bodyLen < HeaderLen) {
+            return true;
+        }
+
+        origLen = static_cast<std::size_t>(read32(body));
+        capLen = std::min(origLen, bodyLen - HeaderLen);
+        dataPos = body + HeaderLen;
+        hasTimestamp = false;
+    }
+    else {
+        // Other blocks are not relevant
+        return true;
+    }
+
+    if (m_interfaces.size() <= ifaceIdx) {
+        ++m_skippedPackets;
+        return true;
+    }
+
+    if (hasTimestamp) {
+        m_lastTimestamp = timestamp;
+    }
+
+    if (capLen < origLen) {
+        ++m_skippedPackets;
+        return true;
+    }
+
+    processLinkFrame(m_interfaces[ifaceIdx].m_linkType, timestamp, m_data + dataPos, capLen);
+    return true;
+}
+
+void CaptureReader::parseInterface(std::size_t body, std::size_t bodyLen)
+{
+    static const std::size_t HeaderLen = 8U;
+    static const std::size_t OptHeaderLen = 4U;
+    if (bodyLen < HeaderLen) {
+        return;
+    }
+
+    Interface iface;
+    iface.m_linkType = read16(body);
+
+    auto pos = body + HeaderLen;
+    auto end = body + bodyLen;
+    while (OptHeaderLen <= (end - pos)) {
+        auto code = read16(pos);
+        auto len = static_cast<std::size_t>(read16(pos + 2U));
+        pos += OptHeaderLen;
+        if ((code == 0U) || ((end - pos) < len)) {
+            break;
+        }
+
+        if ((code == PcapNgOptTsResol) && (len == 1U)) {
+            auto resol = static_cast<unsigned>(m_data[pos]);
+            auto exp = resol & 0x7f;
+            auto base = ((resol & 0x80) != 0U) ? 2U : 10U;
+            auto maxExp = (base == 2U) ? MaxTsResolExpBase2 : MaxTsResolExpBase10;
+            if (exp <= maxExp) {
+                std::uint64_t units = 1U;
+                for (auto idx = 0U; idx < exp; ++idx) {
+                    units *= base;
+                }
+                iface.m_unitsPerSec = units;
+            }
+            // Otherwise the resolution doesn't fit 64 bits, keep default microseconds
+        }
+
+        auto paddedLen = (len + 3U) & ~static_cast<std::size_t>(3U);
+        if (static_cast<std::size_t>(end - pos) <= paddedLen) {
+            // Last option, possibly without padding
+            break;
+        }
+
+        pos += paddedLen;
+    }
+
+    m_interfaces.push_back(iface);
+}
+
+void CaptureReader::processLinkFrame(unsigned linkType, TimestampNs timestamp, const std::uint8_t* data, std::size_t len)
+{
+    std::size_t offset = 0U;
+    std::uint16_t etherType = 0U;
+    switch (linkType) {
+        case LinkTypeNull:
+        case LinkTypeLoop:
+            // The family is in host byte order of the capturing machine,
+            // rely on the IP version instead.
+            offset = 4U;
+            break;
+
+        case LinkTypeEthernet:
+        {
+            static const std::size_t EthHeaderLen = 14U;
+            static const std::size_t VlanTagLen = 4U;
+            if (len < EthHeaderLen) {
+                break;
+            }
+
+            etherType = be16(data + 12U);
+            offset = EthHeaderLen;
+            while (((etherType == EtherTypeVlan) || (etherType == EtherTypeQinQ)) &&
+                   ((offset + VlanTagLen) <= len)) {
+                etherType = be16(data + offset + 2U);
+                offset += VlanTagLen;
+            }
+
+            if ((etherType != EtherTypeIpv4) && (etherType != EtherTypeIpv6)) {
+                offset = len;
+            }
+            break;
+        }
+
+        case LinkTypeRawOld1:
+        case LinkTypeRawOld2:
+        case LinkTypeRaw:
+        case LinkTypeIpv4:
+        case LinkTypeIpv6:
+            break;
+
+        case LinkTypeLinuxSll:
+        case LinkTypeLinuxSll2:
+        {
+            auto headerLen = (linkType == LinkTypeLinuxSll) ? 16U : 20U;
+            auto protoPos = (linkType == LinkTypeLinuxSll) ? 14U : 0U;
+            if (len < headerLen) {
+                offset = len;
+                break;
+            }
+
+            etherType = be16(data + protoPos);
+            offset = headerLen;
+            if ((etherType != EtherTypeIpv4) && (etherType != EtherTypeIpv6)) {
+                offset = len;
+            }
+            break;
+        }
+
+        default:
+            offset = len;
+            break;
+    }
+
+    if (len <= offset) {
+        ++m_skippedPackets;
+        return;
+    }
+
+    processIp(timestamp, data + offset, len - offset);
+}
+
+void CaptureReader::processIp(TimestampNs timestamp, const std::uint8_t* data, std::size_t len)
+{
+    FlowKey key;
+    auto version = static_cast<unsigned>(data[0] >> 4);
+    if (version == 4U) {
+        static const std::size_t MinHeaderLen = 20U;
+        static const std::uint16_t FragMask = 0x3fff; // MF flag + offset
+        if (len < MinHeaderLen) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        auto headerLen = static_cast<std::size_t>(data[0] & 0xf) * 4U;
+        auto totalLen = static_cast<std::size_t>(be16(data + 2U));
+        if ((headerLen < MinHeaderLen) || (totalLen < headerLen) || (len < totalLen) ||
+            ((be16(data + 6U) & FragMask) != 0U)) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        key.m_src.fill(0U);
+        key.m_dst.fill(0U);
+        std::copy_n(data + 12U, 4U, key.m_src.begin());
+        std::copy_n(data + 16U, 4U, key.m_dst.begin());
+        key.m_proto = data[9];
+        processTransport(key, version, timestamp, data + headerLen, totalLen - headerLen);
+        return;
+    }
+
+    if (version == 6U) {
+        static const std::size_t HeaderLen = 40U;
+        static const std::uint8_t HopByHop = 0U;
+        static const std::uint8_t Routing = 43U;
+        static const std::uint8_t DestOpts = 60U;
+        static const std::uint8_t Auth = 51U;
+        if (len < HeaderLen) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        auto payloadLen = static_cast<std::size_t>(be16(data + 4U));
+        if ((len - HeaderLen) < payloadLen) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        std::copy_n(data + 8U, 16U, key.m_src.begin());
+        std::copy_n(data + 24U, 16U, key.m_dst.begin());
+
+        auto next = data[6];
+        auto* payload = data + HeaderLen;
+        while ((next == HopByHop) || (next == Routing) || (next == DestOpts) || (next == Auth)) {
+            if (payloadLen < 2U) {
+                ++m_skippedPackets;
+                return;
+            }
+
+            std::size_t extLen = 0U;
+            if (next == Auth) {
+                extLen = (static_cast<std::size_t>(payload[1]) + 2U) * 4U;
+            }
+            else {
+                extLen = (static_cast<std::size_t>(payload[1]) + 1U) * 8U;
+            }
+
+            if (payloadLen < extLen) {
+                ++m_skippedPackets;
+                return;
+            }
+
+            next = payload[0];
+            payload += extLen;
+            payloadLen -= extLen;
+        }
+
+        // Fragments (44) end up here as well and get skipped
+        key.m_proto = next;
+        processTransport(key, version, timestamp, payload, payloadLen);
+        return;
+    }
+
+    ++m_skippedPackets;
+}
+
+void CaptureReader::processTransport(
+    FlowKey& key,
+    unsigned ipVersion,
+    TimestampNs timestamp,
+    const std::uint8_t* data,
+    std::size_t len)
+{
+    if (key.m_proto == IpProtoUdp) {
+        static const std::size_t HeaderLen = 8U;
+        if (len < HeaderLen) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        auto udpLen = static_cast<std::size_t>(be16(data + 4U));
+        if ((udpLen < HeaderLen) || (len < udpLen)) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        key.m_srcPort = be16(data);
+        key.m_dstPort = be16(data + 2U);
+        auto id = getFlow(key, ipVersion);
+        if (HeaderLen < udpLen) {
+            pushChunk(id, timestamp, data + HeaderLen, udpLen - HeaderLen);
+        }
+        return;
+    }
+
+    if (key.m_proto == IpProtoTcp) {
+        static const std::size_t MinHeaderLen = 20U;
+        if (len < MinHeaderLen) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        auto headerLen = static_cast<std::size_t>(data[12] >> 4) * 4U;
+        if ((headerLen < MinHeaderLen) || (len < headerLen)) {
+            ++m_skippedPackets;
+            return;
+        }
+
+        key.m_srcPort = be16(data);
+        key.m_dstPort = be16(data + 2U);
+        auto id = getFlow(key, ipVersion);
+        processTcp(id, be32(data + 4U), static_cast<unsigned>(data[13]), timestamp, data + headerLen, len - headerLen);
+        return;
+    }
+
+    ++m_skippedPackets;
+}
+
+CaptureReader::FlowId CaptureReader::getFlow(const FlowKey& key, unsigned ipVersion)
+{
+    auto iter = m_flowsMap.find(key);
+    if (iter != m_flowsMap.end()) {
+        return iter->second;
+    }
+
+    m_flows.emplace_back();
+    auto id = static_cast<FlowId>(m_flows.size());
+    auto& info = m_flows.back().m_info;
+    info.m_transport = (key.m_proto == IpProtoTcp) ? Transport::Tcp : Transport::Udp;
+    info.m_from = addrToString(key.m_src.data(), ipVersion, key.m_srcPort);
+    info.m_to = addrToString(key.m_dst.data(), ipVersion, key.m_dstPort);
+    m_flowsMap.insert(std::make_pair(key, id));
+    return id;
+}
+
+void CaptureReader::processTcp(
+    FlowId id,
+    std::uint32_t seq,
+    unsigned flags,
+    TimestampNs timestamp,
+    const std::uint8_t* data,
+    std::size_t len)
+{
+    auto& flow = m_flows[static_cast<std::size_t>(id - 1U)];
+    if ((flags & TcpFlagSyn) != 0U) {
+        // New connection (possibly reusing the same ports)
+        ++seq;
+        flow.m_synced = true;
+        flow.m_nextSeq = seq;
+        flow.m_pending.clear();
+    }
+
+    if (len == 0U) {
+        return;
+    }
+
+    if (!flow.m_synced) {
+        // The capture started in the middle of the connection
+        flow.m_synced = true;
+        flow.m_nextSeq = seq;
+    }
+
+    auto diff = seqDiff(seq, flow.m_nextSeq);
+    if (diff < 0) {
+        // Retransmission, possibly partial
+        auto overlap = static_cast<std::size_t>(-static_cast<std::int64_t>(diff));
+        if (len <= overlap) {
+            return;
+        }
+
+        data += overlap;
+        len -= overlap;
+        diff = 0;
+    }
+
+    if (0 < diff) {
+        TcpSegment segment;
+        segment.m_seq = seq;
+        segment.m_timestamp = timestamp;
+        segment.m_data.assign(data, data + len);
+        flow.m_pending.push_back(std::move(segment));
+        if (MaxTcpPendingSegments < flow.m_pending.size()) {
+            // The missing segment was not captured
+            skipTcpGap(id, flow);
+        }
+        return;
+    }
+
+    pushChunk(id, timestamp, data, len);
+    flow.m_nextSeq += static_cast<std::uint32_t>(len);
+    drainTcpPending(id, flow);
+}
+
+void CaptureReader::drainTcpPending(FlowId id, Flow& flow)
+{
+    bool progress = true;
+    while (progress && (!flow.m_pending.empty())) {
+        progress = false;
+        for (auto iter = flow.m_pending.begin(); iter != flow.m_pending.end(); ++iter) {
+            auto diff = seqDiff(iter->m_seq, flow.m_nextSeq);
+            if (0 < diff) {
+                continue;
+            }
+
+            auto overlap = static_cast<std::size_t>(-static_cast<std::int64_t>(diff));
+            auto& segData = iter->m_data;
+            if (overlap < segData.size()) {
+                auto len = segData.size() - overlap;
+                pushChunk(id, iter->m_timestamp, segData.data() + overlap, len);
+                flow.m_nextSeq += static_cast<std::uint32_t>(len);
+            }
+
+            flow.m_pending.erase(iter);
+            progress = true;
+            break;
+        }
+    }
+}
+
+void CaptureReader::skipTcpGap(FlowId id, Flow& flow)
+{
+    if (flow.m_pending.empty()) {
+        return;
+    }
+
+    auto nextSeq = flow.m_nextSeq;
+    auto iter =
+        std::min_element(
+            flow.m_pending.begin(), flow.m_pending.end(),
+            [nextSeq](const TcpSegment& first, const TcpSegment& second)
+            {
+                return seqDiff(first.m_seq, nextSeq) < seqDiff(second.m_seq, nextSeq);
+            });
+
+    ++m_tcpGaps;
+    flow.m_nextSeq = iter->m_seq;
+    drainTcpPending(id, flow);
+}
+
+void CaptureReader::flushTcpPending()
+{
+    for (auto idx = 0U; idx < m_flows.size(); ++idx) {
+        auto& flow = m_flows[idx];
+        while (!flow.m_pending.empty()) {
+            skipTcpGap(static_cast<FlowId>(idx + 1U), flow);
+        }
+    }
+}
+
+void CaptureReader::pushChunk(FlowId id, TimestampNs timestamp, const std::uint8_t* data, std::size_t len)
+{
+    Chunk chunk;
+    chunk.m_timestamp = timestamp;
+    chunk.m_hasTimestamp = true;
+    chunk.m_flowId = id;
+    chunk.m_data.assign(data, data + len);
+    m_ready.push_back(std::move(chunk));
+}
+
+}  // namespace replay_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
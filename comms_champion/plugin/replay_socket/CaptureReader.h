@@ -0,0 +1,183 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace replay_socket
+{
+
+/// @brief Reader of the recorded captures residing in memory.
+/// @details Supports raw byte streams as well as pcap and pcapng captures.
+///     Payloads of the UDP datagrams are extracted as is, while TCP streams
+///     are reassembled (reordered, retransmissions removed). Fragmented IP
+///     packets are not reassembled and skipped.
+class CaptureReader
+{
+public:
+    enum class Format
+    {
+        Raw,
+        Pcap,
+        PcapNg,
+        NumOfValues
+    };
+
+    enum class Transport
+    {
+        None,
+        Tcp,
+        Udp,
+        NumOfValues
+    };
+
+    using FlowId = unsigned long long;
+    using DataSeq = std::vector<std::uint8_t>;
+    using TimestampNs = std::uint64_t;
+
+    struct Chunk
+    {
+        TimestampNs m_timestamp = 0U; ///< Nanoseconds since epoch
+        bool m_hasTimestamp = false;
+        FlowId m_flowId = 0U; ///< 0 for the raw stream
+        DataSeq m_data;
+    };
+
+    struct FlowInfo
+    {
+        Transport m_transport = Transport::None;
+        std::string m_from;
+        std::string m_to;
+    };
+
+    CaptureReader(const std::uint8_t* data, std::size_t size);
+
+    Format format() const
+    {
+        return m_format;
+    }
+
+    /// @brief Retrieve next chunk of data.
+    /// @return false when there is no more data.
+    bool next(Chunk& chunk);
+
+    /// @brief Retrieve information about the flow.
+    /// @return nullptr for unknown flow (including raw stream).
+    const FlowInfo* flowInfo(FlowId id) const;
+
+    std::size_t skippedPackets() const
+    {
+        return m_skippedPackets;
+    }
+
+    std::size_t tcpGaps() const
+    {
+        return m_tcpGaps;
+    }
+
+private:
+    using Address = std::array<std::uint8_t, 16>;
+
+    struct FlowKey
+    {
+        Address m_src;
+        Address m_dst;
+        std::uint16_t m_srcPort = 0U;
+        std::uint16_t m_dstPort = 0U;
+        std::uint8_t m_proto = 0U;
+
+        bool operator<(const FlowKey& other) const;
+    };
+
+    struct TcpSegment
+    {
+        std::uint32_t m_seq = 0U;
+        TimestampNs m_timestamp = 0U;
+        DataSeq m_data;
+    };
+
+    struct Flow
+    {
+        FlowInfo m_info;
+        bool m_synced = false;
+        std::uint32_t m_nextSeq = 0U;
+        std::list<TcpSegment> m_pending;
+    };
+
+    struct Interface
+    {
+        unsigned m_linkType = 0U;
+        std::uint64_t m_unitsPerSec = 1000000U;
+    };
+
+    using FlowsMap = std::map<FlowKey, FlowId>;
+    using FlowsList = std::vector<Flow>;
+    using InterfacesList = std::vector<Interface>;
+    using ChunksQueue = std::deque<Chunk>;
+
+    std::uint16_t read16(std::size_t pos) const;
+    std::uint32_t read32(std::size_t pos) const;
+    bool readPacket();
+    bool readRaw();
+    bool readPcap();
+    bool readPcapNg();
+    void parseInterface(std::size_t body, std::size_t bodyLen);
+    void processLinkFrame(unsigned linkType, TimestampNs timestamp, const std::uint8_t* data, std::size_t len);
+    void processIp(TimestampNs timestamp, const std::uint8_t* data, std::size_t len);
+    void processTransport(FlowKey& key, unsigned ipVersion, TimestampNs timestamp, const std::uint8_t* data, std::size_t len);
+    FlowId getFlow(const FlowKey& key, unsigned ipVersion);
+    void processTcp(FlowId id, std::uint32_t seq, unsigned flags, TimestampNs timestamp, const std::uint8_t* data, std::size_t len);
+    void drainTcpPending(FlowId id, Flow& flow);
+    void skipTcpGap(FlowId id, Flow& flow);
+    void flushTcpPending();
+    void pushChunk(FlowId id, TimestampNs timestamp, const std::uint8_t* data, std::size_t len);
+
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0U;
+    std::size_t m_pos = 0U;
+    Format m_format = Format::Raw;
+    bool m_bigEndian = false;
+    bool m_flushed = false;
+    InterfacesList m_interfaces;
+    TimestampNs m_lastTimestamp = 0U;
+    FlowsMap m_flowsMap;
+    FlowsList m_flows;
+    ChunksQueue m_ready;
+    std::size_t m_skippedPackets = 0U;
+    std::size_t m_tcpGaps = 0U;
+};
+
+}  // namespace replay_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
@@ -0,0 +1,263 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "Socket.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace replay_socket
+{
+
+namespace
+{
+
+const QString TcpFromPropName("tcp.from");
+const QString TcpToPropName("tcp.to");
+const QString UdpFromPropName("udp.from");
+const QString UdpToPropName("udp.to");
+
+// Limits of the data reported in one go, let the event loop breathe in between
+const std::size_t MaxBatchChunks = 4096U;
+const std::size_t MaxBatchBytes = 4U * 1024U * 1024U;
+
+}  // namespace
+
+Socket::Socket()
+{
+    m_timer.setSingleShot(true);
+    connect(
+        &m_timer, SIGNAL(timeout()),
+        this, SLOT(replayNext()));
+}
+
+Socket::~Socket() noexcept
+{
+    m_timer.stop();
+    closeFile();
+}
+
+bool Socket::socketConnectImpl()
+{
+    if (m_reader) {
+        static constexpr bool Already_connected = false;
+        static_cast<void>(Already_connected);
+        assert(Already_connected);
+        static const QString AlreadyConnectedError(
+            tr("Previous replay wasn't terminated properly."));
+        reportError(AlreadyConnectedError);
+        return false;
+    }
+
+    m_file.setFileName(m_filePath);
+    if (!m_file.open(QFile::ReadOnly)) {
+        reportError(tr("Failed to open replay file ") + m_filePath);
+        return false;
+    }
+
+    auto size = m_file.size();
+    const uchar* data = nullptr;
+    if (0 < size) {
+        data = m_file.map(0, size);
+        if (data == nullptr) {
+            reportError(tr("Failed to memory map replay file ") + m_filePath);
+            m_file.close();
+            return false;
+        }
+    }
+
+    m_reader.reset(new CaptureReader(data, static_cast<std::size_t>(size)));
+    m_chunkValid = false;
+    m_firstTimestampValid = false;
+    m_flowEndpoints.clear();
+    m_timer.start(0);
+    return true;
+}
+
+void Socket::socketDisconnectImpl()
+{
+    m_timer.stop();
+    closeFile();
+}
+
+void Socket::sendDataImpl(DataInfoPtr dataPtr)
+{
+    // Replayed capture is read only, outgoing data is discarded
+    static_cast<void>(dataPtr);
+}
+
+unsigned Socket::connectionPropertiesImpl() const
+{
+    return ConnectionProperty_Autoconnect;
+}
+
+void Socket::replayNext()
+{
+    if (!m_reader) {
+        return;
+    }
+
+    bool timed = (0.0 < m_speed);
+    bool complete = false;
+    int delayMs = 0;
+    std::size_t bytes = 0U;
+    DataInfosList dataList;
+    while (true) {
+        if (!m_chunkValid) {
+            if (!m_reader->next(m_chunk)) {
+                complete = true;
+                break;
+            }
+            m_chunkValid = true;
+        }
+
+        if (timed && m_chunk.m_hasTimestamp) {
+            if (!m_firstTimestampValid) {
+                m_firstTimestampValid = true;
+                m_firstTimestamp = m_chunk.m_timestamp;
+                m_startTime = SteadyClock::now();
+            }
+
+            auto offsetNs =
+                static_cast<double>(static_cast<std::int64_t>(m_chunk.m_timestamp - m_firstTimestamp)) / m_speed;
+            auto dueTime =
+                m_startTime +
+                std::chrono::duration_cast<SteadyClock::duration>(
+                    std::chrono::nanoseconds(static_cast<std::int64_t>(offsetNs)));
+
+            auto now = SteadyClock::now();
+            if (now < dueTime) {
+                auto waitMs =
+                    std::chrono::duration_cast<std::chrono::microseconds>(dueTime - now).count();
+                delayMs = static_cast<int>(std::ceil(static_cast<double>(waitMs) / 1000.0));
+                break;
+            }
+        }
+
+        bytes += m_chunk.m_data.size();
+        dataList.push_back(makeChunkDataInfo(m_chunk));
+        m_chunkValid = false;
+
+        if ((MaxBatchChunks <= dataList.size()) || (MaxBatchBytes <= bytes)) {
+            break;
+        }
+    }
+
+    if (!dataList.empty()) {
+        reportDataListReceived(std::move(dataList));
+    }
+
+    if (!m_reader) {
+        // Disconnected while reporting the data
+        return;
+    }
+
+    if (complete) {
+        replayComplete();
+        return;
+    }
+
+    m_timer.start(delayMs);
+}
+
+DataInfoPtr Socket::makeChunkDataInfo(CaptureReader::Chunk& chunk)
+{
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_data = std::move(chunk.m_data);
+    dataPtr->m_connectionId = chunk.m_flowId;
+    if (chunk.m_hasTimestamp) {
+        // Preserve original capture time
+        dataPtr->m_timestamp =
+            DataInfo::Timestamp(
+                std::chrono::duration_cast<DataInfo::TimestampClock::duration>(
+                    std::chrono::nanoseconds(chunk.m_timestamp)));
+    }
+    else {
+        dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    }
+
+    if (chunk.m_flowId == 0U) {
+        return dataPtr;
+    }
+
+    auto flowIdx = static_cast<std::size_t>(chunk.m_flowId - 1U);
+    if (m_flowEndpoints.size() <= flowIdx) {
+        m_flowEndpoints.resize(flowIdx + 1U);
+    }
+
+    auto& flowEndpoints = m_flowEndpoints[flowIdx];
+    if (!flowEndpoints) {
+        auto* info = m_reader->flowInfo(chunk.m_flowId);
+        assert(info != nullptr);
+        bool tcp = (info->m_transport == CaptureReader::Transport::Tcp);
+
+        QVariantMap endpoints;
+        endpoints.insert(tcp ? TcpFromPropName : UdpFromPropName, QString::fromStdString(info->m_from));
+        endpoints.insert(tcp ? TcpToPropName : UdpToPropName, QString::fromStdString(info->m_to));
+        flowEndpoints = internDataEndpoints(endpoints);
+    }
+
+    dataPtr->m_endpoints = flowEndpoints;
+    return dataPtr;
+}
+
+void Socket::closeFile()
+{
+    // All the flows end together with the capture
+    for (std::size_t idx = 0U; idx < m_flowEndpoints.size(); ++idx) {
+        if (m_flowEndpoints[idx]) {
+            reportConnectionClosed(static_cast<DataInfo::ConnectionId>(idx + 1U));
+        }
+    }
+    m_flowEndpoints.clear();
+
+    m_reader.reset();
+    m_chunkValid = false;
+    m_chunk = CaptureReader::Chunk();
+    if (m_file.isOpen()) {
+        m_file.close(); // also unmaps
+    }
+}
+
+void Socket::replayComplete()
+{
+    assert(m_reader);
+    auto skipped = m_reader->skippedPackets();
+    auto gaps = m_reader->tcpGaps();
+    closeFile();
+
+    if ((0U < skipped) || (0U < gaps)) {
+        reportError(
+            tr("Replay complete: %1 packets were skipped, %2 gaps in TCP streams.")
+                .arg(static_cast<qulonglong>(skipped)).arg(static_cast<qulonglong>(gaps)));
+    }
+
+    reportDisconnected();
+}
+
+}  // namespace replay_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
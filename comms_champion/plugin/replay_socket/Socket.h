@@ -0,0 +1,116 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+
+#include "CaptureReader.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace replay_socket
+{
+
+class Socket : public QObject,
+               public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    Socket();
+    ~Socket() noexcept;
+
+    void setFilePath(const QString& value)
+    {
+        m_filePath = value;
+    }
+
+    const QString& getFilePath() const
+    {
+        return m_filePath;
+    }
+
+    /// @brief Set replay speed factor.
+    /// @details 0 means as fast as possible, otherwise the intervals
+    ///     between the original capture timestamps are divided by the factor.
+    void setSpeed(double value)
+    {
+        m_speed = value;
+    }
+
+    double getSpeed() const
+    {
+        return m_speed;
+    }
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+    virtual unsigned connectionPropertiesImpl() const override;
+
+private slots:
+    void replayNext();
+
+private:
+    using ReaderPtr = std::unique_ptr<CaptureReader>;
+    using SteadyClock = std::chrono::steady_clock;
+
+    using FlowEndpointsList = std::vector<DataEndpointsPtr>;
+
+    DataInfoPtr makeChunkDataInfo(CaptureReader::Chunk& chunk);
+    void closeFile();
+    void replayComplete();
+
+    QString m_filePath;
+    double m_speed = 0.0;
+    QFile m_file;
+    ReaderPtr m_reader;
+    QTimer m_timer;
+    CaptureReader::Chunk m_chunk;
+    bool m_chunkValid = false;
+    bool m_firstTimestampValid = false;
+    CaptureReader::TimestampNs m_firstTimestamp = 0U;
+    SteadyClock::time_point m_startTime;
+    FlowEndpointsList m_flowEndpoints;
+};
+
+}  // namespace replay_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
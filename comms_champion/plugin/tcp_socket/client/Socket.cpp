@@ -95,6 +95,7 @@ void Socket::socketDisconnectImpl()
     m_socket.disconnectFromHost();
     m_socket.close();
     m_socket.blockSignals(false);
+    m_endpoints.reset();
 }
 
 void Socket::sendDataImpl(DataInfoPtr dataPtr)
@@ -119,6 +120,8 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
 
 void Socket::socketDisconnected()
 {
+    m_endpoints.reset();
+
 //    static const QString DisconnectedError(
 //        tr("Connection to TCP/IP Server was disconnected."));
 //    reportError(DisconnectedError);
@@ -142,15 +145,21 @@ void Socket::readFromSocket()
         dataPtr->m_data.resize(static_cast<std::size_t>(result));
     }
 
-    QString from =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
-    QString to =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
+    if (!m_endpoints) {
+        QString from =
+            m_socket.peerAddress().toString() + ':' +
+                        QString("%1").arg(m_socket.peerPort());
+        QString to =
+            m_socket.localAddress().toString() + ':' +
+                        QString("%1").arg(m_socket.localPort());
+
+        QVariantMap endpoints;
+        endpoints.insert(FromPropName, from);
+        endpoints.insert(ToPropName, to);
+        m_endpoints = internDataEndpoints(endpoints);
+    }
 
-    dataPtr->m_extraProperties.insert(FromPropName, from);
-    dataPtr->m_extraProperties.insert(ToPropName, to);
+    dataPtr->m_endpoints = m_endpoints;
     reportDataReceived(std::move(dataPtr));
 }
 
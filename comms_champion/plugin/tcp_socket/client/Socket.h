@@ -88,6 +88,7 @@ private:
     QString m_host;
     PortType m_port = DefaultPort;
     QTcpSocket m_socket;
+    DataEndpointsPtr m_endpoints;
 };
 
 }  // namespace client
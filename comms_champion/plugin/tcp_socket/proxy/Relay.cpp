@@ -0,0 +1,425 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Relay.h"
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QCoreApplication>
+#include <QtNetwork/QHostAddress>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace tcp_socket
+{
+
+namespace proxy
+{
+
+namespace
+{
+
+const QString FromPropName("tcp.from");
+const QString ToPropName("tcp.to");
+const std::size_t RelayBufSize = 64U * 1024U;
+
+// Number of consecutive reads of the stream forming a single sampled window
+const unsigned long long TapWindowChunks = 32U;
+
+}  // namespace
+
+Relay::Relay(
+    const QString& remoteHost,
+    PortType remotePort,
+    unsigned tapSampleRate,
+    unsigned tapQueueLimit)
+  : m_remoteHost(remoteHost),
+    m_remotePort(remotePort),
+    m_tapSampleRate(tapSampleRate),
+    m_tapQueueLimit(tapQueueLimit),
+    m_buf(RelayBufSize)
+{
+    if (m_remoteHost.isEmpty()) {
+        m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
+    }
+}
+
+Relay::~Relay() noexcept
+{
+    assert(m_sockets.empty());
+}
+
+void Relay::queueSend(DataInfoPtr dataPtr)
+{
+    std::lock_guard<std::mutex> guard(m_sendLock);
+    m_pendingSend.push_back(std::move(dataPtr));
+}
+
+void Relay::takeTapped(DataInfosList& tapped, TapIdsList& closed)
+{
+    std::lock_guard<std::mutex> guard(m_tapLock);
+    tapped.swap(m_tapped);
+    closed.swap(m_tappedClosed);
+}
+
+unsigned long long Relay::droppedCount() const
+{
+    std::lock_guard<std::mutex> guard(m_tapLock);
+    return m_droppedCount;
+}
+
+void Relay::addClient(qintptr descriptor)
+{
+    // Created on the relay thread to have proper thread affinity
+    auto* socket = new QTcpSocket(this);
+    if (!socket->setSocketDescriptor(descriptor)) {
+        emit sigErrorReported(socket->errorString());
+        delete socket;
+        return;
+    }
+
+    connect(
+        socket, SIGNAL(disconnected()),
+        this, SLOT(clientConnectionTerminated()));
+    connect(
+        socket, SIGNAL(error(QAbstractSocket::SocketError)),
+        this, SLOT(socketErrorOccurred(QAbstractSocket::SocketError)));
+
+    auto* connectionSocket = new QTcpSocket(this);
+    connect(
+        connectionSocket, SIGNAL(connected()),
+        this, SLOT(connectionSocketConnected()));
+    connect(
+        connectionSocket, SIGNAL(disconnected()),
+        this, SLOT(connectionSocketDisconnected()));
+    connect(
+        connectionSocket, SIGNAL(readyRead()),
+        this, SLOT(readFromConnectionSocket()));
+    connect(
+        connectionSocket, SIGNAL(error(QAbstractSocket::SocketError)),
+        this, SLOT(socketErrorOccurred(QAbstractSocket::SocketError)));
+
+    ConnectedPair pair;
+    pair.m_client = socket;
+    pair.m_connection = connectionSocket;
+    pair.m_clientName = peerName(*socket);
+    m_sockets.push_back(std::move(pair));
+
+    connectionSocket->connectToHost(m_remoteHost, m_remotePort);
+}
+
+void Relay::sendPending()
+{
+    DataInfosList pending;
+    {
+        std::lock_guard<std::mutex> guard(m_sendLock);
+        pending.swap(m_pendingSend);
+    }
+
+    for (auto& dataPtr : pending) {
+        assert(dataPtr);
+        if (dataPtr->m_data.empty()) {
+            continue;
+        }
+
+        for (auto& connectedPair : m_sockets) {
+            assert(connectedPair.m_client != nullptr);
+            assert(connectedPair.m_connection != nullptr);
+            connectedPair.m_client->write(
+                reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+                static_cast<qint64>(dataPtr->m_data.size()));
+            connectedPair.m_connection->write(
+                reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+                static_cast<qint64>(dataPtr->m_data.size()));
+        }
+    }
+}
+
+void Relay::stop()
+{
+    while (!m_sockets.empty()) {
+        removeConnection(m_sockets.begin());
+    }
+
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+void Relay::clientConnectionTerminated()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        static constexpr bool Signal_from_unknown_object = false;
+        static_cast<void>(Signal_from_unknown_object);
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByClient(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    removeConnection(iter);
+}
+
+void Relay::readFromClientSocket()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    auto iter = findByClient(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    assert(iter->m_connection != nullptr);
+    performReadWrite(*socket, *iter->m_connection, iter->m_clientTap, iter->m_clientName, iter->m_connectionName);
+}
+
+void Relay::socketErrorOccurred(QAbstractSocket::SocketError err)
+{
+    if (err == QAbstractSocket::RemoteHostClosedError) {
+        // Ignore remote client disconnection
+        return;
+    }
+
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    emit sigErrorReported(socket->errorString());
+}
+
+void Relay::connectionSocketConnected()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        static constexpr bool Signal_from_unknown_object = false;
+        static_cast<void>(Signal_from_unknown_object);
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByConnection(socket);
+    assert(iter != m_sockets.end());
+    assert(iter->m_client != nullptr);
+
+    iter->m_connectionName = peerName(*socket);
+    connect(
+        iter->m_client, SIGNAL(readyRead()),
+        this, SLOT(readFromClientSocket()));
+
+    if (0 < iter->m_client->bytesAvailable()) {
+        performReadWrite(*iter->m_client, *socket, iter->m_clientTap, iter->m_clientName, iter->m_connectionName);
+    }
+}
+
+void Relay::connectionSocketDisconnected()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    if (socket == nullptr) {
+        static constexpr bool Signal_from_unknown_object = false;
+        static_cast<void>(Signal_from_unknown_object);
+        assert(Signal_from_unknown_object);
+        return;
+    }
+
+    auto iter = findByConnection(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    removeConnection(iter);
+}
+
+void Relay::readFromConnectionSocket()
+{
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    assert(socket != nullptr);
+
+    auto iter = findByConnection(socket);
+    if (iter == m_sockets.end()) {
+        return;
+    }
+
+    assert(iter->m_client != nullptr);
+    performReadWrite(*socket, *iter->m_client, iter->m_connectionTap, iter->m_connectionName, iter->m_clientName);
+}
+
+Relay::SocketsList::iterator Relay::findByClient(QTcpSocket* socket)
+{
+    return std::find_if(
+        m_sockets.begin(), m_sockets.end(),
+        [socket](const ConnectedPair& elem) -> bool
+        {
+            return elem.m_client == socket;
+        });
+}
+
+Relay::SocketsList::iterator Relay::findByConnection(QTcpSocket* socket)
+{
+    return std::find_if(
+        m_sockets.begin(), m_sockets.end(),
+        [socket](const ConnectedPair& elem) -> bool
+        {
+            return elem.m_connection == socket;
+        });
+}
+
+void Relay::removeConnection(SocketsList::iterator iter)
+{
+    assert(iter != m_sockets.end());
+    auto* clientSocket = iter->m_client;
+    auto* connectionSocket = iter->m_connection;
+    assert(clientSocket != nullptr);
+    assert(connectionSocket != nullptr);
+    closeTap(iter->m_clientTap);
+    closeTap(iter->m_connectionTap);
+    m_sockets.erase(iter);
+
+    for (auto* socket : {clientSocket, connectionSocket}) {
+        socket->blockSignals(true);
+        if (socket->state() == QTcpSocket::ConnectedState) {
+            socket->flush();
+            socket->disconnectFromHost();
+        }
+        socket->deleteLater();
+    }
+}
+
+void Relay::performReadWrite(
+    QTcpSocket& readFromSocket,
+    QTcpSocket& writeToSocket,
+    TapStream& stream,
+    const QString& from,
+    const QString& to)
+{
+    assert(!m_buf.empty());
+    while (0 < readFromSocket.bytesAvailable()) {
+        auto result =
+            readFromSocket.read(&m_buf[0], static_cast<qint64>(m_buf.size()));
+        if (result <= 0) {
+            break;
+        }
+
+        writeToSocket.write(&m_buf[0], result);
+        tap(stream, &m_buf[0], static_cast<std::size_t>(result), from, to);
+    }
+}
+
+void Relay::tap(
+    TapStream& stream,
+    const char* data,
+    std::size_t size,
+    const QString& from,
+    const QString& to)
+{
+    if (m_tapSampleRate == 0U) {
+        return;
+    }
+
+    // Sample contiguous windows of every stream, every window is
+    // decoded as a separate connection to avoid gluing the tail of one
+    // window to the head of the next one.
+    auto windowIdx = stream.m_chunksCount / TapWindowChunks;
+    ++stream.m_chunksCount;
+
+    if ((windowIdx % m_tapSampleRate) != 0U) {
+        closeTap(stream);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_tapLock);
+        if (m_tapQueueLimit <= m_tapped.size()) {
+            ++m_droppedCount;
+            if (stream.m_id != 0U) {
+                // The window is broken, the next sampled data starts a new one
+                m_tappedClosed.push_back(stream.m_id);
+                stream.m_id = 0U;
+            }
+            return;
+        }
+    }
+
+    if (stream.m_id == 0U) {
+        stream.m_id = m_nextTapId;
+        ++m_nextTapId;
+    }
+
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    dataPtr->m_connectionId = stream.m_id;
+    auto* begIter = reinterpret_cast<const std::uint8_t*>(data);
+    dataPtr->m_data.assign(begIter, begIter + size);
+    dataPtr->m_extraProperties.insert(FromPropName, from);
+    dataPtr->m_extraProperties.insert(ToPropName, to);
+
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> guard(m_tapLock);
+        notify = m_tapped.empty() && m_tappedClosed.empty();
+        m_tapped.push_back(std::move(dataPtr));
+    }
+
+    if (notify) {
+        emit sigTapped();
+    }
+}
+
+void Relay::closeTap(TapStream& stream)
+{
+    if (stream.m_id == 0U) {
+        return;
+    }
+
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> guard(m_tapLock);
+        notify = m_tapped.empty() && m_tappedClosed.empty();
+        m_tappedClosed.push_back(stream.m_id);
+    }
+
+    stream.m_id = 0U;
+    if (notify) {
+        emit sigTapped();
+    }
+}
+
+QString Relay::peerName(const QTcpSocket& socket)
+{
+    return
+        socket.peerAddress().toString() + ':' +
+            QString("%1").arg(socket.peerPort());
+}
+
+}  // namespace proxy
+
+}  // namespace tcp_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
@@ -0,0 +1,144 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtNetwork/QTcpSocket>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/DataInfo.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace tcp_socket
+{
+
+namespace proxy
+{
+
+class Relay : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    typedef unsigned short PortType;
+    typedef std::list<DataInfoPtr> DataInfosList;
+    typedef std::vector<DataInfo::ConnectionId> TapIdsList;
+
+    Relay(
+        const QString& remoteHost,
+        PortType remotePort,
+        unsigned tapSampleRate,
+        unsigned tapQueueLimit);
+
+    ~Relay() noexcept;
+
+    void queueSend(DataInfoPtr dataPtr);
+    void takeTapped(DataInfosList& tapped, TapIdsList& closed);
+
+    unsigned long long droppedCount() const;
+
+public slots:
+    void addClient(qintptr descriptor);
+    void sendPending();
+    void stop();
+
+signals:
+    void sigTapped();
+    void sigErrorReported(const QString& msg);
+
+private slots:
+    void clientConnectionTerminated();
+    void readFromClientSocket();
+    void socketErrorOccurred(QAbstractSocket::SocketError err);
+    void connectionSocketConnected();
+    void connectionSocketDisconnected();
+    void readFromConnectionSocket();
+
+private:
+    struct TapStream
+    {
+        DataInfo::ConnectionId m_id = 0U;
+        unsigned long long m_chunksCount = 0U;
+    };
+
+    struct ConnectedPair
+    {
+        QTcpSocket* m_client = nullptr;
+        QTcpSocket* m_connection = nullptr;
+        QString m_clientName;
+        QString m_connectionName;
+        TapStream m_clientTap;
+        TapStream m_connectionTap;
+    };
+
+    typedef std::list<ConnectedPair> SocketsList;
+
+    SocketsList::iterator findByClient(QTcpSocket* socket);
+    SocketsList::iterator findByConnection(QTcpSocket* socket);
+    void removeConnection(SocketsList::iterator iter);
+    void performReadWrite(
+        QTcpSocket& readFromSocket,
+        QTcpSocket& writeToSocket,
+        TapStream& stream,
+        const QString& from,
+        const QString& to);
+    void tap(TapStream& stream, const char* data, std::size_t size, const QString& from, const QString& to);
+    void closeTap(TapStream& stream);
+
+    static QString peerName(const QTcpSocket& socket);
+
+    QString m_remoteHost;
+    PortType m_remotePort = 0;
+    unsigned m_tapSampleRate = 0U;
+    std::size_t m_tapQueueLimit = 0U;
+    DataInfo::ConnectionId m_nextTapId = 1U;
+
+    SocketsList m_sockets;
+    std::vector<char> m_buf;
+
+    std::mutex m_sendLock;
+    DataInfosList m_pendingSend;
+
+    mutable std::mutex m_tapLock;
+    DataInfosList m_tapped;
+    TapIdsList m_tappedClosed;
+    unsigned long long m_droppedCount = 0U;
+};
+
+}  // namespace proxy
+
+}  // namespace tcp_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
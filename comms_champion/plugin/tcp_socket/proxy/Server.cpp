@@ -0,0 +1,48 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "Server.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace tcp_socket
+{
+
+namespace proxy
+{
+
+void Server::incomingConnection(qintptr descriptor)
+{
+    if (!m_forwardDescriptors) {
+        Base::incomingConnection(descriptor);
+        return;
+    }
+
+    emit sigIncomingDescriptor(descriptor);
+}
+
+}  // namespace proxy
+
+}  // namespace tcp_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
@@ -0,0 +1,72 @@
+//
+// Copyright 2021 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtNetwork/QTcpServer>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace tcp_socket
+{
+
+namespace proxy
+{
+
+/// @brief Listening server which may hand over the accepted connections
+///     as native descriptors.
+/// @details When descriptors forwarding is enabled, the accepted connection
+///     is reported via sigIncomingDescriptor() and the QTcpSocket object is
+///     expected to be created by the receiver in its own thread.
+class Server : public QTcpServer
+{
+    Q_OBJECT
+    using Base = QTcpServer;
+
+public:
+    Server() = default;
+
+    void setForwardDescriptors(bool value)
+    {
+        m_forwardDescriptors = value;
+    }
+
+signals:
+    void sigIncomingDescriptor(qintptr descriptor);
+
+protected:
+    virtual void incomingConnection(qintptr descriptor) override;
+
+private:
+    bool m_forwardDescriptors = false;
+};
+
+}  // namespace proxy
+
+}  // namespace tcp_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
@@ -20,6 +20,7 @@
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaType>
 #include <QtNetwork/QHostAddress>
 CC_ENABLE_WARNINGS()
 
@@ -47,6 +48,8 @@ const QString ToPropName("tcp.to");
 
 Socket::Socket()
 {
+    qRegisterMetaType<qintptr>("qintptr");
+
     QObject::connect(
         &m_server, SIGNAL(newConnection()),
         this, SLOT(newConnection()));
@@ -58,6 +61,7 @@ Socket::Socket()
 
 Socket::~Socket() noexcept
 {
+    stopRelay();
     while (!m_sockets.empty()) {
         removeConnection(m_sockets.begin());
     }
@@ -99,17 +103,32 @@ bool Socket::socketConnectImpl()
         return false;
     }
 
+    if (m_relayMode) {
+        startRelay();
+    }
+
     return true;
 }
 
 void Socket::socketDisconnectImpl()
 {
     m_server.close();
+    stopRelay();
 }
 
 void Socket::sendDataImpl(DataInfoPtr dataPtr)
 {
     assert(dataPtr);
+    if (m_relay) {
+        QString from =
+            m_server.serverAddress().toString() + ':' +
+                        QString("%1").arg(m_server.serverPort());
+        dataPtr->m_extraProperties.insert(FromPropName, from);
+        m_relay->queueSend(std::move(dataPtr));
+        emit sigRelaySendPending();
+        return;
+    }
+
     QVariantList toList;
     for (auto& connectedPair : m_sockets) {
         assert(connectedPair.first != nullptr);
@@ -144,6 +163,8 @@ unsigned Socket::connectionPropertiesImpl() const
 
 void Socket::newConnection()
 {
+    // In relay mode the connections are accepted by the relay thread
+    assert(!m_relay);
     auto *newConnSocket = m_server.nextPendingConnection();
     connect(
         newConnSocket, SIGNAL(disconnected()),
@@ -295,6 +316,29 @@ void Socket::readFromConnectionSocket()
     performReadWrite(*socket, clientSocket);
 }
 
+void Socket::relayTapped()
+{
+    if (!m_relay) {
+        return;
+    }
+
+    Relay::DataInfosList tapped;
+    Relay::TapIdsList closed;
+    m_relay->takeTapped(tapped, closed);
+    for (auto& dataPtr : tapped) {
+        reportDataReceived(std::move(dataPtr));
+    }
+
+    for (auto id : closed) {
+        reportConnectionClosed(id);
+    }
+}
+
+void Socket::relayErrorReported(const QString& msg)
+{
+    reportError(msg);
+}
+
 Socket::SocketsList::iterator Socket::findByClient(QTcpSocket* socket)
 {
     return std::find_if(
@@ -378,6 +422,50 @@ void Socket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSoc
     reportDataReceived(std::move(dataPtr));
 }
 
+void Socket::startRelay()
+{
+    assert(!m_relay);
+    m_relay.reset(
+        new Relay(
+            m_remoteHost,
+            m_remotePort,
+            m_tapSampleRate,
+            m_tapQueueLimit));
+    m_relay->moveToThread(&m_relayThread);
+
+    connect(
+        &m_server, SIGNAL(sigIncomingDescriptor(qintptr)),
+        m_relay.get(), SLOT(addClient(qintptr)));
+    connect(
+        this, SIGNAL(sigRelaySendPending()),
+        m_relay.get(), SLOT(sendPending()));
+    connect(
+        m_relay.get(), SIGNAL(sigTapped()),
+        this, SLOT(relayTapped()));
+    connect(
+        m_relay.get(), SIGNAL(sigErrorReported(const QString&)),
+        this, SLOT(relayErrorReported(const QString&)));
+
+    m_relayThread.start();
+    m_server.setForwardDescriptors(true);
+}
+
+void Socket::stopRelay()
+{
+    if (!m_relay) {
+        return;
+    }
+
+    m_server.setForwardDescriptors(false);
+    m_relay->disconnect(this);
+    m_server.disconnect(m_relay.get());
+    disconnect(m_relay.get());
+    QMetaObject::invokeMethod(m_relay.get(), "stop", Qt::BlockingQueuedConnection);
+    m_relayThread.quit();
+    m_relayThread.wait();
+    m_relay.reset();
+}
+
 }  // namespace proxy
 
 }  // namespace tcp_socket
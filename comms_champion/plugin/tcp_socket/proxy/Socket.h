@@ -18,15 +18,18 @@
 #pragma once
 
 #include <list>
+#include <memory>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
-#include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
+#include <QtCore/QThread>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Socket.h"
+#include "Relay.h"
+#include "Server.h"
 
 
 namespace comms_champion
@@ -83,6 +86,36 @@ public:
         return m_remotePort;
     }
 
+    void setRelayMode(bool value)
+    {
+        m_relayMode = value;
+    }
+
+    bool getRelayMode() const
+    {
+        return m_relayMode;
+    }
+
+    void setTapSampleRate(unsigned value)
+    {
+        m_tapSampleRate = value;
+    }
+
+    unsigned getTapSampleRate() const
+    {
+        return m_tapSampleRate;
+    }
+
+    void setTapQueueLimit(unsigned value)
+    {
+        m_tapQueueLimit = value;
+    }
+
+    unsigned getTapQueueLimit() const
+    {
+        return m_tapQueueLimit;
+    }
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
@@ -98,6 +131,11 @@ private slots:
     void connectionSocketConnected();
     void connectionSocketDisconnected();
     void readFromConnectionSocket();
+    void relayTapped();
+    void relayErrorReported(const QString& msg);
+
+signals:
+    void sigRelaySendPending();
 
 private:
     typedef QTcpSocket* ClientSocketPtr;
@@ -109,14 +147,23 @@ private:
     SocketsList::iterator findByConnection(QTcpSocket* socket);
     void removeConnection(SocketsList::iterator iter);
     void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket);
+    void startRelay();
+    void stopRelay();
 
     static const PortType DefaultPort = 20000;
+    static const unsigned DefaultTapSampleRate = 1U;
+    static const unsigned DefaultTapQueueLimit = 1024U;
     PortType m_port = DefaultPort;
     QString m_remoteHost;
     PortType m_remotePort = DefaultPort;
+    bool m_relayMode = false;
+    unsigned m_tapSampleRate = DefaultTapSampleRate;
+    unsigned m_tapQueueLimit = DefaultTapQueueLimit;
 
-    QTcpServer m_server;
+    Server m_server;
     SocketsList m_sockets;
+    QThread m_relayThread;
+    std::unique_ptr<Relay> m_relay;
 };
 
 }  // namespace proxy
@@ -55,6 +55,18 @@ SocketConfigWidget::SocketConfigWidget(
     m_ui.m_remotePortSpinBox->setValue(
         static_cast<int>(m_socket.getRemotePort()));
 
+    m_ui.m_relayModeCheckBox->setChecked(m_socket.getRelayMode());
+
+    m_ui.m_tapSampleRateSpinBox->setRange(0, std::numeric_limits<int>::max());
+    m_ui.m_tapSampleRateSpinBox->setValue(
+        static_cast<int>(m_socket.getTapSampleRate()));
+
+    m_ui.m_tapQueueLimitSpinBox->setRange(0, std::numeric_limits<int>::max());
+    m_ui.m_tapQueueLimitSpinBox->setValue(
+        static_cast<int>(m_socket.getTapQueueLimit()));
+
+    refreshTapWidgets();
+
     connect(
         m_ui.m_localPortSpinBox, SIGNAL(valueChanged(int)),
         this, SLOT(localPortValueChanged(int)));
@@ -66,6 +78,18 @@ SocketConfigWidget::SocketConfigWidget(
     connect(
         m_ui.m_remotePortSpinBox, SIGNAL(valueChanged(int)),
         this, SLOT(remotePortValueChanged(int)));
+
+    connect(
+        m_ui.m_relayModeCheckBox, SIGNAL(toggled(bool)),
+        this, SLOT(relayModeToggled(bool)));
+
+    connect(
+        m_ui.m_tapSampleRateSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(tapSampleRateValueChanged(int)));
+
+    connect(
+        m_ui.m_tapQueueLimitSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(tapQueueLimitValueChanged(int)));
 }
 
 SocketConfigWidget::~SocketConfigWidget() noexcept = default;
@@ -85,6 +109,31 @@ void SocketConfigWidget::remotePortValueChanged(int value)
     m_socket.setRemotePort(static_cast<PortType>(value));
 }
 
+void SocketConfigWidget::relayModeToggled(bool checked)
+{
+    m_socket.setRelayMode(checked);
+    refreshTapWidgets();
+}
+
+void SocketConfigWidget::tapSampleRateValueChanged(int value)
+{
+    m_socket.setTapSampleRate(static_cast<unsigned>(value));
+}
+
+void SocketConfigWidget::tapQueueLimitValueChanged(int value)
+{
+    m_socket.setTapQueueLimit(static_cast<unsigned>(value));
+}
+
+void SocketConfigWidget::refreshTapWidgets()
+{
+    bool enabled = m_socket.getRelayMode();
+    m_ui.m_tapSampleRateLabel->setEnabled(enabled);
+    m_ui.m_tapSampleRateSpinBox->setEnabled(enabled);
+    m_ui.m_tapQueueLimitLabel->setEnabled(enabled);
+    m_ui.m_tapQueueLimitSpinBox->setEnabled(enabled);
+}
+
 }  // namespace proxy
 
 }  // namespace tcp_socket
@@ -56,8 +56,13 @@ private slots:
     void localPortValueChanged(int value);
     void remoteHostValueChanged(const QString& value);
     void remotePortValueChanged(int value);
+    void relayModeToggled(bool checked);
+    void tapSampleRateValueChanged(int value);
+    void tapQueueLimitValueChanged(int value);
 
 private:
+    void refreshTapWidgets();
+
     Socket& m_socket;
     Ui::ProxySocketConfigWidget m_ui;
 };
@@ -42,6 +42,9 @@ const QString MainConfigKey("cc_tcp_proxy_socket");
 const QString LocalPortSubKey("local_port");
 const QString RemoteHostSubKey("remote_host");
 const QString RemotePortSubKey("remote_port");
+const QString RelayModeSubKey("relay_mode");
+const QString TapSampleRateSubKey("tap_sample_rate");
+const QString TapQueueLimitSubKey("tap_queue_limit");
 
 }  // namespace
 
@@ -72,6 +75,9 @@ void SocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(LocalPortSubKey, QVariant::fromValue(m_socket->getPort()));
     subConfig.insert(RemoteHostSubKey, QVariant::fromValue(m_socket->getRemoteHost()));
     subConfig.insert(RemotePortSubKey, QVariant::fromValue(m_socket->getRemotePort()));
+    subConfig.insert(RelayModeSubKey, QVariant::fromValue(m_socket->getRelayMode()));
+    subConfig.insert(TapSampleRateSubKey, QVariant::fromValue(m_socket->getTapSampleRate()));
+    subConfig.insert(TapQueueLimitSubKey, QVariant::fromValue(m_socket->getTapQueueLimit()));
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -108,6 +114,21 @@ void SocketPlugin::reconfigureImpl(const QVariantMap& config)
     m_socket->setPort(localPort);
     m_socket->setRemoteHost(remoteHost);
     m_socket->setRemotePort(remotePort);
+
+    auto relayModeVar = subConfig.value(RelayModeSubKey);
+    if (relayModeVar.isValid() && relayModeVar.canConvert<bool>()) {
+        m_socket->setRelayMode(relayModeVar.value<bool>());
+    }
+
+    auto tapSampleRateVar = subConfig.value(TapSampleRateSubKey);
+    if (tapSampleRateVar.isValid() && tapSampleRateVar.canConvert<unsigned>()) {
+        m_socket->setTapSampleRate(tapSampleRateVar.value<unsigned>());
+    }
+
+    auto tapQueueLimitVar = subConfig.value(TapQueueLimitSubKey);
+    if (tapQueueLimitVar.isValid() && tapQueueLimitVar.canConvert<unsigned>()) {
+        m_socket->setTapQueueLimit(tapQueueLimitVar.value<unsigned>());
+    }
 }
 
 void SocketPlugin::createSocketIfNeeded()
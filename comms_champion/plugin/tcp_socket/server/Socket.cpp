@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
 #include <cassert>
 
 #include "comms/CompileControl.h"
@@ -43,6 +44,13 @@ namespace
 const QString FromPropName("tcp.from");
 const QString ToPropName("tcp.to");
 
+QString peerName(const QTcpSocket& socket)
+{
+    return
+        socket.peerAddress().toString() + ':' +
+            QString("%1").arg(socket.peerPort());
+}
+
 }  // namespace
 
 Socket::Socket()
@@ -58,8 +66,8 @@ Socket::Socket()
 
 Socket::~Socket() noexcept
 {
-    for (auto* socket : m_sockets) {
-        socket->flush();
+    for (auto& info : m_sockets) {
+        info.m_socket->flush();
     }
 }
 
@@ -82,6 +90,9 @@ bool Socket::socketConnectImpl()
         return false;
     }
 
+    m_serverName =
+        m_server.serverAddress().toString() + ':' +
+                    QString("%1").arg(m_server.serverPort());
     return true;
 }
 
@@ -97,24 +108,16 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
 
     QVariantList toList;
 
-    for (auto* socketTmp : m_sockets) {
-        auto* socket = qobject_cast<QTcpSocket*>(socketTmp);
-        assert(socket != nullptr);
-        socket->write(
+    for (auto& info : m_sockets) {
+        assert(info.m_socket != nullptr);
+        info.m_socket->write(
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
             static_cast<qint64>(dataPtr->m_data.size()));
 
-        QString to =
-            socket->peerAddress().toString() + ':' +
-                        QString("%1").arg(socket->peerPort());
-        toList.append(to);
+        toList.append(info.m_name);
     }
 
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
-
-    dataPtr->m_extraProperties.insert(FromPropName, from);
+    dataPtr->m_extraProperties.insert(FromPropName, m_serverName);
     dataPtr->m_extraProperties.insert(ToPropName, toList);
 }
 
@@ -126,7 +129,17 @@ unsigned Socket::connectionPropertiesImpl() const
 void Socket::newConnection()
 {
     auto *newConnSocket = m_server.nextPendingConnection();
-    m_sockets.push_back(newConnSocket);
+    ConnectionInfo info;
+    info.m_socket = newConnSocket;
+    info.m_id = m_nextConnectionId;
+    info.m_name = peerName(*newConnSocket);
+
+    QVariantMap endpoints;
+    endpoints.insert(FromPropName, info.m_name);
+    endpoints.insert(ToPropName, m_serverName);
+    info.m_endpoints = internDataEndpoints(endpoints);
+    ++m_nextConnectionId;
+    m_sockets.push_back(std::move(info));
     connect(
         newConnSocket, SIGNAL(disconnected()),
         newConnSocket, SLOT(deleteLater()));
@@ -144,7 +157,7 @@ void Socket::newConnection()
 void Socket::connectionTerminated()
 {
     auto* socket = sender();
-    auto iter = std::find(m_sockets.begin(), m_sockets.end(), socket);
+    auto iter = findConnection(socket);
     if (iter == m_sockets.end()) {
         static constexpr bool Must_have_found_socket = false;
         static_cast<void>(Must_have_found_socket);
@@ -152,7 +165,22 @@ void Socket::connectionTerminated()
         return;
     }
 
+    // The last data of the client may still reside in the socket's buffer
+    auto dataPtr = readConnectionData(*iter);
+    auto id = iter->m_id;
+
+    m_pendingReads.erase(
+        std::remove(m_pendingReads.begin(), m_pendingReads.end(), iter->m_socket),
+        m_pendingReads.end());
     m_sockets.erase(iter);
+
+    if (dataPtr) {
+        DataInfosList dataList;
+        dataList.push_back(std::move(dataPtr));
+        reportDataListReceived(std::move(dataList));
+    }
+
+    reportConnectionClosed(id);
 }
 
 void Socket::readFromSocket()
@@ -160,28 +188,43 @@ void Socket::readFromSocket()
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
 
-    auto dataPtr = makeDataInfo();
-    dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    auto iter = std::find(m_pendingReads.begin(), m_pendingReads.end(), socket);
+    if (iter != m_pendingReads.end()) {
+        return;
+    }
 
-    auto dataSize = socket->bytesAvailable();
-    dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
-    auto result =
-        socket->read(reinterpret_cast<char*>(&dataPtr->m_data[0]), dataSize);
-    if (result != dataSize) {
-        dataPtr->m_data.resize(static_cast<std::size_t>(result));
+    // Collect data from all the clients that became readable before
+    // reporting it in a single batch.
+    if (m_pendingReads.empty()) {
+        QMetaObject::invokeMethod(this, "readPending", Qt::QueuedConnection);
     }
 
-    QString from =
-        socket->peerAddress().toString() + ':' +
-                    QString("%1").arg(socket->peerPort());
-    dataPtr->m_extraProperties.insert(FromPropName, from);
+    m_pendingReads.push_back(socket);
+}
 
-    QString to =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
-    dataPtr->m_extraProperties.insert(ToPropName, to);
+void Socket::readPending()
+{
+    DataInfosList dataList;
+    for (auto* socket : m_pendingReads) {
+        auto connIter = findConnection(socket);
+        if (connIter == m_sockets.end()) {
+            continue;
+        }
+
+        auto dataPtr = readConnectionData(*connIter);
+        if (!dataPtr) {
+            continue;
+        }
+
+        dataList.push_back(std::move(dataPtr));
+    }
+    m_pendingReads.clear();
+
+    if (dataList.empty()) {
+        return;
+    }
 
-    reportDataReceived(std::move(dataPtr));
+    reportDataListReceived(std::move(dataList));
 }
 
 void Socket::socketErrorOccurred(QAbstractSocket::SocketError err)
@@ -207,6 +250,43 @@ void Socket::acceptErrorOccurred(QAbstractSocket::SocketError err)
     }
 }
 
+Socket::ConnectionsList::iterator Socket::findConnection(QObject* socket)
+{
+    return std::find_if(
+        m_sockets.begin(), m_sockets.end(),
+        [socket](const ConnectionInfo& info) -> bool
+        {
+            return info.m_socket == socket;
+        });
+}
+
+DataInfoPtr Socket::readConnectionData(const ConnectionInfo& info)
+{
+    assert(info.m_socket != nullptr);
+    auto dataSize = info.m_socket->bytesAvailable();
+    if (dataSize <= 0) {
+        return DataInfoPtr();
+    }
+
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    dataPtr->m_connectionId = info.m_id;
+
+    dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
+    auto result =
+        info.m_socket->read(reinterpret_cast<char*>(&dataPtr->m_data[0]), dataSize);
+    if (result != dataSize) {
+        dataPtr->m_data.resize(static_cast<std::size_t>(std::max(result, qint64(0))));
+    }
+
+    if (dataPtr->m_data.empty()) {
+        return DataInfoPtr();
+    }
+
+    dataPtr->m_endpoints = info.m_endpoints;
+    return dataPtr;
+}
+
 }  // namespace server
 
 }  // namespace tcp_socket
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -73,14 +74,31 @@ private slots:
     void newConnection();
     void connectionTerminated();
     void readFromSocket();
+    void readPending();
     void socketErrorOccurred(QAbstractSocket::SocketError err);
     void acceptErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    struct ConnectionInfo
+    {
+        QTcpSocket* m_socket = nullptr;
+        DataInfo::ConnectionId m_id = 0U;
+        DataEndpointsPtr m_endpoints;
+        QString m_name;
+    };
+
+    typedef std::list<ConnectionInfo> ConnectionsList;
+
+    ConnectionsList::iterator findConnection(QObject* socket);
+    static DataInfoPtr readConnectionData(const ConnectionInfo& info);
+
     static const PortType DefaultPort = 20000;
     PortType m_port = DefaultPort;
-    std::list<QTcpSocket*> m_sockets;
+    ConnectionsList m_sockets;
+    std::vector<QTcpSocket*> m_pendingReads;
     QTcpServer m_server;
+    QString m_serverName;
+    DataInfo::ConnectionId m_nextConnectionId = 1U;
 };
 
 }  // namespace server
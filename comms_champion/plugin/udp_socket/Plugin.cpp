@@ -42,6 +42,8 @@ const QString HostSubKey("host");
 const QString PortSubKey("port");
 const QString LocalPortSubKey("local_port");
 const QString BroadcastPropName("broadcast_prop");
+const QString RecvBufSizeSubKey("recv_buf_size");
+const QString BatchModeSubKey("batch_mode");
 
 }  // namespace
 
@@ -74,6 +76,8 @@ void Plugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(PortSubKey, m_socket->getPort());
     subConfig.insert(LocalPortSubKey, m_socket->getLocalPort());
     subConfig.insert(BroadcastPropName, m_socket->getBroadcastPropName());
+    subConfig.insert(RecvBufSizeSubKey, m_socket->getRecvBufSize());
+    subConfig.insert(BatchModeSubKey, m_socket->getBatchMode());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -113,6 +117,16 @@ void Plugin::reconfigureImpl(const QVariantMap& config)
         auto propName = broadcastBroadcastNameVar.value<QString>();
         m_socket->setBroadcastPropName(propName);
     }
+
+    auto recvBufSizeVar = subConfig.value(RecvBufSizeSubKey);
+    if (recvBufSizeVar.isValid() && recvBufSizeVar.canConvert<unsigned>()) {
+        m_socket->setRecvBufSize(recvBufSizeVar.value<unsigned>());
+    }
+
+    auto batchModeVar = subConfig.value(BatchModeSubKey);
+    if (batchModeVar.isValid() && batchModeVar.canConvert<bool>()) {
+        m_socket->setBatchMode(batchModeVar.value<bool>());
+    }
 }
 
 void Plugin::createSocketIfNeeded()
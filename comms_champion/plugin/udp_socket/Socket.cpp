@@ -15,13 +15,29 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <vector>
+
+#ifdef __linux__
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // #ifdef __linux__
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaObject>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QTimer>
 #include <QtNetwork/QHostAddress>
+#include <QtNetwork/QHostInfo>
 CC_ENABLE_WARNINGS()
 
 #include "Socket.h"
@@ -46,8 +62,91 @@ const QString DefaultBroadcastPropName("broadcast");
 const QString FromPropName("udp.from");
 const QString ToPropName("udp.to");
 
+#ifdef __linux__
+
+const std::size_t BatchSize = 32U;
+const std::size_t MaxDatagramSize = 65536U;
+
+QString addrToString(const sockaddr* addr)
+{
+    quint16 port = 0U;
+    if (addr->sa_family == AF_INET) {
+        port = ntohs(reinterpret_cast<const sockaddr_in*>(addr)->sin_port);
+    }
+    else if (addr->sa_family == AF_INET6) {
+        port = ntohs(reinterpret_cast<const sockaddr_in6*>(addr)->sin6_port);
+    }
+
+    return QHostAddress(addr).toString() + ':' + QString("%1").arg(port);
+}
+
+bool resolveIpv4(const QString& host, quint16 port, sockaddr_in& addr)
+{
+    QHostAddress hostAddr;
+    if (!hostAddr.setAddress(host)) {
+        auto info = QHostInfo::fromName(host);
+        for (auto& resolved : info.addresses()) {
+            if (resolved.protocol() == QAbstractSocket::IPv4Protocol) {
+                hostAddr = resolved;
+                break;
+            }
+        }
+    }
+
+    bool ok = false;
+    auto ipv4 = hostAddr.toIPv4Address(&ok);
+    if (!ok) {
+        return false;
+    }
+
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(ipv4);
+    addr.sin_port = htons(port);
+    return true;
+}
+
+#endif // #ifdef __linux__
+
 }  // namespace
 
+#ifdef __linux__
+
+struct Socket::BatchState
+{
+    struct PendingWrite
+    {
+        DataInfoPtr m_data;
+        sockaddr_storage m_dest;
+        socklen_t m_destLen = 0U;
+    };
+
+    int m_fd = -1;
+    std::unique_ptr<QSocketNotifier> m_notifier;
+    bool m_connected = false;
+    sockaddr_storage m_peer;
+    socklen_t m_peerLen = 0U;
+    QString m_localName;
+    QString m_peerName;
+    std::vector<std::uint8_t> m_recvBuf;
+    std::array<mmsghdr, BatchSize> m_recvMsgs;
+    std::array<iovec, BatchSize> m_recvIovs;
+    std::array<sockaddr_storage, BatchSize> m_recvAddrs;
+    sockaddr_storage m_lastSender;
+    socklen_t m_lastSenderLen = 0U;
+    DataEndpointsPtr m_lastEndpoints;
+    std::deque<PendingWrite> m_pendingWrites;
+    bool m_flushScheduled = false;
+};
+
+#else // #ifdef __linux__
+
+struct Socket::BatchState
+{
+};
+
+#endif // #ifdef __linux__
+
 
 Socket::Socket()
   : m_host(DefaultHost),
@@ -73,6 +172,7 @@ Socket::Socket()
 Socket::~Socket() noexcept
 {
     m_socket.blockSignals(true);
+    disconnectBatch();
 }
 
 bool Socket::socketConnectImpl()
@@ -93,6 +193,17 @@ bool Socket::socketConnectImpl()
 
     assert(!m_socket.isOpen());
     assert(!m_broadcastSocket.isOpen());
+    assert(!m_batch);
+
+    if (m_batchMode) {
+#ifdef __linux__
+        m_running = connectBatch();
+        return m_running;
+#else // #ifdef __linux__
+        reportError("Batched datagrams I/O is not supported on this platform, using regular one.");
+#endif // #ifdef __linux__
+    }
+
     m_running = true;
 
     do {
@@ -103,6 +214,9 @@ bool Socket::socketConnectImpl()
         if (!bindSocket(m_socket)) {
             reportError("Failed to bind UDP socket to port " + QString("%1").arg(m_localPort));
         }
+        else if (m_recvBufSize != 0U) {
+            m_socket.setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, m_recvBufSize);
+        }
 
         if (!bindSocket(m_broadcastSocket)) {
             reportError("Failed to bind broadcast UDP socket to port " + QString("%1").arg(m_localPort));
@@ -125,16 +239,23 @@ bool Socket::socketConnectImpl()
 
 void Socket::socketDisconnectImpl()
 {
+    disconnectBatch();
     m_socket.blockSignals(true);
     m_socket.close();
     m_broadcastSocket.close();
     m_running = false;
+    m_lastEndpoints.reset();
     m_socket.blockSignals(false);
 }
 
 void Socket::sendDataImpl(DataInfoPtr dataPtr)
 {
     assert(dataPtr);
+    if (m_batch) {
+        sendBatch(std::move(dataPtr));
+        return;
+    }
+
     QString from =
         m_socket.localAddress().toString() + ':' +
                     QString("%1").arg(m_socket.localPort());
@@ -234,15 +355,29 @@ void Socket::readData(QUdpSocket& socket)
             &senderAddress,
             &senderPort);
 
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_socket.localAddress().toString() + ':' +
-                        QString("%1").arg(m_socket.localPort());
+        auto localAddress = m_socket.localAddress();
+        if ((!m_lastEndpoints) ||
+            (senderPort != m_lastSenderPort) ||
+            (senderAddress != m_lastSenderAddress) ||
+            (localAddress != m_lastLocalAddress)) {
+            QString from =
+                senderAddress.toString() + ':' +
+                            QString("%1").arg(senderPort);
+            QString to =
+                localAddress.toString() + ':' +
+                            QString("%1").arg(m_socket.localPort());
+
+            QVariantMap endpoints;
+            endpoints.insert(FromPropName, from);
+            endpoints.insert(ToPropName, to);
+
+            m_lastEndpoints = internDataEndpoints(endpoints);
+            m_lastSenderAddress = senderAddress;
+            m_lastSenderPort = senderPort;
+            m_lastLocalAddress = localAddress;
+        }
 
-        dataPtr->m_extraProperties.insert(FromPropName, from);
-        dataPtr->m_extraProperties.insert(ToPropName, to);
+        dataPtr->m_endpoints = m_lastEndpoints;
         reportDataReceived(std::move(dataPtr));
 
         if (m_socket.state() != QUdpSocket::ConnectedState) {
@@ -263,6 +398,315 @@ bool Socket::bindSocket(QUdpSocket& socket)
     return socket.open(QUdpSocket::ReadWrite);
 }
 
+#ifdef __linux__
+
+bool Socket::connectBatch()
+{
+    m_batch.reset(new BatchState());
+    auto& batch = *m_batch;
+
+    batch.m_fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (batch.m_fd < 0) {
+        reportError("Failed to create UDP socket.");
+        disconnectBatch();
+        return false;
+    }
+
+    int enabled = 1;
+    ::setsockopt(batch.m_fd, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+    ::setsockopt(batch.m_fd, SOL_SOCKET, SO_BROADCAST, &enabled, sizeof(enabled));
+    if (m_recvBufSize != 0U) {
+        int recvBufSize = static_cast<int>(m_recvBufSize);
+        ::setsockopt(batch.m_fd, SOL_SOCKET, SO_RCVBUF, &recvBufSize, sizeof(recvBufSize));
+    }
+
+    sockaddr_in localAddr;
+    std::memset(&localAddr, 0, sizeof(localAddr));
+    localAddr.sin_family = AF_INET;
+    localAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+    localAddr.sin_port = htons(m_localPort);
+    if (::bind(batch.m_fd, reinterpret_cast<const sockaddr*>(&localAddr), sizeof(localAddr)) != 0) {
+        reportError("Failed to bind UDP socket to port " + QString("%1").arg(m_localPort));
+        disconnectBatch();
+        return false;
+    }
+
+    do {
+        if (m_host.isEmpty()) {
+            break;
+        }
+
+        sockaddr_in remoteAddr;
+        if ((!resolveIpv4(m_host, m_port, remoteAddr)) ||
+            (::connect(batch.m_fd, reinterpret_cast<const sockaddr*>(&remoteAddr), sizeof(remoteAddr)) != 0)) {
+            reportError("Failed to connect UDP socket to " + QString("%1:%2").arg(m_host).arg(m_port));
+            break;
+        }
+
+        batch.m_connected = true;
+        batch.m_peerName = addrToString(reinterpret_cast<const sockaddr*>(&remoteAddr));
+    } while (false);
+
+    sockaddr_storage boundAddr;
+    socklen_t boundAddrLen = sizeof(boundAddr);
+    if (::getsockname(batch.m_fd, reinterpret_cast<sockaddr*>(&boundAddr), &boundAddrLen) == 0) {
+        batch.m_localName = addrToString(reinterpret_cast<const sockaddr*>(&boundAddr));
+    }
+
+    batch.m_recvBuf.resize(BatchSize * MaxDatagramSize);
+    std::memset(batch.m_recvMsgs.data(), 0, sizeof(batch.m_recvMsgs));
+    for (auto idx = 0U; idx < BatchSize; ++idx) {
+        auto& iov = batch.m_recvIovs[idx];
+        iov.iov_base = &batch.m_recvBuf[idx * MaxDatagramSize];
+        iov.iov_len = MaxDatagramSize;
+
+        auto& hdr = batch.m_recvMsgs[idx].msg_hdr;
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        hdr.msg_name = &batch.m_recvAddrs[idx];
+    }
+
+    batch.m_notifier.reset(new QSocketNotifier(batch.m_fd, QSocketNotifier::Read));
+    connect(
+        batch.m_notifier.get(), SIGNAL(activated(int)),
+        this, SLOT(readBatch()));
+    return true;
+}
+
+void Socket::disconnectBatch()
+{
+    if (!m_batch) {
+        return;
+    }
+
+    auto& batch = *m_batch;
+    if (!batch.m_pendingWrites.empty()) {
+        flushBatchWrites();
+    }
+
+    batch.m_notifier.reset();
+    if (0 <= batch.m_fd) {
+        ::close(batch.m_fd);
+    }
+
+    m_batch.reset();
+}
+
+void Socket::readBatch()
+{
+    if (!m_batch) {
+        return;
+    }
+
+    auto& batch = *m_batch;
+    DataInfosList dataList;
+    while (true) {
+        for (auto& msg : batch.m_recvMsgs) {
+            msg.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            msg.msg_hdr.msg_flags = 0;
+            msg.msg_len = 0U;
+        }
+
+        auto count =
+            ::recvmmsg(
+                batch.m_fd,
+                batch.m_recvMsgs.data(),
+                static_cast<unsigned>(batch.m_recvMsgs.size()),
+                MSG_DONTWAIT,
+                nullptr);
+
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                std::cout << "ERROR: UDP Socket: " << std::strerror(errno) << std::endl;
+            }
+            break;
+        }
+
+        auto timestamp = DataInfo::TimestampClock::now();
+        for (auto idx = 0U; idx < static_cast<unsigned>(count); ++idx) {
+            auto& msg = batch.m_recvMsgs[idx];
+            auto* data = reinterpret_cast<const std::uint8_t*>(batch.m_recvIovs[idx].iov_base);
+            auto* sender = reinterpret_cast<const sockaddr*>(&batch.m_recvAddrs[idx]);
+            auto senderLen = msg.msg_hdr.msg_namelen;
+
+            // Every datagram is reported as separate data chunk
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_timestamp = timestamp;
+            dataPtr->m_data.assign(data, data + msg.msg_len);
+
+            if ((!batch.m_lastEndpoints) ||
+                (senderLen != batch.m_lastSenderLen) ||
+                (std::memcmp(sender, &batch.m_lastSender, senderLen) != 0)) {
+                QVariantMap endpoints;
+                endpoints.insert(FromPropName, addrToString(sender));
+                endpoints.insert(ToPropName, batch.m_localName);
+                batch.m_lastEndpoints = internDataEndpoints(endpoints);
+                std::memcpy(&batch.m_lastSender, sender, senderLen);
+                batch.m_lastSenderLen = senderLen;
+            }
+
+            dataPtr->m_endpoints = batch.m_lastEndpoints;
+            dataList.push_back(std::move(dataPtr));
+
+            if (batch.m_connected || (0U < batch.m_peerLen)) {
+                continue;
+            }
+
+            // Reply to the first sender, just like in regular mode, but without
+            // connecting the socket, which would filter out other senders.
+            std::memcpy(&batch.m_peer, sender, senderLen);
+            batch.m_peerLen = senderLen;
+            batch.m_peerName = addrToString(sender);
+        }
+
+        if (static_cast<unsigned>(count) < batch.m_recvMsgs.size()) {
+            // Drained
+            break;
+        }
+    }
+
+    if (dataList.empty()) {
+        return;
+    }
+
+    reportDataListReceived(std::move(dataList));
+}
+
+void Socket::sendBatch(DataInfoPtr dataPtr)
+{
+    assert(m_batch);
+    auto& batch = *m_batch;
+
+    BatchState::PendingWrite write;
+    QString to;
+    do {
+        if ((dataPtr->m_extraProperties.contains(m_broadcastPropName)) &&
+            (m_port != 0)) {
+            sockaddr_in broadcastAddr;
+            std::memset(&broadcastAddr, 0, sizeof(broadcastAddr));
+            broadcastAddr.sin_family = AF_INET;
+            broadcastAddr.sin_addr.s_addr = htonl(INADDR_BROADCAST);
+            broadcastAddr.sin_port = htons(m_port);
+            std::memcpy(&write.m_dest, &broadcastAddr, sizeof(broadcastAddr));
+            write.m_destLen = sizeof(broadcastAddr);
+            to = addrToString(reinterpret_cast<const sockaddr*>(&broadcastAddr));
+            break;
+        }
+
+        if (batch.m_connected) {
+            to = batch.m_peerName;
+            break;
+        }
+
+        if (batch.m_peerLen == 0U) {
+            // Nowhere to send
+            return;
+        }
+
+        std::memcpy(&write.m_dest, &batch.m_peer, batch.m_peerLen);
+        write.m_destLen = batch.m_peerLen;
+        to = batch.m_peerName;
+    } while (false);
+
+    dataPtr->m_extraProperties.insert(FromPropName, batch.m_localName);
+    dataPtr->m_extraProperties.insert(ToPropName, to);
+
+    write.m_data = std::move(dataPtr);
+    batch.m_pendingWrites.push_back(std::move(write));
+
+    if (batch.m_flushScheduled) {
+        return;
+    }
+
+    // All the datagrams sent in the same event loop iteration are written at once
+    batch.m_flushScheduled = true;
+    QMetaObject::invokeMethod(this, "flushBatchWrites", Qt::QueuedConnection);
+}
+
+void Socket::flushBatchWrites()
+{
+    if (!m_batch) {
+        return;
+    }
+
+    auto& batch = *m_batch;
+    batch.m_flushScheduled = false;
+
+    std::array<mmsghdr, BatchSize> msgs;
+    std::array<iovec, BatchSize> iovs;
+    while (!batch.m_pendingWrites.empty()) {
+        auto count = std::min(BatchSize, batch.m_pendingWrites.size());
+        std::memset(msgs.data(), 0, sizeof(msgs));
+        for (auto idx = 0U; idx < count; ++idx) {
+            auto& write = batch.m_pendingWrites[idx];
+            auto& iov = iovs[idx];
+            iov.iov_base = write.m_data->m_data.data();
+            iov.iov_len = write.m_data->m_data.size();
+
+            auto& hdr = msgs[idx].msg_hdr;
+            hdr.msg_iov = &iov;
+            hdr.msg_iovlen = 1;
+            if (write.m_destLen != 0U) {
+                hdr.msg_name = &write.m_dest;
+                hdr.msg_namelen = write.m_destLen;
+            }
+        }
+
+        auto sent = ::sendmmsg(batch.m_fd, msgs.data(), static_cast<unsigned>(count), 0);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                // Retry a bit later
+                batch.m_flushScheduled = true;
+                QTimer::singleShot(1, this, SLOT(flushBatchWrites()));
+                return;
+            }
+
+            // Drop the failing datagram
+            std::cout << "ERROR: UDP Socket: " << std::strerror(errno) << std::endl;
+            sent = 1;
+        }
+
+        batch.m_pendingWrites.erase(
+            batch.m_pendingWrites.begin(),
+            batch.m_pendingWrites.begin() + sent);
+    }
+}
+
+#else // #ifdef __linux__
+
+bool Socket::connectBatch()
+{
+    return false;
+}
+
+void Socket::disconnectBatch()
+{
+    m_batch.reset();
+}
+
+void Socket::readBatch()
+{
+}
+
+void Socket::sendBatch(DataInfoPtr dataPtr)
+{
+    static_cast<void>(dataPtr);
+}
+
+void Socket::flushBatchWrites()
+{
+}
+
+#endif // #ifdef __linux__
+
 }  // namespace client
 
 }  // namespace udp_socket
@@ -18,10 +18,12 @@
 #pragma once
 
 #include <list>
+#include <memory>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
+#include <QtNetwork/QHostAddress>
 #include <QtNetwork/QUdpSocket>
 CC_ENABLE_WARNINGS()
 
@@ -92,6 +94,28 @@ public:
         return m_broadcastPropName;
     }
 
+    /// @brief Set socket receive buffer size in bytes, 0 means system default.
+    void setRecvBufSize(unsigned value)
+    {
+        m_recvBufSize = value;
+    }
+
+    unsigned getRecvBufSize() const
+    {
+        return m_recvBufSize;
+    }
+
+    /// @brief Enable batched datagrams I/O (recvmmsg / sendmmsg), Linux only.
+    void setBatchMode(bool value)
+    {
+        m_batchMode = value;
+    }
+
+    bool getBatchMode() const
+    {
+        return m_batchMode;
+    }
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
@@ -102,10 +126,18 @@ private slots:
     void readFromSocket();
     void readFromBroadcastSocket();
     void socketErrorOccurred(QAbstractSocket::SocketError err);
+    void readBatch();
+    void flushBatchWrites();
 
 private:
+    struct BatchState;
+    using BatchStatePtr = std::unique_ptr<BatchState>;
+
     void readData(QUdpSocket& socket);
     bool bindSocket(QUdpSocket& socket);
+    bool connectBatch();
+    void disconnectBatch();
+    void sendBatch(DataInfoPtr dataPtr);
 
     static const PortType DefaultPort = 20000;
 
@@ -113,9 +145,16 @@ private:
     PortType m_port = DefaultPort;
     PortType m_localPort = 0;
     QString m_broadcastPropName;
+    unsigned m_recvBufSize = 0U;
+    bool m_batchMode = false;
     QUdpSocket m_socket;
     QUdpSocket m_broadcastSocket;
     bool m_running = false;
+    QHostAddress m_lastSenderAddress;
+    quint16 m_lastSenderPort = 0U;
+    QHostAddress m_lastLocalAddress;
+    DataEndpointsPtr m_lastEndpoints;
+    BatchStatePtr m_batch;
 };
 
 }  // namespace client
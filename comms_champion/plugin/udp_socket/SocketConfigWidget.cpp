@@ -57,6 +57,15 @@ SocketConfigWidget::SocketConfigWidget(
 
     m_ui.m_broadcastLineEdit->setText(m_socket.getBroadcastPropName());
 
+    m_ui.m_recvBufSizeSpinBox->setRange(
+        0,
+        std::numeric_limits<int>::max());
+
+    m_ui.m_recvBufSizeSpinBox->setValue(
+        static_cast<int>(m_socket.getRecvBufSize()));
+
+    m_ui.m_batchModeCheckBox->setChecked(m_socket.getBatchMode());
+
     connect(
         m_ui.m_hostLineEdit, SIGNAL(textChanged(const QString&)),
         this, SLOT(hostValueChanged(const QString&)));
@@ -73,6 +82,14 @@ SocketConfigWidget::SocketConfigWidget(
         m_ui.m_broadcastLineEdit, SIGNAL(textChanged(const QString&)),
         this, SLOT(broadcastValueChanged(const QString&)));
 
+    connect(
+        m_ui.m_recvBufSizeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(recvBufSizeValueChanged(int)));
+
+    connect(
+        m_ui.m_batchModeCheckBox, SIGNAL(stateChanged(int)),
+        this, SLOT(batchModeChanged(int)));
+
 }
 
 SocketConfigWidget::~SocketConfigWidget() noexcept = default;
@@ -97,6 +114,16 @@ void SocketConfigWidget::broadcastValueChanged(const QString& value)
     m_socket.setBroadcastPropName(value);
 }
 
+void SocketConfigWidget::recvBufSizeValueChanged(int value)
+{
+    m_socket.setRecvBufSize(static_cast<unsigned>(value));
+}
+
+void SocketConfigWidget::batchModeChanged(int value)
+{
+    m_socket.setBatchMode(value != Qt::Unchecked);
+}
+
 }  // namespace client
 
 }  // namespace udp_socket
@@ -57,6 +57,8 @@ private slots:
     void portValueChanged(int value);
     void localPortValueChanged(int value);
     void broadcastValueChanged(const QString& value);
+    void recvBufSizeValueChanged(int value);
+    void batchModeChanged(int value);
 
 private:
     Socket& m_socket;